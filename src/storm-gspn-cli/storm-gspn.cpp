@@ -34,6 +34,7 @@
 #include "storm/settings/modules/DebugSettings.h"
 #include "storm/settings/modules/JaniExportSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/settings/modules/MarkovAutomatonSettings.h"
 
 
 /*!
@@ -50,6 +51,7 @@ void initializeSettings() {
     storm::settings::addModule<storm::settings::modules::DebugSettings>();
     storm::settings::addModule<storm::settings::modules::JaniExportSettings>();
     storm::settings::addModule<storm::settings::modules::ResourceSettings>();
+    storm::settings::addModule<storm::settings::modules::MarkovAutomatonSettings>();
 }
 
 
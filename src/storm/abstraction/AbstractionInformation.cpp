@@ -377,6 +377,13 @@ namespace storm {
             return predicates[indexIt->second];
         }
         
+        template<storm::dd::DdType DdType>
+        uint_fast64_t AbstractionInformation<DdType>::getPredicateIndexForDdVariableIndex(uint_fast64_t ddVariableIndex) const {
+            auto indexIt = ddVariableIndexToPredicateIndexMap.find(ddVariableIndex);
+            STORM_LOG_THROW(indexIt != ddVariableIndexToPredicateIndexMap.end(), storm::exceptions::InvalidOperationException, "Unknown DD variable index.");
+            return indexIt->second;
+        }
+        
         template <storm::dd::DdType DdType>
         std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> AbstractionInformation<DdType>::declareNewVariables(std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& oldPredicates, std::set<uint_fast64_t> const& newPredicates) const {
             std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> result;
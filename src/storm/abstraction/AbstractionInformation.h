@@ -429,6 +429,14 @@ namespace storm {
              */
             storm::expressions::Expression const& getPredicateForDdVariableIndex(uint_fast64_t ddVariableIndex) const;
             
+            /*!
+             * Retrieves the index of the predicate associated with the given DD variable index.
+             *
+             * @param ddVariableIndex The DD variable index for which to retrieve the predicate index.
+             * @return The index of the predicate associated with the given DD variable index.
+             */
+            uint_fast64_t getPredicateIndexForDdVariableIndex(uint_fast64_t ddVariableIndex) const;
+            
             /*!
              * Declares new variables for the missing predicates.
              *
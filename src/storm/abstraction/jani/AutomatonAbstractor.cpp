@@ -15,6 +15,7 @@
 #include "storm/adapters/CarlAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
     namespace abstraction {
@@ -57,7 +58,25 @@ namespace storm {
             
             template <storm::dd::DdType DdType, typename ValueType>
             GameBddResult<DdType> AutomatonAbstractor<DdType, ValueType>::abstract() {
-                // First, we retrieve the abstractions of all commands.
+                // The SMT-based enumeration of the edges only involves their own solvers, so it is performed
+                // concurrently. Neither the DD manager nor the expression manager may be modified by several threads
+                // at once, so the workers must not use the DD manager or declare variables (which the SMT solvers
+                // also do when translating floor and ceil, for example). Therefore, the abstract guards are encoded
+                // on this thread in between and the solutions are translated to BDDs afterwards. Expressions built
+                // by the workers, e.g. cubes over the decision variables, only use the boolean type of the expression
+                // manager, which is created lazily, so we make sure it exists beforehand.
+                this->getAbstractionInformation().getExpressionManager().getBooleanType();
+                storm::utility::parallel::getThreadPool().execute(edges.size(), [this] (uint_fast64_t index) {
+                    edges[index].enumerateGuard();
+                });
+                for (auto& edge : edges) {
+                    edge.prepareEnumeration();
+                }
+                storm::utility::parallel::getThreadPool().execute(edges.size(), [this] (uint_fast64_t index) {
+                    edges[index].enumerate();
+                });
+                
+                // Then, we retrieve the abstractions of all edges.
                 std::vector<GameBddResult<DdType>> edgeDdsAndUsedOptionVariableCounts;
                 uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
                 for (auto& edge : edges) {
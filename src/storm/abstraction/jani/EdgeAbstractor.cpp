@@ -16,6 +16,8 @@
 #include "storm/utility/solver.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/InvalidStateException.h"
+
 #include "storm-config.h"
 #include "storm/adapters/CarlAdapter.h"
 
@@ -23,7 +25,7 @@ namespace storm {
     namespace abstraction {
         namespace jani {
             template <storm::dd::DdType DdType, typename ValueType>
-            EdgeAbstractor<DdType, ValueType>::EdgeAbstractor(uint64_t edgeId, storm::jani::Edge const& edge, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition) : smtSolver(smtSolverFactory->create(abstractionInformation.getExpressionManager())), abstractionInformation(abstractionInformation), edgeId(edgeId), edge(edge), localExpressionInformation(abstractionInformation), evaluator(abstractionInformation.getExpressionManager()), relevantPredicatesAndVariables(), cachedDd(abstractionInformation.getDdManager().getBddZero(), 0), decisionVariables(), useDecomposition(useDecomposition), skipBottomStates(false), forceRecomputation(true), abstractGuard(abstractionInformation.getDdManager().getBddZero()), bottomStateAbstractor(abstractionInformation, {!edge.getGuard()}, smtSolverFactory) {
+            EdgeAbstractor<DdType, ValueType>::EdgeAbstractor(uint64_t edgeId, storm::jani::Edge const& edge, AbstractionInformation<DdType>& abstractionInformation, std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition) : smtSolver(smtSolverFactory->create(abstractionInformation.getExpressionManager())), abstractionInformation(abstractionInformation), edgeId(edgeId), edge(edge), localExpressionInformation(abstractionInformation), evaluator(abstractionInformation.getExpressionManager()), relevantPredicatesAndVariables(), cachedDd(abstractionInformation.getDdManager().getBddZero(), 0), enumeration(), useDecomposition(useDecomposition), skipBottomStates(false), forceRecomputation(true), abstractGuard(abstractionInformation.getDdManager().getBddZero()), bottomStateAbstractor(abstractionInformation, {!edge.getGuard()}, smtSolverFactory) {
                 
                 // Make the second component of relevant predicates have the right size.
                 relevantPredicatesAndVariables.second.resize(edge.getNumberOfDestinations());
@@ -53,6 +55,9 @@ namespace storm {
                 bool relevantPredicatesChanged = this->relevantPredicatesChanged(newRelevantPredicates);
                 if (relevantPredicatesChanged) {
                     addMissingPredicates(newRelevantPredicates);
+                    
+                    // Solutions that were enumerated for the previous predicates are outdated now.
+                    enumeration = boost::none;
                 }
                 forceRecomputation |= relevantPredicatesChanged;
                 
@@ -71,19 +76,153 @@ namespace storm {
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
-            void EdgeAbstractor<DdType, ValueType>::recomputeCachedBdd() {
+            void EdgeAbstractor<DdType, ValueType>::enumerateGuard() {
+                // If the abstraction is up-to-date or the enumeration was already started, there is nothing to do.
+                if (!forceRecomputation || enumeration) {
+                    return;
+                }
+                
+                Enumeration newEnumeration;
+                newEnumeration.usesDecomposition = false;
+                newEnumeration.complete = false;
                 if (useDecomposition) {
-                    recomputeCachedBddWithDecomposition();
+                    newEnumeration.relevantBlockPartition = computeRelevantBlockPartition();
+                    
+                    // if the decomposition has size 1, use the plain technique
+                    newEnumeration.usesDecomposition = newEnumeration.relevantBlockPartition.size() != 1;
+                }
+                
+                if (newEnumeration.usesDecomposition) {
+                    std::set<storm::expressions::Variable> variablesContainedInGuard = edge.get().getGuard().getVariables();
+                    
+                    // Check whether we need to enumerate the guard. This is the case if the blocks related by the guard
+                    // are not contained within a single block of our decomposition.
+                    bool enumerateAbstractGuard = true;
+                    std::set<uint64_t> guardBlocks = localExpressionInformation.getBlockIndicesOfVariables(variablesContainedInGuard);
+                    for (auto const& block : newEnumeration.relevantBlockPartition) {
+                        bool allContained = true;
+                        for (auto const& guardBlock : guardBlocks) {
+                            if (block.find(guardBlock) == block.end()) {
+                                allContained = false;
+                                break;
+                            }
+                        }
+                        if (allContained) {
+                            enumerateAbstractGuard = false;
+                        }
+                    }
+                    
+                    if (enumerateAbstractGuard) {
+                        // otherwise, enumerate the abstract guard so we do this only once
+                        std::set<uint64_t> relatedGuardPredicates = localExpressionInformation.getRelatedExpressions(variablesContainedInGuard);
+                        std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> guardVariablesAndPredicates;
+                        for (auto const& element : relevantPredicatesAndVariables.first) {
+                            if (relatedGuardPredicates.find(element.second) != relatedGuardPredicates.end()) {
+                                guardVariablesAndPredicates.push_back(element);
+                            }
+                        }
+                        newEnumeration.guard = enumerateSolutions(guardVariablesAndPredicates, {});
+                        STORM_LOG_TRACE("Enumerated " << newEnumeration.guard.get().solutions.size() << " for abstract guard.");
+                    }
+                }
+                
+                enumeration = std::move(newEnumeration);
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void EdgeAbstractor<DdType, ValueType>::prepareEnumeration() {
+                enumerateGuard();
+                
+                // If there is no abstract guard to encode (or it was already encoded), there is nothing to do.
+                if (!enumeration || enumeration.get().complete || !enumeration.get().guard || !enumeration.get().guardConstraints.empty()) {
+                    return;
+                }
+                
+                Enumeration& currentEnumeration = enumeration.get();
+                EnumeratedSolutions const& guardSolutions = currentEnumeration.guard.get();
+                abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
+                for (auto const& solution : guardSolutions.solutions) {
+                    abstractGuard |= getSourceStateBdd(guardSolutions, solution);
+                }
+                
+                // Encode the abstract guard with one fresh variable per BDD node (in the style of Tseitin), so the size
+                // of the constraints is linear in the size of the BDD rather than in the number of solutions.
+                std::pair<std::vector<storm::expressions::Expression>, std::unordered_map<uint_fast64_t, storm::expressions::Variable>> result = abstractGuard.toExpression(this->getAbstractionInformation().getExpressionManager());
+                currentEnumeration.guardConstraints = std::move(result.first);
+                
+                // Then associate the level variables with the decision variables of the corresponding predicates. We
+                // deliberately do not use the predicates themselves: as the constraints only range over boolean
+                // variables, translating them for the SMT solver never declares auxiliary variables (as is done for
+                // floor and ceil, for example), which would modify the expression manager during the concurrent
+                // enumeration.
+                std::map<uint_fast64_t, storm::expressions::Variable> predicateToDecisionVariable;
+                for (auto const& element : guardSolutions.sourceVariablesAndPredicates) {
+                    predicateToDecisionVariable.emplace(element.second, element.first);
+                }
+                for (auto const& indexVariablePair : result.second) {
+                    auto decisionVariableIt = predicateToDecisionVariable.find(this->getAbstractionInformation().getPredicateIndexForDdVariableIndex(indexVariablePair.first));
+                    STORM_LOG_ASSERT(decisionVariableIt != predicateToDecisionVariable.end(), "Abstract guard refers to a predicate that was not enumerated.");
+                    currentEnumeration.guardConstraints.push_back(storm::expressions::iff(indexVariablePair.second, decisionVariableIt->second));
+                }
+                
+#ifndef NDEBUG
+                for (auto const& constraint : currentEnumeration.guardConstraints) {
+                    for (auto const& variable : constraint.getVariables()) {
+                        STORM_LOG_ASSERT(variable.hasBooleanType(), "Expected the constraints for the abstract guard to only range over boolean variables.");
+                    }
+                }
+#endif
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void EdgeAbstractor<DdType, ValueType>::enumerate() {
+                enumerateGuard();
+                
+                // If the abstraction is up-to-date or the solutions were already enumerated, there is nothing to do.
+                if (!enumeration || enumeration.get().complete) {
+                    return;
+                }
+                
+                Enumeration& currentEnumeration = enumeration.get();
+                if (currentEnumeration.usesDecomposition) {
+                    enumerateWithDecomposition(currentEnumeration);
                 } else {
-                    recomputeCachedBddWithoutDecomposition();
+                    currentEnumeration.blocks.push_back(enumerateSolutions(relevantPredicatesAndVariables.first, relevantPredicatesAndVariables.second));
                 }
+                currentEnumeration.complete = true;
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
-            void EdgeAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
-                STORM_LOG_TRACE("Recomputing BDD for edge with id " << edgeId << " and guard " << edge.get().getGuard() << " using the decomposition.");
-                auto start = std::chrono::high_resolution_clock::now();
+            typename EdgeAbstractor<DdType, ValueType>::EnumeratedSolutions EdgeAbstractor<DdType, ValueType>::enumerateSolutions(std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& sourceVariablesAndPredicates, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& successorVariablesAndPredicates) {
+                EnumeratedSolutions result;
+                result.sourceVariablesAndPredicates = sourceVariablesAndPredicates;
+                result.successorVariablesAndPredicates = successorVariablesAndPredicates;
+                
+                // Gather the decision variables in the order in which their values are stored in the solutions.
+                std::vector<storm::expressions::Variable> decisionVariables;
+                for (auto const& element : sourceVariablesAndPredicates) {
+                    decisionVariables.push_back(element.first);
+                }
+                for (auto const& updateVariablesAndPredicates : successorVariablesAndPredicates) {
+                    for (auto const& element : updateVariablesAndPredicates) {
+                        decisionVariables.push_back(element.first);
+                    }
+                }
+                
+                smtSolver->allSat(decisionVariables, [&result,&decisionVariables] (storm::solver::SmtSolver::ModelReference const& model) {
+                    storm::storage::BitVector solution(decisionVariables.size());
+                    for (uint64_t position = 0; position < decisionVariables.size(); ++position) {
+                        solution.set(position, model.getBooleanValue(decisionVariables[position]));
+                    }
+                    result.solutions.push_back(std::move(solution));
+                    return true;
+                });
                 
+                return result;
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            std::vector<std::set<uint64_t>> EdgeAbstractor<DdType, ValueType>::computeRelevantBlockPartition() const {
                 // compute a decomposition of the command
                 //  * start with all relevant blocks: blocks of assignment variables and variables in the rhs of assignments
                 //  * go through all assignments of all updates and merge relevant blocks that are related via an assignment
@@ -92,7 +231,6 @@ namespace storm {
                 
                 // Start by constructing the relevant blocks.
                 std::set<uint64_t> allRelevantBlocks;
-                std::map<storm::expressions::Variable, uint64_t> variableToBlockIndex;
                 for (auto const& destination : edge.get().getDestinations()) {
                     for (auto const& assignment : destination.getOrderedAssignments().getAllAssignments()) {
                         allRelevantBlocks.insert(localExpressionInformation.getBlockIndexOfVariable(assignment.getExpressionVariable()));
@@ -101,7 +239,6 @@ namespace storm {
                         allRelevantBlocks.insert(rhsVariableBlocks.begin(), rhsVariableBlocks.end());
                     }
                 }
-                STORM_LOG_TRACE("Found " << allRelevantBlocks.size() << " relevant block(s).");
                 
                 // Create a block partition.
                 std::vector<std::set<uint64_t>> relevantBlockPartition;
@@ -176,195 +313,169 @@ namespace storm {
                         cleanedRelevantBlockPartition.emplace_back(std::move(element));
                     }
                 }
-                relevantBlockPartition = std::move(cleanedRelevantBlockPartition);
+                return cleanedRelevantBlockPartition;
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void EdgeAbstractor<DdType, ValueType>::enumerateWithDecomposition(Enumeration& currentEnumeration) {
+                STORM_LOG_THROW(!currentEnumeration.guard || !currentEnumeration.guardConstraints.empty(), storm::exceptions::InvalidStateException, "The abstract guard must be encoded before enumerating the blocks.");
+                
+                // If the abstract guard was enumerated, we can add it as an assertion to the solver before enumerating
+                // the other solutions. The backtracking point is removed when leaving this method, even if the
+                // enumeration throws.
+                std::unique_ptr<storm::solver::SmtSolver::ScopedBacktrackingPoint> backtrackingPoint;
+                if (currentEnumeration.guard) {
+                    backtrackingPoint = std::make_unique<storm::solver::SmtSolver::ScopedBacktrackingPoint>(*smtSolver);
+                    for (auto const& constraint : currentEnumeration.guardConstraints) {
+                        smtSolver->add(constraint);
+                    }
+                }
                 
-                // if the decomposition has size 1, use the plain technique from before
-                if (relevantBlockPartition.size() == 1) {
-                    STORM_LOG_TRACE("Relevant block partition size is one, falling back to regular computation.");
-                    recomputeCachedBddWithoutDecomposition();
-                } else {
-                    std::set<storm::expressions::Variable> variablesContainedInGuard = edge.get().getGuard().getVariables();
-                    
-                    // Check whether we need to enumerate the guard. This is the case if the blocks related by the guard
-                    // are not contained within a single block of our decomposition.
-                    bool enumerateAbstractGuard = true;
-                    std::set<uint64_t> guardBlocks = localExpressionInformation.getBlockIndicesOfVariables(variablesContainedInGuard);
-                    for (auto const& block : relevantBlockPartition) {
-                        bool allContained = true;
-                        for (auto const& guardBlock : guardBlocks) {
-                            if (block.find(guardBlock) == block.end()) {
-                                allContained = false;
-                                break;
-                            }
-                        }
-                        if (allContained) {
-                            enumerateAbstractGuard = false;
-                        }
+                // then enumerate the solutions for each of the blocks of the decomposition
+                for (auto const& block : currentEnumeration.relevantBlockPartition) {
+                    std::set<uint64_t> relevantPredicates;
+                    for (auto const& innerBlock : block) {
+                        relevantPredicates.insert(localExpressionInformation.getExpressionBlock(innerBlock).begin(), localExpressionInformation.getExpressionBlock(innerBlock).end());
                     }
                     
-                    uint64_t numberOfSolutions = 0;
-                    
-                    if (enumerateAbstractGuard) {
-                        // otherwise, enumerate the abstract guard so we do this only once
-                        std::set<uint64_t> relatedGuardPredicates = localExpressionInformation.getRelatedExpressions(variablesContainedInGuard);
-                        std::vector<storm::expressions::Variable> guardDecisionVariables;
-                        std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> guardVariablesAndPredicates;
-                        for (auto const& element : relevantPredicatesAndVariables.first) {
-                            if (relatedGuardPredicates.find(element.second) != relatedGuardPredicates.end()) {
-                                guardDecisionVariables.push_back(element.first);
-                                guardVariablesAndPredicates.push_back(element);
-                            }
-                        }
-                        abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
-                        smtSolver->allSat(guardDecisionVariables, [this,&guardVariablesAndPredicates,&numberOfSolutions] (storm::solver::SmtSolver::ModelReference const& model) {
-                            abstractGuard |= getSourceStateBdd(model, guardVariablesAndPredicates);
-                            ++numberOfSolutions;
-                            return true;
-                        });
-                        STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " for abstract guard.");
-                        
-                        // now that we have the abstract guard, we can add it as an assertion to the solver before enumerating
-                        // the other solutions.
-                        
-                        // Create a new backtracking point before adding the guard.
-                        smtSolver->push();
-                        
-                        // Create the guard constraint.
-                        std::pair<std::vector<storm::expressions::Expression>, std::unordered_map<uint_fast64_t, storm::expressions::Variable>> result = abstractGuard.toExpression(this->getAbstractionInformation().getExpressionManager());
-                        
-                        // Then add it to the solver.
-                        for (auto const& expression : result.first) {
-                            smtSolver->add(expression);
-                        }
-                        
-                        // Finally associate the level variables with the predicates.
-                        for (auto const& indexVariablePair : result.second) {
-                            smtSolver->add(storm::expressions::iff(indexVariablePair.second, this->getAbstractionInformation().getPredicateForDdVariableIndex(indexVariablePair.first)));
+                    std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> sourceVariablesAndPredicates;
+                    for (auto const& element : relevantPredicatesAndVariables.first) {
+                        if (relevantPredicates.find(element.second) != relevantPredicates.end()) {
+                            sourceVariablesAndPredicates.push_back(element);
                         }
                     }
                     
-                    // then enumerate the solutions for each of the blocks of the decomposition
-                    uint64_t usedNondeterminismVariables = 0;
-                    uint64_t blockCounter = 0;
-                    std::vector<storm::dd::Bdd<DdType>> blockBdds;
-                    for (auto const& block : relevantBlockPartition) {
-                        std::set<uint64_t> relevantPredicates;
-                        for (auto const& innerBlock : block) {
-                            relevantPredicates.insert(localExpressionInformation.getExpressionBlock(innerBlock).begin(), localExpressionInformation.getExpressionBlock(innerBlock).end());
-                        }
-                        
-                        std::vector<storm::expressions::Variable> transitionDecisionVariables;
-                        std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> sourceVariablesAndPredicates;
-                        for (auto const& element : relevantPredicatesAndVariables.first) {
-                            if (relevantPredicates.find(element.second) != relevantPredicates.end()) {
-                                transitionDecisionVariables.push_back(element.first);
-                                sourceVariablesAndPredicates.push_back(element);
-                            }
-                        }
-                        
-                        std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> destinationVariablesAndPredicates;
-                        for (uint64_t destinationIndex = 0; destinationIndex < edge.get().getNumberOfDestinations(); ++destinationIndex) {
-                            destinationVariablesAndPredicates.emplace_back();
-                            for (auto const& assignment : edge.get().getDestination(destinationIndex).getOrderedAssignments().getAllAssignments()) {
-                                uint64_t assignmentVariableBlockIndex = localExpressionInformation.getBlockIndexOfVariable(assignment.getExpressionVariable());
-                                std::set<uint64_t> const& assignmentVariableBlock = localExpressionInformation.getExpressionBlock(assignmentVariableBlockIndex);
-                                if (block.find(assignmentVariableBlockIndex) != block.end()) {
-                                    for (auto const& element : relevantPredicatesAndVariables.second[destinationIndex]) {
-                                        if (assignmentVariableBlock.find(element.second) != assignmentVariableBlock.end()) {
-                                            destinationVariablesAndPredicates.back().push_back(element);
-                                            transitionDecisionVariables.push_back(element.first);
-                                        }
+                    std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> destinationVariablesAndPredicates;
+                    for (uint64_t destinationIndex = 0; destinationIndex < edge.get().getNumberOfDestinations(); ++destinationIndex) {
+                        destinationVariablesAndPredicates.emplace_back();
+                        for (auto const& assignment : edge.get().getDestination(destinationIndex).getOrderedAssignments().getAllAssignments()) {
+                            uint64_t assignmentVariableBlockIndex = localExpressionInformation.getBlockIndexOfVariable(assignment.getExpressionVariable());
+                            std::set<uint64_t> const& assignmentVariableBlock = localExpressionInformation.getExpressionBlock(assignmentVariableBlockIndex);
+                            if (block.find(assignmentVariableBlockIndex) != block.end()) {
+                                for (auto const& element : relevantPredicatesAndVariables.second[destinationIndex]) {
+                                    if (assignmentVariableBlock.find(element.second) != assignmentVariableBlock.end()) {
+                                        destinationVariablesAndPredicates.back().push_back(element);
                                     }
                                 }
                             }
                         }
-                        
-                        std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-                        numberOfSolutions = 0;
-                        smtSolver->allSat(transitionDecisionVariables, [&sourceToDistributionsMap,this,&numberOfSolutions,&sourceVariablesAndPredicates,&destinationVariablesAndPredicates] (storm::solver::SmtSolver::ModelReference const& model) {
-                            sourceToDistributionsMap[getSourceStateBdd(model, sourceVariablesAndPredicates)].push_back(getDistributionBdd(model, destinationVariablesAndPredicates));
-                            ++numberOfSolutions;
-                            return true;
-                        });
-                        STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for block " << blockCounter << ".");
-                        numberOfSolutions = 0;
-                        
-                        // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
-                        // need to encode the nondeterminism.
-                        uint_fast64_t maximalNumberOfChoices = 0;
-                        for (auto const& sourceDistributionsPair : sourceToDistributionsMap) {
-                            maximalNumberOfChoices = std::max(maximalNumberOfChoices, static_cast<uint_fast64_t>(sourceDistributionsPair.second.size()));
-                        }
-                        
-                        // We now compute how many variables we need to encode the choices. We add one to the maximal number of
-                        // choices to account for a possible transition to a bottom state.
-                        uint_fast64_t numberOfVariablesNeeded = static_cast<uint_fast64_t>(std::ceil(std::log2(maximalNumberOfChoices + 1)));
-                        
-                        // Finally, build overall result.
-                        storm::dd::Bdd<DdType> resultBdd = this->getAbstractionInformation().getDdManager().getBddZero();
-                        
-                        uint_fast64_t sourceStateIndex = 0;
-                        for (auto const& sourceDistributionsPair : sourceToDistributionsMap) {
-                            STORM_LOG_ASSERT(!sourceDistributionsPair.first.isZero(), "The source BDD must not be empty.");
-                            STORM_LOG_ASSERT(!sourceDistributionsPair.second.empty(), "The distributions must not be empty.");
-                            // We start with the distribution index of 1, becase 0 is reserved for a potential bottom choice.
-                            uint_fast64_t distributionIndex = 1;
-                            storm::dd::Bdd<DdType> allDistributions = this->getAbstractionInformation().getDdManager().getBddZero();
-                            for (auto const& distribution : sourceDistributionsPair.second) {
-                                allDistributions |= distribution && this->getAbstractionInformation().encodePlayer2Choice(distributionIndex, usedNondeterminismVariables, usedNondeterminismVariables + numberOfVariablesNeeded);
-                                ++distributionIndex;
-                                STORM_LOG_ASSERT(!allDistributions.isZero(), "The BDD must not be empty.");
-                            }
-                            resultBdd |= sourceDistributionsPair.first && allDistributions;
-                            ++sourceStateIndex;
-                            STORM_LOG_ASSERT(!resultBdd.isZero(), "The BDD must not be empty.");
-                        }
-                        usedNondeterminismVariables += numberOfVariablesNeeded;
-                        
-                        blockBdds.push_back(resultBdd);
-                        ++blockCounter;
                     }
                     
-                    if (enumerateAbstractGuard) {
-                        smtSolver->pop();
+                    currentEnumeration.blocks.push_back(enumerateSolutions(sourceVariablesAndPredicates, destinationVariablesAndPredicates));
+                }
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void EdgeAbstractor<DdType, ValueType>::recomputeCachedBdd() {
+                // Make sure the solutions for the current predicates are available.
+                prepareEnumeration();
+                enumerate();
+                
+                if (enumeration.get().usesDecomposition) {
+                    recomputeCachedBddWithDecomposition();
+                } else {
+                    recomputeCachedBddWithoutDecomposition();
+                }
+                
+                // The solutions are not needed anymore once they were translated.
+                enumeration = boost::none;
+                forceRecomputation = false;
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void EdgeAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
+                STORM_LOG_TRACE("Recomputing BDD for edge with id " << edgeId << " and guard " << edge.get().getGuard() << " using the decomposition.");
+                auto start = std::chrono::high_resolution_clock::now();
+                
+                Enumeration const& currentEnumeration = enumeration.get();
+                STORM_LOG_TRACE("Found " << currentEnumeration.blocks.size() << " relevant block(s).");
+                
+                uint64_t numberOfSolutions = 0;
+                if (currentEnumeration.guard) {
+                    // The abstract guard was already translated when preparing the enumeration.
+                    numberOfSolutions += currentEnumeration.guard.get().solutions.size();
+                }
+                
+                // then translate the solutions for each of the blocks of the decomposition
+                uint64_t usedNondeterminismVariables = 0;
+                uint64_t blockCounter = 0;
+                std::vector<storm::dd::Bdd<DdType>> blockBdds;
+                for (auto const& block : currentEnumeration.blocks) {
+                    std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
+                    for (auto const& solution : block.solutions) {
+                        sourceToDistributionsMap[getSourceStateBdd(block, solution)].push_back(getDistributionBdd(block, solution));
                     }
+                    numberOfSolutions += block.solutions.size();
+                    STORM_LOG_TRACE("Enumerated " << block.solutions.size() << " solutions for block " << blockCounter << ".");
                     
-                    // multiply the results
-                    storm::dd::Bdd<DdType> resultBdd = getAbstractionInformation().getDdManager().getBddOne();
-                    for (auto const& blockBdd : blockBdds) {
-                        resultBdd &= blockBdd;
+                    // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
+                    // need to encode the nondeterminism.
+                    uint_fast64_t maximalNumberOfChoices = 0;
+                    for (auto const& sourceDistributionsPair : sourceToDistributionsMap) {
+                        maximalNumberOfChoices = std::max(maximalNumberOfChoices, static_cast<uint_fast64_t>(sourceDistributionsPair.second.size()));
                     }
                     
-                    // if we did not explicitly enumerate the guard, we can construct it from the result BDD.
-                    if (!enumerateAbstractGuard) {
-                        std::set<storm::expressions::Variable> allVariables(this->getAbstractionInformation().getSuccessorVariables());
-                        auto player2Variables = this->getAbstractionInformation().getPlayer2VariableSet(usedNondeterminismVariables);
-                        allVariables.insert(player2Variables.begin(), player2Variables.end());
-                        auto auxVariables = this->getAbstractionInformation().getAuxVariableSet(0, this->getAbstractionInformation().getAuxVariableCount());
-                        allVariables.insert(auxVariables.begin(), auxVariables.end());
-                        
-                        std::set<storm::expressions::Variable> variablesToAbstract;
-                        std::set_intersection(allVariables.begin(), allVariables.end(), resultBdd.getContainedMetaVariables().begin(), resultBdd.getContainedMetaVariables().end(), std::inserter(variablesToAbstract, variablesToAbstract.begin()));
-                        
-                        abstractGuard = resultBdd.existsAbstract(variablesToAbstract);
-                    } else {
-                        // Multiply the abstract guard as it can contain predicates that are not mentioned in the blocks.
-                        resultBdd &= abstractGuard;
-                    }
+                    // We now compute how many variables we need to encode the choices. We add one to the maximal number of
+                    // choices to account for a possible transition to a bottom state.
+                    uint_fast64_t numberOfVariablesNeeded = static_cast<uint_fast64_t>(std::ceil(std::log2(maximalNumberOfChoices + 1)));
                     
-                    // multiply with missing identities
-                    resultBdd &= computeMissingIdentities();
+                    // Finally, build overall result.
+                    storm::dd::Bdd<DdType> resultBdd = this->getAbstractionInformation().getDdManager().getBddZero();
+                    
+                    for (auto const& sourceDistributionsPair : sourceToDistributionsMap) {
+                        STORM_LOG_ASSERT(!sourceDistributionsPair.first.isZero(), "The source BDD must not be empty.");
+                        STORM_LOG_ASSERT(!sourceDistributionsPair.second.empty(), "The distributions must not be empty.");
+                        // We start with the distribution index of 1, becase 0 is reserved for a potential bottom choice.
+                        uint_fast64_t distributionIndex = 1;
+                        storm::dd::Bdd<DdType> allDistributions = this->getAbstractionInformation().getDdManager().getBddZero();
+                        for (auto const& distribution : sourceDistributionsPair.second) {
+                            allDistributions |= distribution && this->getAbstractionInformation().encodePlayer2Choice(distributionIndex, usedNondeterminismVariables, usedNondeterminismVariables + numberOfVariablesNeeded);
+                            ++distributionIndex;
+                            STORM_LOG_ASSERT(!allDistributions.isZero(), "The BDD must not be empty.");
+                        }
+                        resultBdd |= sourceDistributionsPair.first && allDistributions;
+                        STORM_LOG_ASSERT(!resultBdd.isZero(), "The BDD must not be empty.");
+                    }
+                    usedNondeterminismVariables += numberOfVariablesNeeded;
                     
-                    // cache and return result
-                    resultBdd &= this->getAbstractionInformation().encodePlayer1Choice(edgeId, this->getAbstractionInformation().getPlayer1VariableCount());
+                    blockBdds.push_back(resultBdd);
+                    ++blockCounter;
+                }
+                
+                // multiply the results
+                storm::dd::Bdd<DdType> resultBdd = getAbstractionInformation().getDdManager().getBddOne();
+                for (auto const& blockBdd : blockBdds) {
+                    resultBdd &= blockBdd;
+                }
+                
+                // if we did not explicitly enumerate the guard, we can construct it from the result BDD.
+                if (!currentEnumeration.guard) {
+                    std::set<storm::expressions::Variable> allVariables(this->getAbstractionInformation().getSuccessorVariables());
+                    auto player2Variables = this->getAbstractionInformation().getPlayer2VariableSet(usedNondeterminismVariables);
+                    allVariables.insert(player2Variables.begin(), player2Variables.end());
+                    auto auxVariables = this->getAbstractionInformation().getAuxVariableSet(0, this->getAbstractionInformation().getAuxVariableCount());
+                    allVariables.insert(auxVariables.begin(), auxVariables.end());
                     
-                    // Cache the result.
-                    cachedDd = GameBddResult<DdType>(resultBdd, usedNondeterminismVariables);
+                    std::set<storm::expressions::Variable> variablesToAbstract;
+                    std::set_intersection(allVariables.begin(), allVariables.end(), resultBdd.getContainedMetaVariables().begin(), resultBdd.getContainedMetaVariables().end(), std::inserter(variablesToAbstract, variablesToAbstract.begin()));
                     
-                    auto end = std::chrono::high_resolution_clock::now();
-                    STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
-                    forceRecomputation = false;
+                    abstractGuard = resultBdd.existsAbstract(variablesToAbstract);
+                } else {
+                    // Multiply the abstract guard as it can contain predicates that are not mentioned in the blocks.
+                    resultBdd &= abstractGuard;
                 }
+                
+                // multiply with missing identities
+                resultBdd &= computeMissingIdentities();
+                
+                // cache and return result
+                resultBdd &= this->getAbstractionInformation().encodePlayer1Choice(edgeId, this->getAbstractionInformation().getPlayer1VariableCount());
+                
+                // Cache the result.
+                cachedDd = GameBddResult<DdType>(resultBdd, usedNondeterminismVariables);
+                
+                auto end = std::chrono::high_resolution_clock::now();
+                STORM_LOG_TRACE("Translated " << numberOfSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
@@ -373,13 +484,11 @@ namespace storm {
                 auto start = std::chrono::high_resolution_clock::now();
                 
                 // Create a mapping from source state DDs to their distributions.
+                EnumeratedSolutions const& enumeratedSolutions = enumeration.get().blocks.front();
                 std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-                uint64_t numberOfSolutions = 0;
-                smtSolver->allSat(decisionVariables, [&sourceToDistributionsMap,this,&numberOfSolutions] (storm::solver::SmtSolver::ModelReference const& model) {
-                    sourceToDistributionsMap[getSourceStateBdd(model, relevantPredicatesAndVariables.first)].push_back(getDistributionBdd(model, relevantPredicatesAndVariables.second));
-                    ++numberOfSolutions;
-                    return true;
-                });
+                for (auto const& solution : enumeratedSolutions.solutions) {
+                    sourceToDistributionsMap[getSourceStateBdd(enumeratedSolutions, solution)].push_back(getDistributionBdd(enumeratedSolutions, solution));
+                }
                 
                 // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
                 // need to encode the nondeterminism.
@@ -426,8 +535,7 @@ namespace storm {
                 cachedDd = GameBddResult<DdType>(resultBdd, numberOfVariablesNeeded);
                 auto end = std::chrono::high_resolution_clock::now();
                 
-                STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
-                forceRecomputation = false;
+                STORM_LOG_TRACE("Translated " << enumeratedSolutions.solutions.size() << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
@@ -494,7 +602,6 @@ namespace storm {
                 for (auto const& element : newSourceVariables) {
                     allRelevantPredicates.insert(element.second);
                     smtSolver->add(storm::expressions::iff(element.first, this->getAbstractionInformation().getPredicateByIndex(element.second)));
-                    decisionVariables.push_back(element.first);
                 }
                 
                 // Insert the new variables into the record of relevant source variables.
@@ -507,7 +614,6 @@ namespace storm {
                     for (auto const& element : newSuccessorVariables) {
                         allRelevantPredicates.insert(element.second);
                         smtSolver->add(storm::expressions::iff(element.first, this->getAbstractionInformation().getPredicateByIndex(element.second).substitute(edge.get().getDestination(index).getAsVariableToExpressionMap())));
-                        decisionVariables.push_back(element.first);
                     }
                     
                     relevantPredicatesAndVariables.second[index].insert(relevantPredicatesAndVariables.second[index].end(), newSuccessorVariables.begin(), newSuccessorVariables.end());
@@ -516,14 +622,16 @@ namespace storm {
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
-            storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::getSourceStateBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const {
+            storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::getSourceStateBdd(EnumeratedSolutions const& enumeratedSolutions, storm::storage::BitVector const& solution) const {
                 storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddOne();
-                for (auto const& variableIndexPair : variablePredicates) {
-                    if (model.getBooleanValue(variableIndexPair.first)) {
+                uint64_t position = 0;
+                for (auto const& variableIndexPair : enumeratedSolutions.sourceVariablesAndPredicates) {
+                    if (solution.get(position)) {
                         result &= this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
                     } else {
                         result &= !this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
                     }
+                    ++position;
                 }
                 
                 STORM_LOG_ASSERT(!result.isZero(), "Source must not be empty.");
@@ -531,20 +639,23 @@ namespace storm {
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
-            storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::getDistributionBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const {
+            storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::getDistributionBdd(EnumeratedSolutions const& enumeratedSolutions, storm::storage::BitVector const& solution) const {
                 storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddZero();
                 
-                for (uint_fast64_t destinationIndex = 0; destinationIndex < edge.get().getNumberOfDestinations(); ++destinationIndex) {
+                // The values of the successor variables follow the ones of the source variables.
+                uint64_t position = enumeratedSolutions.sourceVariablesAndPredicates.size();
+                for (uint_fast64_t updateIndex = 0; updateIndex < edge.get().getNumberOfDestinations(); ++updateIndex) {
                     storm::dd::Bdd<DdType> updateBdd = this->getAbstractionInformation().getDdManager().getBddOne();
                     
                     // Translate block variables for this update into a successor block.
-                    for (auto const& variableIndexPair : variablePredicates[destinationIndex]) {
-                        if (model.getBooleanValue(variableIndexPair.first)) {
+                    for (auto const& variableIndexPair : enumeratedSolutions.successorVariablesAndPredicates[updateIndex]) {
+                        if (solution.get(position)) {
                             updateBdd &= this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
                         } else {
                             updateBdd &= !this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
                         }
-                        updateBdd &= this->getAbstractionInformation().encodeAux(destinationIndex, 0, this->getAbstractionInformation().getAuxVariableCount());
+                        updateBdd &= this->getAbstractionInformation().encodeAux(updateIndex, 0, this->getAbstractionInformation().getAuxVariableCount());
+                        ++position;
                     }
                     
                     result |= updateBdd;
@@ -5,6 +5,8 @@
 #include <set>
 #include <map>
 
+#include <boost/optional.hpp>
+
 #include "storm/abstraction/LocalExpressionInformation.h"
 #include "storm/abstraction/StateSetAbstractor.h"
 #include "storm/abstraction/GameBddResult.h"
@@ -16,6 +18,8 @@
 
 #include "storm/solver/SmtSolver.h"
 
+#include "storm/storage/BitVector.h"
+
 namespace storm {
     namespace utility {
         namespace solver {
@@ -86,6 +90,31 @@ namespace storm {
                  */
                 GameBddResult<DdType> abstract();
                 
+                /*!
+                 * Starts the enumeration of the solutions needed to recompute the abstraction of the edge wrt. to
+                 * the current set of predicates. If the decomposition requires the abstract guard to be enumerated
+                 * separately, this enumerates its solutions. Since this only involves the SMT solver of this edge
+                 * (and no DD operations), it may be called concurrently for different edges. If the abstraction
+                 * does not need to be recomputed, this does nothing.
+                 */
+                void enumerateGuard();
+                
+                /*!
+                 * Translates the solutions of the abstract guard (if any) to a BDD and encodes it as constraints that
+                 * restrict the remaining enumeration. As this uses the DD manager and declares variables in the
+                 * expression manager, it must not be called concurrently.
+                 */
+                void prepareEnumeration();
+                
+                /*!
+                 * Enumerates the (remaining) solutions needed to recompute the abstraction of the edge wrt. to the
+                 * current set of predicates without translating them to BDDs yet. Once the enumeration was prepared,
+                 * this only involves the SMT solver of this edge and adds constraints over boolean variables only,
+                 * so it may be called concurrently for different edges. If the abstraction does not need to be
+                 * recomputed, this does nothing.
+                 */
+                void enumerate();
+                
                 /*!
                  * Retrieves the transitions to bottom states of this edge.
                  *
@@ -112,6 +141,36 @@ namespace storm {
                 storm::jani::Edge const& getConcreteEdge() const;
                 
             private:
+                // The solutions of one AllSat call over the given source and successor variables. Each solution stores
+                // the values of the source variables followed by the values of the successor variables of all updates.
+                struct EnumeratedSolutions {
+                    std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> sourceVariablesAndPredicates;
+                    std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> successorVariablesAndPredicates;
+                    std::vector<storm::storage::BitVector> solutions;
+                };
+                
+                // The solutions enumerated for the current set of predicates.
+                struct Enumeration {
+                    // A flag indicating whether the solutions were obtained using the decomposition.
+                    bool usesDecomposition;
+                    
+                    // The blocks of the decomposition (if it is used).
+                    std::vector<std::set<uint64_t>> relevantBlockPartition;
+                    
+                    // If the abstract guard was enumerated separately, this holds its solutions.
+                    boost::optional<EnumeratedSolutions> guard;
+                    
+                    // If the abstract guard was enumerated separately, this holds the constraints encoding it. They only
+                    // range over boolean variables and are asserted while enumerating the blocks.
+                    std::vector<storm::expressions::Expression> guardConstraints;
+                    
+                    // The solutions for the blocks of the decomposition or a single element if no decomposition is used.
+                    std::vector<EnumeratedSolutions> blocks;
+                    
+                    // A flag indicating whether the solutions for the blocks were enumerated.
+                    bool complete;
+                };
+                
                 /*!
                  * Determines the relevant predicates for source as well as successor states wrt. to the given assignments
                  * (that, for example, form an update).
@@ -146,33 +205,60 @@ namespace storm {
                 void addMissingPredicates(std::pair<std::set<uint_fast64_t>, std::vector<std::set<uint_fast64_t>>> const& newRelevantPredicates);
                 
                 /*!
-                 * Translates the given model to a source state DD.
+                 * Translates the source part of the given solution to a source state DD.
                  *
-                 * @param model The model to translate.
+                 * @param enumeratedSolutions The enumerated solutions the solution belongs to.
+                 * @param solution The solution to translate.
                  * @return The source state encoded as a DD.
                  */
-                storm::dd::Bdd<DdType> getSourceStateBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const;
+                storm::dd::Bdd<DdType> getSourceStateBdd(EnumeratedSolutions const& enumeratedSolutions, storm::storage::BitVector const& solution) const;
 
                 /*!
-                 * Translates the given model to a distribution over successor states.
+                 * Translates the successor part of the given solution to a distribution over successor states.
                  *
-                 * @param model The model to translate.
-                 * @return The source state encoded as a DD.
+                 * @param enumeratedSolutions The enumerated solutions the solution belongs to.
+                 * @param solution The solution to translate.
+                 * @return The distribution encoded as a DD.
+                 */
+                storm::dd::Bdd<DdType> getDistributionBdd(EnumeratedSolutions const& enumeratedSolutions, storm::storage::BitVector const& solution) const;
+                
+                /*!
+                 * Enumerates all solutions over the given source and successor variables using the SMT solver.
+                 *
+                 * @param sourceVariablesAndPredicates The source variables (and their predicates) to enumerate.
+                 * @param successorVariablesAndPredicates The successor variables (and their predicates) of all updates.
+                 * @return The enumerated solutions.
+                 */
+                EnumeratedSolutions enumerateSolutions(std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& sourceVariablesAndPredicates, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& successorVariablesAndPredicates);
+                
+                /*!
+                 * Computes the decomposition of the edge into blocks of (indices of) variable blocks that are
+                 * related via the assignments of the edge.
+                 *
+                 * @return The blocks of the decomposition.
                  */
-                storm::dd::Bdd<DdType> getDistributionBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const;
+                std::vector<std::set<uint64_t>> computeRelevantBlockPartition() const;
+                
+                /*!
+                 * Enumerates the solutions for the blocks of the decomposition of the given enumeration. If the abstract
+                 * guard was enumerated separately, its constraints are asserted in the meantime.
+                 *
+                 * @param currentEnumeration The enumeration to which the solutions are added.
+                 */
+                void enumerateWithDecomposition(Enumeration& currentEnumeration);
                 
                 /*!
                  * Recomputes the cached BDD. This needs to be triggered if any relevant predicates change.
                  */
                 void recomputeCachedBdd();
-
+                
                 /*!
-                 * Recomputes the cached BDD without the decomposition\.
+                 * Recomputes the cached BDD from the enumerated solutions without using the decomposition.
                  */
                 void recomputeCachedBddWithoutDecomposition();
-
+                
                 /*!
-                 * Recomputes the cached BDD using the decomposition.
+                 * Recomputes the cached BDD from the enumerated solutions using the decomposition.
                  */
                 void recomputeCachedBddWithDecomposition();
 
@@ -241,8 +327,8 @@ namespace storm {
                 // predicates, this result may be reused.
                 GameBddResult<DdType> cachedDd;
                 
-                // All relevant decision variables over which to perform AllSat.
-                std::vector<storm::expressions::Variable> decisionVariables;
+                // The solutions that were enumerated but not yet translated to the cached BDD (if any).
+                boost::optional<Enumeration> enumeration;
                 
                 // A flag indicating whether to use the decomposition when abstracting.
                 bool useDecomposition;
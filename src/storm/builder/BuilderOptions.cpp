@@ -35,7 +35,7 @@ namespace storm {
             return boost::get<storm::expressions::Expression>(labelOrExpression);
         }
         
-        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), buildChoiceLabels(false), explorationChecks(false) {
+        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), buildChoiceLabels(false), explorationChecks(false), bytecodeEvaluation(true) {
             // Intentionally left empty.
         }
         
@@ -55,6 +55,7 @@ namespace storm {
             }
             
             explorationChecks = storm::settings::getModule<storm::settings::modules::IOSettings>().isExplorationChecksSet();
+            bytecodeEvaluation = !storm::settings::getModule<storm::settings::modules::IOSettings>().isExprtkEvaluationSet();
         }
         
         void BuilderOptions::preserveFormula(storm::logic::Formula const& formula) {
@@ -160,6 +161,15 @@ namespace storm {
             explorationChecks = newValue;
             return *this;
         }
+
+        bool BuilderOptions::isBytecodeEvaluationSet() const {
+            return bytecodeEvaluation;
+        }
+
+        BuilderOptions& BuilderOptions::setBytecodeEvaluation(bool newValue) {
+            bytecodeEvaluation = newValue;
+            return *this;
+        }
         
         BuilderOptions& BuilderOptions::addRewardModel(std::string const& rewardModelName) {
             STORM_LOG_THROW(!buildAllRewardModels, storm::exceptions::InvalidSettingsException, "Cannot add reward model, because all reward models are built anyway.");
@@ -92,6 +92,7 @@ namespace storm {
             bool isBuildAllRewardModelsSet() const;
             bool isBuildAllLabelsSet() const;
             bool isExplorationChecksSet() const;
+            bool isBytecodeEvaluationSet() const;
             
             BuilderOptions& setBuildAllRewardModels();
             BuilderOptions& addRewardModel(std::string const& rewardModelName);
@@ -102,6 +103,7 @@ namespace storm {
             BuilderOptions& addTerminalLabel(std::string const& label, bool value);
             BuilderOptions& setBuildChoiceLabels(bool newValue);
             BuilderOptions& setExplorationChecks(bool newValue);
+            BuilderOptions& setBytecodeEvaluation(bool newValue);
             
         private:
             /// A flag that indicates whether all reward models are to be built. In this case, the reward model names are
@@ -128,6 +130,10 @@ namespace storm {
             
             /// A flag that stores whether exploration checks are to be performed.
             bool explorationChecks;
+            
+            /// A flag that stores whether expressions over floating point values are to be evaluated by the bytecode
+            /// evaluator (rather than by exprtk).
+            bool bytecodeEvaluation;
         };
         
     }
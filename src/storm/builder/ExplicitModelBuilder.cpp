@@ -22,6 +22,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/WrongFormatException.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -29,14 +30,38 @@
 
 namespace storm {
     namespace builder {
-                        
+        
+        namespace {
+            // The minimal number of states each chunk of a breadth-first level needs to have when exploring in parallel.
+            static const uint_fast64_t MINIMAL_PARALLEL_CHUNK_SIZE = 64;
+            
+            // The result of expanding a consecutive range of the states of a breadth-first level.
+            template <typename ValueType, typename StateType>
+            struct ExplorationChunk {
+                ExplorationChunk(uint64_t bitsPerState) : behaviors(), newStates(), newStateToLocalIndex(bitsPerState), newStateIndices() {
+                    // Intentionally left empty.
+                }
+                
+                // The behaviors of the states of the chunk.
+                std::vector<storm::generator::StateBehavior<ValueType, StateType>> behaviors;
+                
+                // The states that were unknown when the level was expanded in the order of their discovery. Their
+                // position in this vector is the local index by which they are referred to in the behaviors.
+                std::vector<CompressedState> newStates;
+                storm::storage::BitVectorHashMap<StateType> newStateToLocalIndex;
+                
+                // The indices that were assigned to the new states when adding them to the state storage.
+                std::vector<StateType> newStateIndices;
+            };
+        }
+        
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ModelComponents::ModelComponents() : transitionMatrix(), stateLabeling(), rewardModels(), choiceLabeling() {
             // Intentionally left empty.
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::IOSettings>().getExplorationOrder()), buildStateValuations(false) {
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::IOSettings>().getExplorationOrder()), buildStateValuations(false), parallelExploration(storm::settings::getModule<storm::settings::modules::IOSettings>().isParallelExplorationSet()) {
             // Intentionally left empty.
         }
         
@@ -141,107 +166,40 @@ namespace storm {
             uint_fast64_t currentRowGroup = 0;
             uint_fast64_t currentRow = 0;
 
-            // Perform a search through the model.
-            while (!statesToExplore.empty()) {
-                // Get the first state in the queue.
-                CompressedState currentState = statesToExplore.front();
-                StateType currentIndex = stateStorage.stateToId.getValue(currentState);
-                statesToExplore.pop_front();
-                
-                // If the exploration order differs from breadth-first, we remember that this row group was actually
-                // filled with the transitions of a different state.
-                if (options.explorationOrder != ExplorationOrder::Bfs) {
-                    stateRemapping.get()[currentIndex] = currentRowGroup;
+            if (isParallelExplorationApplicable()) {
+                // Every chunk of a level is expanded by its own generator, so we create one per thread.
+                std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> generators = {generator};
+                while (generators.size() < storm::utility::parallel::getNumberOfThreads()) {
+                    generators.push_back(generator->clone());
                 }
                 
-                STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
-                
-                generator->load(currentState);
-                storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+                // Perform a level-wise breadth-first search through the model.
+                while (!statesToExplore.empty()) {
+                    std::vector<CompressedState> level(std::make_move_iterator(statesToExplore.begin()), std::make_move_iterator(statesToExplore.end()));
+                    statesToExplore.clear();
+                    exploreLevelInParallel(level, generators, transitionMatrixBuilder, rewardModelBuilders, choiceLabels, markovianStates, currentRow, currentRowGroup);
+                }
+            } else {
+                STORM_LOG_WARN_COND(!options.parallelExploration, "Parallel exploration is only available for breadth-first exploration of models with floating point values and more than one thread. Falling back to sequential exploration.");
                 
-                // If there is no behavior, we might have to introduce a self-loop.
-                if (behavior.empty()) {
-                    if (!storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                        // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                        if (behavior.wasExpanded()) {
-                            this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                        }
-                        
-                        if (generator->getOptions().isBuildChoiceLabelsSet()) {
-                            // Insert empty choice labeling for added self-loop transitions.
-                            choiceLabels.get().push_back(boost::container::flat_set<uint_fast64_t>());
-                        }
-                        
-                        if (markovianStates) {
-                            markovianStates.get().grow(currentRowGroup + 1, false);
-                            markovianStates.get().set(currentRowGroup);
-                        }
-                        
-                        if (!generator->isDeterministicModel()) {
-                            transitionMatrixBuilder.newRowGroup(currentRow);
-                        }
-                        
-                        transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-                        
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateRewards()) {
-                                rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                            }
-                            
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                            }
-                        }
-                        
-                        ++currentRow;
-                        ++currentRowGroup;
-                    } else {
-                        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
-                    }
-                } else {
-                    // Add the state rewards to the corresponding reward models.
-                    auto stateRewardIt = behavior.getStateRewards().begin();
-                    for (auto& rewardModelBuilder : rewardModelBuilders) {
-                        if (rewardModelBuilder.hasStateRewards()) {
-                            rewardModelBuilder.addStateReward(*stateRewardIt);
-                        }
-                        ++stateRewardIt;
-                    }
+                // Perform a search through the model.
+                while (!statesToExplore.empty()) {
+                    // Get the first state in the queue.
+                    CompressedState currentState = statesToExplore.front();
+                    StateType currentIndex = stateStorage.stateToId.getValue(currentState);
+                    statesToExplore.pop_front();
                     
-                    // If the model is nondeterministic, we need to open a row group.
-                    if (!generator->isDeterministicModel()) {
-                        transitionMatrixBuilder.newRowGroup(currentRow);
+                    // If the exploration order differs from breadth-first, we remember that this row group was actually
+                    // filled with the transitions of a different state.
+                    if (options.explorationOrder != ExplorationOrder::Bfs) {
+                        stateRemapping.get()[currentIndex] = currentRowGroup;
                     }
                     
-                    // Now add all choices.
-                    for (auto const& choice : behavior) {
-                        // Add command labels if requested.
-                        if (generator->getOptions().isBuildChoiceLabelsSet()) {
-                            choiceLabels.get().push_back(choice.getLabels());
-                        }
-                        
-                        // If we keep track of the Markovian choices, store whether the current one is Markovian.
-                        if (markovianStates && choice.isMarkovian()) {
-                            markovianStates.get().grow(currentRowGroup + 1, false);
-                            markovianStates.get().set(currentRowGroup);
-                        }
-                        
-                        // Add the probabilistic behavior to the matrix.
-                        for (auto const& stateProbabilityPair : choice) {
-                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                        }
-                        
-                        // Add the rewards to the reward models.
-                        auto choiceRewardIt = choice.getRewards().begin();
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                            }
-                            ++choiceRewardIt;
-                        }
-                        ++currentRow;
-                    }
-                    ++currentRowGroup;
+                    STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
+                    
+                    generator->load(currentState);
+                    storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+                    addStateBehavior(currentIndex, currentState, behavior, nullptr, 0, transitionMatrixBuilder, rewardModelBuilders, choiceLabels, markovianStates, currentRow, currentRowGroup);
                 }
             }
             
@@ -275,6 +233,173 @@ namespace storm {
             }
         }
         
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehavior(StateType currentIndex, CompressedState const& currentState, storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::vector<StateType> const* temporaryIndexMapping, StateType firstTemporaryIndex, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, boost::optional<std::vector<boost::container::flat_set<uint_fast64_t>>>& choiceLabels, boost::optional<storm::storage::BitVector>& markovianStates, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup) {
+            // If there is no behavior, we might have to introduce a self-loop.
+            if (behavior.empty()) {
+                if (!storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
+                    // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+                    if (behavior.wasExpanded()) {
+                        this->stateStorage.deadlockStateIndices.push_back(currentIndex);
+                    }
+                    
+                    if (generator->getOptions().isBuildChoiceLabelsSet()) {
+                        // Insert empty choice labeling for added self-loop transitions.
+                        choiceLabels.get().push_back(boost::container::flat_set<uint_fast64_t>());
+                    }
+                    
+                    if (markovianStates) {
+                        markovianStates.get().grow(currentRowGroup + 1, false);
+                        markovianStates.get().set(currentRowGroup);
+                    }
+                    
+                    if (!generator->isDeterministicModel()) {
+                        transitionMatrixBuilder.newRowGroup(currentRow);
+                    }
+                    
+                    transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
+                    
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateRewards()) {
+                            rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                        }
+                        
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                        }
+                    }
+                    
+                    ++currentRow;
+                    ++currentRowGroup;
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
+                }
+            } else {
+                // Add the state rewards to the corresponding reward models.
+                auto stateRewardIt = behavior.getStateRewards().begin();
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateRewards()) {
+                        rewardModelBuilder.addStateReward(*stateRewardIt);
+                    }
+                    ++stateRewardIt;
+                }
+                
+                // If the model is nondeterministic, we need to open a row group.
+                if (!generator->isDeterministicModel()) {
+                    transitionMatrixBuilder.newRowGroup(currentRow);
+                }
+                
+                // Now add all choices.
+                for (auto const& choice : behavior) {
+                    // Add command labels if requested.
+                    if (generator->getOptions().isBuildChoiceLabelsSet()) {
+                        choiceLabels.get().push_back(choice.getLabels());
+                    }
+                    
+                    // If we keep track of the Markovian choices, store whether the current one is Markovian.
+                    if (markovianStates && choice.isMarkovian()) {
+                        markovianStates.get().grow(currentRowGroup + 1, false);
+                        markovianStates.get().set(currentRowGroup);
+                    }
+                    
+                    // Add the probabilistic behavior to the matrix.
+                    for (auto const& stateProbabilityPair : choice) {
+                        StateType targetIndex = stateProbabilityPair.first;
+                        if (temporaryIndexMapping && targetIndex >= firstTemporaryIndex) {
+                            targetIndex = (*temporaryIndexMapping)[targetIndex - firstTemporaryIndex];
+                        }
+                        transitionMatrixBuilder.addNextValue(currentRow, targetIndex, stateProbabilityPair.second);
+                    }
+                    
+                    // Add the rewards to the reward models.
+                    auto choiceRewardIt = choice.getRewards().begin();
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                        }
+                        ++choiceRewardIt;
+                    }
+                    ++currentRow;
+                }
+                ++currentRowGroup;
+            }
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exploreLevelInParallel(std::vector<CompressedState> const& level, std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> const& generators, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, boost::optional<std::vector<boost::container::flat_set<uint_fast64_t>>>& choiceLabels, boost::optional<storm::storage::BitVector>& markovianStates, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup) {
+            // States that are unknown during the expansion are referred to by temporary indices that start after all
+            // known states.
+            StateType firstTemporaryIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
+            
+            // Split the level into consecutive chunks.
+            uint_fast64_t numberOfChunks = std::max<uint_fast64_t>(1, std::min<uint_fast64_t>(generators.size(), level.size() / MINIMAL_PARALLEL_CHUNK_SIZE));
+            std::vector<uint_fast64_t> chunkBoundaries(numberOfChunks + 1);
+            for (uint_fast64_t chunkIndex = 0; chunkIndex <= numberOfChunks; ++chunkIndex) {
+                chunkBoundaries[chunkIndex] = level.size() * chunkIndex / numberOfChunks;
+            }
+            std::vector<ExplorationChunk<ValueType, StateType>> chunks(numberOfChunks, ExplorationChunk<ValueType, StateType>(stateStorage.bitsPerState));
+            
+            std::function<void (uint_fast64_t)> expandChunk = [&] (uint_fast64_t chunkIndex) {
+                ExplorationChunk<ValueType, StateType>& chunk = chunks[chunkIndex];
+                storm::generator::NextStateGenerator<ValueType, StateType>& chunkGenerator = *generators[chunkIndex];
+                
+                // The state storage is only read while expanding the states, so it may be accessed concurrently.
+                // Unknown states are recorded by the chunk instead.
+                std::function<StateType (CompressedState const&)> stateToIdCallback = [&] (CompressedState const& state) {
+                    std::pair<bool, StateType> flagIndexPair = stateStorage.stateToId.find(state);
+                    if (flagIndexPair.first) {
+                        return flagIndexPair.second;
+                    }
+                    StateType newLocalIndex = static_cast<StateType>(chunk.newStates.size());
+                    StateType localIndex = chunk.newStateToLocalIndex.findOrAdd(state, newLocalIndex);
+                    if (localIndex == newLocalIndex) {
+                        chunk.newStates.push_back(state);
+                    }
+                    return firstTemporaryIndex + localIndex;
+                };
+                
+                chunk.behaviors.reserve(chunkBoundaries[chunkIndex + 1] - chunkBoundaries[chunkIndex]);
+                for (uint_fast64_t stateIndex = chunkBoundaries[chunkIndex]; stateIndex < chunkBoundaries[chunkIndex + 1]; ++stateIndex) {
+                    chunkGenerator.load(level[stateIndex]);
+                    chunk.behaviors.push_back(chunkGenerator.expand(stateToIdCallback));
+                }
+            };
+            
+            if (numberOfChunks > 1) {
+                storm::utility::parallel::getThreadPool().execute(numberOfChunks, expandChunk);
+            } else {
+                expandChunk(0);
+            }
+            
+            // Now add the new states to the state storage. Since the chunks are consecutive and every chunk records the
+            // new states in the order in which it discovered them, this assigns the same indices as the sequential
+            // breadth-first search (states discovered by several chunks are only added for the first one).
+            for (auto& chunk : chunks) {
+                chunk.newStateIndices.reserve(chunk.newStates.size());
+                for (auto const& state : chunk.newStates) {
+                    chunk.newStateIndices.push_back(getOrAddStateIndex(state));
+                }
+            }
+            
+            // Finally, add the behaviors in the order of the level.
+            for (uint_fast64_t chunkIndex = 0; chunkIndex < numberOfChunks; ++chunkIndex) {
+                ExplorationChunk<ValueType, StateType> const& chunk = chunks[chunkIndex];
+                for (uint_fast64_t stateIndex = chunkBoundaries[chunkIndex]; stateIndex < chunkBoundaries[chunkIndex + 1]; ++stateIndex) {
+                    CompressedState const& currentState = level[stateIndex];
+                    StateType currentIndex = stateStorage.stateToId.getValue(currentState);
+                    STORM_LOG_TRACE("Adding behavior of state with id " << currentIndex << ".");
+                    addStateBehavior(currentIndex, currentState, chunk.behaviors[stateIndex - chunkBoundaries[chunkIndex]], &chunk.newStateIndices, firstTemporaryIndex, transitionMatrixBuilder, rewardModelBuilders, choiceLabels, markovianStates, currentRow, currentRowGroup);
+                }
+            }
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isParallelExplorationApplicable() const {
+            // Exact and parametric values are backed by number libraries that are not thread-safe, so we restrict the
+            // parallel exploration to floating point values.
+            return options.parallelExploration && options.explorationOrder == ExplorationOrder::Bfs && storm::utility::parallel::isParallelismEnabled() && std::is_same<ValueType, double>::value;
+        }
+        
         template <typename ValueType, typename RewardModelType, typename StateType>
         typename ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ModelComponents ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
             ModelComponents modelComponents;
@@ -81,6 +81,11 @@ namespace storm {
                 // model. If it is to be preserved, it can be retrieved via the appropriate methods after a successful
                 // call to <code>translateProgram</code>.
                 bool buildStateValuations;
+                
+                // A flag that indicates whether the states of each breadth-first level are to be expanded concurrently
+                // (using the number of threads of storm::utility::parallel). The resulting model is identical to the
+                // one obtained by the sequential exploration.
+                bool parallelExploration;
             };
             
             /*!
@@ -146,6 +151,37 @@ namespace storm {
              */
             void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, boost::optional<std::vector<boost::container::flat_set<uint_fast64_t>>>& choiceLabels , boost::optional<storm::storage::BitVector>& markovianChoices);
             
+            /*!
+             * Adds the given behavior of a state as the next row group to the given builders.
+             *
+             * @param currentIndex The index of the state.
+             * @param currentState The state.
+             * @param behavior The behavior of the state.
+             * @param temporaryIndexMapping If given, all target indices that are at least firstTemporaryIndex are
+             * replaced by the entry at position (index - firstTemporaryIndex) of this mapping.
+             * @param firstTemporaryIndex The smallest target index that is to be replaced.
+             */
+            void addStateBehavior(StateType currentIndex, CompressedState const& currentState, storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::vector<StateType> const* temporaryIndexMapping, StateType firstTemporaryIndex, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, boost::optional<std::vector<boost::container::flat_set<uint_fast64_t>>>& choiceLabels, boost::optional<storm::storage::BitVector>& markovianStates, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup);
+            
+            /*!
+             * Expands the given states, which form one level of the breadth-first search, concurrently and adds their
+             * behavior to the given builders. For this, the level is split into consecutive chunks that are each
+             * expanded by one of the given generators. While expanding, states that are not yet known are only
+             * recorded by the chunks and they are added to the state storage afterwards in the order in which the
+             * sequential exploration would have discovered them. Hence, the state indices do not depend on the number
+             * of threads.
+             *
+             * @param level The states to expand.
+             * @param generators The generators to use. Every chunk is expanded by a separate generator.
+             */
+            void exploreLevelInParallel(std::vector<CompressedState> const& level, std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> const& generators, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, boost::optional<std::vector<boost::container::flat_set<uint_fast64_t>>>& choiceLabels, boost::optional<storm::storage::BitVector>& markovianStates, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup);
+            
+            /*!
+             * Retrieves whether the states are to be explored in parallel, i.e. whether this was requested, the
+             * exploration order is breadth-first, more than one thread is available and the value type supports it.
+             */
+            bool isParallelExplorationApplicable() const;
+            
             /*!
              * Explores the state space of the given program and returns the components of the model as a result.
              *
@@ -1,8 +1,15 @@
 #include "storm/builder/jit/ExplicitJitJaniModelBuilder.h"
 
 #include <iostream>
+#include <fstream>
 #include <cstdio>
+#include <cerrno>
 #include <chrono>
+#include <iomanip>
+#include <set>
+
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "storm/solver/SmtSolver.h"
 #include "storm/storage/jani/AutomatonComposition.h"
@@ -26,6 +33,7 @@
 #include "storm/settings/modules/JitBuilderSettings.h"
 
 #include "storm/utility/OsDetection.h"
+#include "storm/utility/storm-version.h"
 #include "storm-config.h"
 
 namespace storm {
@@ -34,6 +42,57 @@ namespace storm {
             
             static const std::string JIT_VARIABLE_EXTENSION = "_jit_";
             
+            /*!
+             * Computes the (stable) FNV-1a hash of the given content.
+             */
+            static uint64_t computeContentHash(std::string const& content) {
+                uint64_t hash = 14695981039346656037ull;
+                for (char character : content) {
+                    hash ^= static_cast<unsigned char>(character);
+                    hash *= 1099511628211ull;
+                }
+                return hash;
+            }
+            
+            /*!
+             * Retrieves whether the given path is a directory (or regular file) that is owned by the current user and
+             * cannot be modified by other users. Symbolic links are not followed.
+             */
+            static bool isPrivatePath(boost::filesystem::path const& path, bool directory) {
+                struct stat status;
+                if (lstat(path.c_str(), &status) != 0) {
+                    return false;
+                }
+                if (directory ? !S_ISDIR(status.st_mode) : !S_ISREG(status.st_mode)) {
+                    return false;
+                }
+                return status.st_uid == geteuid() && (status.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+            }
+            
+            /*!
+             * Retrieves the names of the files included by the given source code.
+             */
+            static std::vector<std::string> getIncludedFiles(std::string const& source) {
+                std::vector<std::string> result;
+                std::stringstream stream(source);
+                std::string line;
+                while (std::getline(stream, line)) {
+                    std::size_t position = line.find_first_not_of(" \t");
+                    if (position == std::string::npos || line.compare(position, 8, "#include") != 0) {
+                        continue;
+                    }
+                    std::size_t begin = line.find_first_of("\"<", position + 8);
+                    if (begin == std::string::npos) {
+                        continue;
+                    }
+                    std::size_t end = line.find_first_of("\">", begin + 1);
+                    if (end != std::string::npos) {
+                        result.push_back(line.substr(begin + 1, end - begin - 1));
+                    }
+                }
+                return result;
+            }
+            
 #ifdef LINUX
             static const std::string DYLIB_EXTENSION = ".so";
 #endif
@@ -85,6 +144,20 @@ namespace storm {
                 } else {
                     carlIncludeDirectory = STORM_CARL_INCLUDE_DIR;
                 }
+                if (!settings.isNoCacheSet()) {
+                    if (settings.isCacheDirectorySet()) {
+                        cacheDirectory = boost::filesystem::path(settings.getCacheDirectory());
+                    } else {
+                        // Follow the XDG base directory specification, which only allows absolute paths.
+                        const char* cacheHomeEnv = std::getenv("XDG_CACHE_HOME");
+                        const char* homeEnv = std::getenv("HOME");
+                        if (cacheHomeEnv != nullptr && boost::filesystem::path(cacheHomeEnv).is_absolute()) {
+                            cacheDirectory = boost::filesystem::path(cacheHomeEnv) / "storm";
+                        } else if (homeEnv != nullptr && boost::filesystem::path(homeEnv).is_absolute()) {
+                            cacheDirectory = boost::filesystem::path(homeEnv) / ".cache" / "storm";
+                        }
+                    }
+                }
                 
                 // Register all transient variables as transient.
                 for (auto const& variable : this->model.getGlobalVariables().getTransientVariables()) {
@@ -447,6 +520,11 @@ namespace storm {
                 return result;
             }
             
+            template <typename ValueType, typename RewardModelType>
+            void ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::setCacheDirectory(boost::optional<boost::filesystem::path> const& cacheDirectory) {
+                this->cacheDirectory = cacheDirectory;
+            }
+            
             template <typename ValueType, typename RewardModelType>
             std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::build() {
                 // (0) Assemble information about the model.
@@ -461,15 +539,29 @@ namespace storm {
                 }
                 STORM_LOG_TRACE("Successfully created source code for model generation: " << source);
                 
-                // (2) Write the source code to a temporary file.
-                boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
-                
-                // (3) Compile the source code to a shared library.
-                boost::filesystem::path dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
-                STORM_LOG_TRACE("Successfully compiled shared library.");
-                
-                // (4) Remove the source code of the shared library we just compiled.
-                boost::filesystem::remove(temporarySourceFile);
+                // (2) If the same source code was compiled in an earlier run, we can skip the compilation.
+                if (cacheDirectory && !prepareCacheDirectory()) {
+                    cacheDirectory = boost::none;
+                }
+                std::string cacheContent = cacheDirectory ? getCacheContent(source) : std::string();
+                boost::optional<boost::filesystem::path> cachedLibraryPath = loadFromCache(cacheContent);
+                boost::filesystem::path dynamicLibraryPath;
+                if (cachedLibraryPath) {
+                    STORM_LOG_INFO("Using shared library " << cachedLibraryPath.get() << " from the cache.");
+                    dynamicLibraryPath = cachedLibraryPath.get();
+                } else {
+                    // (3) Write the source code to a temporary file and compile it to a shared library.
+                    boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
+                    dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
+                    STORM_LOG_TRACE("Successfully compiled shared library.");
+                    
+                    // (4) Remove the source code of the shared library we just compiled and keep the library for later runs.
+                    boost::filesystem::remove(temporarySourceFile);
+                    cachedLibraryPath = storeInCache(dynamicLibraryPath, cacheContent);
+                    if (cachedLibraryPath) {
+                        dynamicLibraryPath = cachedLibraryPath.get();
+                    }
+                }
                 
                 // (5) Create the builder from the shared library.
                 createBuilder(dynamicLibraryPath);
@@ -490,8 +582,10 @@ namespace storm {
                 auto end = std::chrono::high_resolution_clock::now();
                 STORM_LOG_TRACE("Building model took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
                 
-                // (7) Delete the shared library.
-                boost::filesystem::remove(dynamicLibraryPath);
+                // (7) Delete the shared library unless it is kept in the cache.
+                if (!cachedLibraryPath) {
+                    boost::filesystem::remove(dynamicLibraryPath);
+                }
                 
                 STORM_LOG_THROW(!error, storm::exceptions::WrongFormatException, "Model building failed. Reason: " << error.get());
                 
@@ -2403,6 +2497,149 @@ namespace storm {
                 return dynamicLibraryPath;
             }
             
+            template <typename ValueType, typename RewardModelType>
+            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getCacheContent(std::string const& source) const {
+                std::stringstream stream;
+                stream << "// " << storm::utility::StormVersion::longVersionString() << std::endl;
+                stream << "// " << storm::utility::StormVersion::buildInfo() << std::endl;
+                stream << "// " << compiler << " " << compilerFlags << " -I" << stormIncludeDirectory << " -I" << boostIncludeDirectory << " -I" << carlIncludeDirectory << std::endl;
+                stream << getStormHeaderDigest(source);
+                stream << source;
+                return stream.str();
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getStormHeaderDigest(std::string const& source) const {
+                std::stringstream stream;
+                std::set<std::string> visitedFiles;
+                std::vector<std::string> filesToVisit = getIncludedFiles(source);
+                while (!filesToVisit.empty()) {
+                    std::string file = std::move(filesToVisit.back());
+                    filesToVisit.pop_back();
+                    if (!visitedFiles.insert(file).second) {
+                        continue;
+                    }
+                    
+                    // Only files found in storm's include directory are considered, the versions of all other
+                    // libraries are covered by the compiler invocation.
+                    boost::filesystem::path path = boost::filesystem::path(stormIncludeDirectory) / file;
+                    boost::system::error_code errorCode;
+                    if (!boost::filesystem::is_regular_file(path, errorCode)) {
+                        continue;
+                    }
+                    std::ifstream in(path.native());
+                    std::stringstream content;
+                    content << in.rdbuf();
+                    stream << "// " << file << " " << std::hex << std::setw(16) << std::setfill('0') << computeContentHash(content.str()) << std::dec << std::endl;
+                    
+                    std::vector<std::string> includedFiles = getIncludedFiles(content.str());
+                    filesToVisit.insert(filesToVisit.end(), includedFiles.begin(), includedFiles.end());
+                }
+                return stream.str();
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            bool ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::prepareCacheDirectory() const {
+                boost::filesystem::path const& directory = cacheDirectory.get();
+                boost::system::error_code errorCode;
+                if (!boost::filesystem::exists(directory, errorCode)) {
+                    if (directory.has_parent_path()) {
+                        boost::filesystem::create_directories(directory.parent_path(), errorCode);
+                    }
+                    if (mkdir(directory.c_str(), S_IRWXU) != 0 && errno != EEXIST) {
+                        STORM_LOG_WARN("Unable to create the cache directory " << directory << ", compiled models are not cached.");
+                        return false;
+                    }
+                }
+                if (!isPrivatePath(directory, true)) {
+                    STORM_LOG_WARN("Not using the cache directory " << directory << ", because it is not a directory owned by the current user or may be modified by other users.");
+                    return false;
+                }
+                return true;
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            boost::filesystem::path ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getCachePath(std::string const& cacheContent) const {
+                // Use the hash of the content as the name of the cached files.
+                std::stringstream stream;
+                stream << "model_" << std::hex << std::setw(16) << std::setfill('0') << computeContentHash(cacheContent);
+                return cacheDirectory.get() / stream.str();
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            boost::optional<boost::filesystem::path> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::loadFromCache(std::string const& cacheContent) const {
+                if (!cacheDirectory) {
+                    return boost::none;
+                }
+                
+                boost::filesystem::path cachePath = getCachePath(cacheContent);
+                boost::filesystem::path sourcePath = cachePath;
+                sourcePath += ".cpp";
+                boost::filesystem::path dynamicLibraryPath = cachePath;
+                dynamicLibraryPath += DYLIB_EXTENSION;
+                
+                boost::system::error_code errorCode;
+                if (!boost::filesystem::exists(dynamicLibraryPath, errorCode) || !boost::filesystem::exists(sourcePath, errorCode)) {
+                    return boost::none;
+                }
+                
+                // The library is loaded into the process, so it must not stem from another user.
+                if (!isPrivatePath(dynamicLibraryPath, false) || !isPrivatePath(sourcePath, false)) {
+                    STORM_LOG_WARN("Ignoring cached shared library " << dynamicLibraryPath << ", because it is not a regular file owned by the current user or may be modified by other users.");
+                    return boost::none;
+                }
+                
+                // Compare the stored content to rule out hash collisions.
+                std::ifstream in(sourcePath.native());
+                std::stringstream storedContent;
+                storedContent << in.rdbuf();
+                if (storedContent.str() != cacheContent) {
+                    STORM_LOG_DEBUG("Ignoring cached shared library " << dynamicLibraryPath << ", because it was compiled from different source code.");
+                    return boost::none;
+                }
+                return dynamicLibraryPath;
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            boost::optional<boost::filesystem::path> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::storeInCache(boost::filesystem::path const& dynamicLibraryPath, std::string const& cacheContent) const {
+                if (!cacheDirectory) {
+                    return boost::none;
+                }
+                
+                boost::filesystem::path cachePath = getCachePath(cacheContent);
+                boost::filesystem::path sourcePath = cachePath;
+                sourcePath += ".cpp";
+                boost::filesystem::path cachedLibraryPath = cachePath;
+                cachedLibraryPath += DYLIB_EXTENSION;
+                
+                // Other processes may access the cache concurrently, so we first copy the files into the cache
+                // directory under a unique name and then rename them, which is atomic.
+                boost::filesystem::path temporarySourcePath = cacheDirectory.get() / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.cpp");
+                boost::filesystem::path temporaryLibraryPath = cacheDirectory.get() / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%" + DYLIB_EXTENSION);
+                try {
+                    std::ofstream out(temporarySourcePath.native());
+                    out << cacheContent;
+                    out.close();
+                    STORM_LOG_THROW(out, storm::exceptions::InvalidStateException, "Unable to write " << temporarySourcePath << ".");
+                    
+                    boost::filesystem::copy_file(dynamicLibraryPath, temporaryLibraryPath);
+                    
+                    // Rename the library first, so the source code is only found once the library is complete.
+                    boost::filesystem::rename(temporaryLibraryPath, cachedLibraryPath);
+                    boost::filesystem::rename(temporarySourcePath, sourcePath);
+                } catch (std::exception const& e) {
+                    boost::system::error_code errorCode;
+                    boost::filesystem::remove(temporarySourcePath, errorCode);
+                    boost::filesystem::remove(temporaryLibraryPath, errorCode);
+                    STORM_LOG_WARN("Unable to store the shared library in the cache directory " << cacheDirectory.get() << " (error: " << e.what() << ").");
+                    return boost::none;
+                }
+                
+                boost::filesystem::remove(dynamicLibraryPath);
+                STORM_LOG_TRACE("Stored shared library in the cache as " << cachedLibraryPath << ".");
+                return cachedLibraryPath;
+            }
+            
             template<typename RationalFunctionType, typename TP = typename RationalFunctionType::PolyType, carl::EnableIf<carl::needs_cache<TP>> = carl::dummy>
             RationalFunctionType convertVariableToPolynomial(carl::Variable const& variable, std::shared_ptr<carl::Cache<carl::PolynomialFactorizationPair<RawPolynomial>>> cache) {
                 return RationalFunctionType(typename RationalFunctionType::PolyType(typename RationalFunctionType::PolyType::PolyType(variable), cache));
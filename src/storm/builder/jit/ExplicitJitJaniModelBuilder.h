@@ -46,6 +46,13 @@ namespace storm {
                  */
                 ExplicitJitJaniModelBuilder(storm::jani::Model const& model, storm::builder::BuilderOptions const& options = storm::builder::BuilderOptions());
                 
+                /*!
+                 * Sets the directory in which compiled shared libraries are cached, overriding the one given by the
+                 * settings. If boost::none is given, compiled shared libraries are neither taken from nor stored in a
+                 * cache.
+                 */
+                void setCacheDirectory(boost::optional<boost::filesystem::path> const& cacheDirectory);
+                
                 /*!
                  * Builds and returns the sparse model.
                  */
@@ -132,6 +139,46 @@ namespace storm {
                  * binary file.
                  */
                 boost::filesystem::path compileToSharedLibrary(boost::filesystem::path const& sourceFile);
+                
+                /*!
+                 * Retrieves the content that identifies the shared library compiled from the given source code in the
+                 * cache. Besides the source code, this includes everything else that influences the compilation, i.e.
+                 * the compiler invocation, the version of storm and the contents of the storm headers the source code
+                 * (transitively) includes.
+                 */
+                std::string getCacheContent(std::string const& source) const;
+                
+                /*!
+                 * Retrieves a digest of the storm headers that are (transitively) included by the given source code,
+                 * consisting of one line with the name and the hash of the content per header.
+                 */
+                std::string getStormHeaderDigest(std::string const& source) const;
+                
+                /*!
+                 * Creates the cache directory (accessible only by the current user) if it does not exist yet. Since
+                 * shared libraries from the cache are loaded into the process, the directory is only used if it is
+                 * owned by the current user and cannot be modified by other users.
+                 *
+                 * @return True iff the cache directory can be used.
+                 */
+                bool prepareCacheDirectory() const;
+                
+                /*!
+                 * Retrieves the path (without extension) under which the shared library with the given cache content is
+                 * stored in the cache.
+                 */
+                boost::filesystem::path getCachePath(std::string const& cacheContent) const;
+                
+                /*!
+                 * Retrieves the path to the shared library with the given cache content if it is present in the cache.
+                 */
+                boost::optional<boost::filesystem::path> loadFromCache(std::string const& cacheContent) const;
+                
+                /*!
+                 * Stores the given shared library in the cache and returns its path within the cache. If the library
+                 * could not be stored, boost::none is returned and the library is left untouched.
+                 */
+                boost::optional<boost::filesystem::path> storeInCache(boost::filesystem::path const& dynamicLibraryPath, std::string const& cacheContent) const;
 
                 /*!
                  * Loads the given shared library and creates the builder from it.
@@ -184,6 +231,9 @@ namespace storm {
                 /// The include directory of carl.
                 std::string carlIncludeDirectory;
                 
+                /// The directory in which compiled shared libraries are cached (if caching is enabled).
+                boost::optional<boost::filesystem::path> cacheDirectory;
+                
                 /// A cache that is used by carl.
                 std::shared_ptr<carl::Cache<carl::PolynomialFactorizationPair<RawPolynomial>>> cache;
             };
@@ -13,6 +13,8 @@
 #include "storm/settings/modules/JaniExportSettings.h"
 
 #include "storm/utility/resources.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/simd.h"
 #include "storm/utility/storm-version.h"
 
 
@@ -174,6 +176,12 @@ namespace storm {
                 storm::utility::resources::setCPULimit(resources.getTimeoutInSeconds());
             }
             
+            // Configure the number of threads used by the built-in parallel kernels.
+            storm::utility::parallel::setNumberOfThreads(storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads());
+            
+            // Configure the instruction set used by the vectorized kernels.
+            storm::utility::simd::setInstructionSet(storm::settings::getModule<storm::settings::modules::CoreSettings>().getSimdInstructionSet());
+            
             if (general.isVersionSet()) {
                 printVersion("storm");
                 return false;
@@ -218,12 +226,7 @@ namespace storm {
                 if (ioSettings.isPrismInputSet()) {
                     model = storm::parseProgram(ioSettings.getPrismInputFilename());
                     
-                    bool transformToJani = ioSettings.isPrismToJaniSet();
-                    bool transformToJaniForJit = coreSettings.getEngine() == storm::settings::modules::CoreSettings::Engine::Sparse && ioSettings.isJitSet();
-                    STORM_LOG_WARN_COND(transformToJani || !transformToJaniForJit, "The JIT-based model builder is only available for JANI models, automatically converting the PRISM input model.");
-                    transformToJani |= transformToJaniForJit;
-                    
-                    if (transformToJani) {
+                    if (ioSettings.isPrismToJaniSet()) {
                         auto modelAndRenaming = model.toJaniWithLabelRenaming(true);
                         if (!modelAndRenaming.second.empty()) {
                             labelRenaming = modelAndRenaming.second;
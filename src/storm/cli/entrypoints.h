@@ -78,6 +78,21 @@ namespace storm {
                 STORM_PRINT_AND_LOG(std::endl << "Model checking property " << *property.getRawFormula() << " ..." << std::endl);
                 std::cout.flush();
                 storm::utility::Stopwatch modelCheckingWatch(true);
+                
+                // If requested, check time-bounded reachability properties on CTMCs for all given time bounds at once.
+                if (storm::settings::getModule<storm::settings::modules::IOSettings>().isTimeBoundsSet() && model->getType() == storm::models::ModelType::Ctmc && storm::isQuantitativeTimeBoundedReachabilityFormula(*property.getFilter().getFormula())) {
+                    std::vector<double> timeBounds = storm::settings::getModule<storm::settings::modules::IOSettings>().getTimeBounds();
+                    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = storm::verifySparseCtmcForTimeBounds(model->template as<storm::models::sparse::Ctmc<ValueType>>(), property.getFilter().getFormula(), timeBounds, onlyInitialStatesRelevant);
+                    modelCheckingWatch.stop();
+                    for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+                        STORM_PRINT_AND_LOG("Result for time bound " << timeBounds[index] << " (initial states): ");
+                        results[index]->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+                        applyFilterFunctionAndOutput<ValueType>(results[index], property.getFilter().getFilterType());
+                    }
+                    STORM_PRINT_AND_LOG("Time for model checking: " << modelCheckingWatch << "." << std::endl);
+                    continue;
+                }
+                
                 std::unique_ptr<storm::modelchecker::CheckResult> result(storm::verifySparseModel(model, property.getFilter().getFormula(), onlyInitialStatesRelevant));
                 modelCheckingWatch.stop();
                 if (result) {
@@ -0,0 +1,346 @@
+#include "storm/generator/BytecodeExpressionEvaluator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <string>
+
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+
+#include "storm/adapters/CarlAdapter.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        class BytecodeExpressionEvaluator::Compiler : public storm::expressions::ExpressionVisitor {
+        public:
+            Compiler(BytecodeExpressionEvaluator const& evaluator, Program& program) : evaluator(evaluator), program(program), stackDepth(0) {
+                // Intentionally left empty.
+            }
+
+            void compile(storm::expressions::BaseExpression const& expression) {
+                program.instructions.clear();
+                program.stackSize = 0;
+                stackDepth = 0;
+                expression.accept(*this, boost::none);
+                STORM_LOG_ASSERT(stackDepth == 1, "Compiled program leaves " << stackDepth << " values on the stack.");
+            }
+
+            virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override {
+                expression.getCondition()->accept(*this, data);
+                uint64_t jumpToElse = emit(Opcode::JumpIfFalse, -1);
+                uint64_t depthBeforeBranches = stackDepth;
+                expression.getThenExpression()->accept(*this, data);
+                uint64_t jumpToEnd = emit(Opcode::Jump, 0);
+
+                // Only one of the branches is executed, so the else branch starts with the same stack.
+                stackDepth = depthBeforeBranches;
+                program.instructions[jumpToElse].index = program.instructions.size();
+                expression.getElseExpression()->accept(*this, data);
+                program.instructions[jumpToEnd].index = program.instructions.size();
+                return boost::any();
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+                expression.getFirstOperand()->accept(*this, data);
+                if (expression.getOperatorType() == storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies) {
+                    emit(Opcode::Not, 0);
+                }
+                expression.getSecondOperand()->accept(*this, data);
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And: emit(Opcode::And, -1); break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or: emit(Opcode::Or, -1); break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Xor: emit(Opcode::Xor, -1); break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies: emit(Opcode::Or, -1); break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Iff: emit(Opcode::Equal, -1); break;
+                }
+                return boost::any();
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+                uint64_t firstOperandStart = program.instructions.size();
+                expression.getFirstOperand()->accept(*this, data);
+                uint64_t secondOperandStart = program.instructions.size();
+                expression.getSecondOperand()->accept(*this, data);
+
+                // Exprtk folds constant subexpressions and evaluates powers of non-constant bases with constant integer
+                // exponents by repeated multiplication, which may round differently than std::pow.
+                if (expression.getOperatorType() == storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power && !loadsValues(firstOperandStart, secondOperandStart) && !loadsValues(secondOperandStart, program.instructions.size())) {
+                    emit(Opcode::Power, -1);
+                    return boost::any();
+                } else if (expression.getOperatorType() == storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power && !loadsValues(secondOperandStart, program.instructions.size())) {
+                    emit(Opcode::PowerWithConstantExponent, -1);
+                    return boost::any();
+                }
+
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus: emit(Opcode::Add, -1); break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Minus: emit(Opcode::Subtract, -1); break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Times: emit(Opcode::Multiply, -1); break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Divide: emit(Opcode::Divide, -1); break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min: emit(Opcode::Minimum, -1); break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max: emit(Opcode::Maximum, -1); break;
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power: emit(Opcode::Power, -1); break;
+                }
+                return boost::any();
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override {
+                expression.getFirstOperand()->accept(*this, data);
+                expression.getSecondOperand()->accept(*this, data);
+                switch (expression.getRelationType()) {
+                    case storm::expressions::BinaryRelationExpression::RelationType::Equal: emit(Opcode::Equal, -1); break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::NotEqual: emit(Opcode::NotEqual, -1); break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::Less: emit(Opcode::Less, -1); break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::LessOrEqual: emit(Opcode::LessOrEqual, -1); break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::Greater: emit(Opcode::Greater, -1); break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::GreaterOrEqual: emit(Opcode::GreaterOrEqual, -1); break;
+                }
+                return boost::any();
+            }
+
+            virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+                storm::expressions::Variable const& variable = expression.getVariable();
+                for (auto const& booleanVariable : evaluator.variableInformation.booleanVariables) {
+                    if (booleanVariable.variable == variable) {
+                        emit(Opcode::LoadBoolean, 1, booleanVariable.bitOffset);
+                        return boost::any();
+                    }
+                }
+                for (auto const& integerVariable : evaluator.variableInformation.integerVariables) {
+                    if (integerVariable.variable == variable) {
+                        emit(Opcode::LoadInteger, 1, integerVariable.bitOffset, integerVariable.bitWidth, static_cast<double>(integerVariable.lowerBound));
+                        return boost::any();
+                    }
+                }
+                for (auto const& locationVariable : evaluator.variableInformation.locationVariables) {
+                    if (locationVariable.variable == variable) {
+                        emit(Opcode::LoadInteger, 1, locationVariable.bitOffset, locationVariable.bitWidth, 0);
+                        return boost::any();
+                    }
+                }
+                emit(Opcode::LoadExternal, 1, evaluator.getExternalIndex(variable));
+                return boost::any();
+            }
+
+            virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+                expression.getOperand()->accept(*this, data);
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::UnaryBooleanFunctionExpression::OperatorType::Not: emit(Opcode::Not, 0); break;
+                }
+                return boost::any();
+            }
+
+            virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+                expression.getOperand()->accept(*this, data);
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus: emit(Opcode::Negate, 0); break;
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Floor: emit(Opcode::Floor, 0); break;
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Ceil: emit(Opcode::Ceil, 0); break;
+                }
+                return boost::any();
+            }
+
+            virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) override {
+                emit(Opcode::Constant, 1, 0, 0, expression.getValue() ? 1.0 : 0.0);
+                return boost::any();
+            }
+
+            virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) override {
+                emit(Opcode::Constant, 1, 0, 0, static_cast<double>(expression.getValue()));
+                return boost::any();
+            }
+
+            virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) override {
+                // The exprtk-based evaluator computes the fraction in floating point, which may round differently than
+                // converting the exact value, so we do the same to obtain identical results.
+                std::stringstream stream;
+                stream << expression.getValue();
+                std::string fraction = stream.str();
+                std::size_t slashPosition = fraction.find('/');
+                double value = slashPosition == std::string::npos ? std::stod(fraction) : std::stod(fraction.substr(0, slashPosition)) / std::stod(fraction.substr(slashPosition + 1));
+                emit(Opcode::Constant, 1, 0, 0, value);
+                return boost::any();
+            }
+
+        private:
+            /*!
+             * Retrieves whether any of the instructions in the given range loads a value of a variable, i.e. whether
+             * the value computed by them is not constant.
+             */
+            bool loadsValues(uint64_t begin, uint64_t end) const {
+                return std::any_of(program.instructions.begin() + begin, program.instructions.begin() + end, [] (Instruction const& instruction) { return instruction.opcode == Opcode::LoadBoolean || instruction.opcode == Opcode::LoadInteger || instruction.opcode == Opcode::LoadExternal; });
+            }
+
+            /*!
+             * Appends an instruction to the program and returns its position.
+             *
+             * @param stackChange The number of values the instruction adds to (or removes from) the stack.
+             */
+            uint64_t emit(Opcode opcode, int64_t stackChange, uint64_t index = 0, uint64_t width = 0, double value = 0) {
+                program.instructions.push_back(Instruction{opcode, index, width, value});
+                stackDepth += stackChange;
+                program.stackSize = std::max(program.stackSize, stackDepth);
+                return program.instructions.size() - 1;
+            }
+
+            // The evaluator for which to compile.
+            BytecodeExpressionEvaluator const& evaluator;
+
+            // The program that is being built.
+            Program& program;
+
+            // The number of values on the stack after executing the instructions emitted so far.
+            uint64_t stackDepth;
+        };
+
+        BytecodeExpressionEvaluator::BytecodeExpressionEvaluator(storm::expressions::ExpressionManager const& manager, VariableInformation const& variableInformation) : ExpressionEvaluatorBase<double>(manager), variableInformation(variableInformation), state(nullptr) {
+            // Intentionally left empty.
+        }
+
+        void BytecodeExpressionEvaluator::setState(CompressedState const& state) {
+            this->state = &state;
+        }
+
+        bool BytecodeExpressionEvaluator::asBool(storm::expressions::Expression const& expression) const {
+            return execute(getProgram(expression)) == 1.0;
+        }
+
+        int_fast64_t BytecodeExpressionEvaluator::asInt(storm::expressions::Expression const& expression) const {
+            return static_cast<int_fast64_t>(execute(getProgram(expression)));
+        }
+
+        double BytecodeExpressionEvaluator::asRational(storm::expressions::Expression const& expression) const {
+            return execute(getProgram(expression));
+        }
+
+        void BytecodeExpressionEvaluator::setBooleanValue(storm::expressions::Variable const& variable, bool value) {
+            externalValues[getExternalIndex(variable)] = static_cast<double>(value);
+        }
+
+        void BytecodeExpressionEvaluator::setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) {
+            externalValues[getExternalIndex(variable)] = static_cast<double>(value);
+        }
+
+        void BytecodeExpressionEvaluator::setRationalValue(storm::expressions::Variable const& variable, double value) {
+            externalValues[getExternalIndex(variable)] = value;
+        }
+
+        BytecodeExpressionEvaluator::Program const& BytecodeExpressionEvaluator::getProgram(storm::expressions::Expression const& expression) const {
+            auto programIt = programs.find(expression.getBaseExpressionPointer());
+            if (programIt == programs.end()) {
+                programIt = programs.emplace(expression.getBaseExpressionPointer(), Program()).first;
+                Compiler(*this, programIt->second).compile(expression.getBaseExpression());
+                if (stack.size() < programIt->second.stackSize) {
+                    stack.resize(programIt->second.stackSize);
+                }
+            }
+            return programIt->second;
+        }
+
+        uint64_t BytecodeExpressionEvaluator::getExternalIndex(storm::expressions::Variable const& variable) const {
+            auto indexIt = externalIndices.find(variable);
+            if (indexIt == externalIndices.end()) {
+                // As for the exprtk-based evaluator, variables whose value was never set evaluate to zero.
+                indexIt = externalIndices.emplace(variable, externalValues.size()).first;
+                externalValues.push_back(0);
+            }
+            return indexIt->second;
+        }
+
+        double BytecodeExpressionEvaluator::powerWithConstantExponent(double base, double exponent) {
+            if (std::abs(exponent) > 60 || std::fmod(exponent, 1.0) != 0) {
+                return std::pow(base, exponent);
+            }
+
+            // Mirror exprtk's fast_exp, which uses fixed multiplication schemes for exponents up to ten and repeated
+            // squaring beyond.
+            uint64_t absoluteExponent = static_cast<uint64_t>(std::abs(exponent));
+            double result;
+            switch (absoluteExponent) {
+                case 0: return 1.0;
+                case 1: result = base; break;
+                case 2: result = base * base; break;
+                case 3: result = base * base * base; break;
+                case 4: { double square = base * base; result = square * square; break; }
+                case 5: { double square = base * base; result = square * square * base; break; }
+                case 6: { double cube = base * base * base; result = cube * cube; break; }
+                case 7: { double cube = base * base * base; result = cube * cube * base; break; }
+                case 8: { double square = base * base; double fourth = square * square; result = fourth * fourth; break; }
+                case 9: { double square = base * base; double fourth = square * square; result = fourth * fourth * base; break; }
+                case 10: { double square = base * base; double fifth = square * square * base; result = fifth * fifth; break; }
+                default:
+                    result = 1.0;
+                    while (absoluteExponent) {
+                        if (absoluteExponent & 1) {
+                            result *= base;
+                            --absoluteExponent;
+                        }
+                        base *= base;
+                        absoluteExponent >>= 1;
+                    }
+            }
+            return exponent < 0 ? 1.0 / result : result;
+        }
+
+        double BytecodeExpressionEvaluator::execute(Program const& program) const {
+            Instruction const* instructions = program.instructions.data();
+            uint64_t const numberOfInstructions = program.instructions.size();
+            double* values = stack.data();
+            uint64_t size = 0;
+
+            uint64_t position = 0;
+            while (position < numberOfInstructions) {
+                Instruction const& instruction = instructions[position];
+                switch (instruction.opcode) {
+                    case Opcode::Constant: values[size++] = instruction.value; break;
+                    case Opcode::LoadBoolean:
+                        STORM_LOG_ASSERT(state != nullptr, "No state to evaluate expression in.");
+                        values[size++] = state->get(instruction.index) ? 1.0 : 0.0;
+                        break;
+                    case Opcode::LoadInteger:
+                        STORM_LOG_ASSERT(state != nullptr, "No state to evaluate expression in.");
+                        values[size++] = (instruction.width == 0 ? 0.0 : static_cast<double>(state->getAsInt(instruction.index, instruction.width))) + instruction.value;
+                        break;
+                    case Opcode::LoadExternal: values[size++] = externalValues[instruction.index]; break;
+                    case Opcode::Add: --size; values[size - 1] += values[size]; break;
+                    case Opcode::Subtract: --size; values[size - 1] -= values[size]; break;
+                    case Opcode::Multiply: --size; values[size - 1] *= values[size]; break;
+                    case Opcode::Divide: --size; values[size - 1] /= values[size]; break;
+                    case Opcode::Minimum: --size; values[size - 1] = std::min(values[size - 1], values[size]); break;
+                    case Opcode::Maximum: --size; values[size - 1] = std::max(values[size - 1], values[size]); break;
+                    case Opcode::Power: --size; values[size - 1] = std::pow(values[size - 1], values[size]); break;
+                    case Opcode::PowerWithConstantExponent: --size; values[size - 1] = powerWithConstantExponent(values[size - 1], values[size]); break;
+                    case Opcode::Negate: values[size - 1] = -values[size - 1]; break;
+                    case Opcode::Floor: values[size - 1] = std::floor(values[size - 1]); break;
+                    case Opcode::Ceil: values[size - 1] = std::ceil(values[size - 1]); break;
+                    case Opcode::Equal: --size; values[size - 1] = values[size - 1] == values[size] ? 1.0 : 0.0; break;
+                    case Opcode::NotEqual: --size; values[size - 1] = values[size - 1] != values[size] ? 1.0 : 0.0; break;
+                    case Opcode::Less: --size; values[size - 1] = values[size - 1] < values[size] ? 1.0 : 0.0; break;
+                    case Opcode::LessOrEqual: --size; values[size - 1] = values[size - 1] <= values[size] ? 1.0 : 0.0; break;
+                    case Opcode::Greater: --size; values[size - 1] = values[size - 1] > values[size] ? 1.0 : 0.0; break;
+                    case Opcode::GreaterOrEqual: --size; values[size - 1] = values[size - 1] >= values[size] ? 1.0 : 0.0; break;
+                    case Opcode::And: --size; values[size - 1] = (values[size - 1] != 0.0 && values[size] != 0.0) ? 1.0 : 0.0; break;
+                    case Opcode::Or: --size; values[size - 1] = (values[size - 1] != 0.0 || values[size] != 0.0) ? 1.0 : 0.0; break;
+                    case Opcode::Xor: --size; values[size - 1] = ((values[size - 1] != 0.0) != (values[size] != 0.0)) ? 1.0 : 0.0; break;
+                    case Opcode::Not: values[size - 1] = values[size - 1] == 0.0 ? 1.0 : 0.0; break;
+                    case Opcode::Jump: position = instruction.index; continue;
+                    case Opcode::JumpIfFalse:
+                        if (values[--size] == 0.0) {
+                            position = instruction.index;
+                            continue;
+                        }
+                        break;
+                }
+                ++position;
+            }
+
+            STORM_LOG_ASSERT(size == 1, "Program left " << size << " values on the stack.");
+            return values[0];
+        }
+
+    }
+}
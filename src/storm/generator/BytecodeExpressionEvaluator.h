@@ -0,0 +1,124 @@
+#ifndef STORM_GENERATOR_BYTECODEEXPRESSIONEVALUATOR_H_
+#define STORM_GENERATOR_BYTECODEEXPRESSIONEVALUATOR_H_
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/expressions/ExpressionEvaluatorBase.h"
+#include "storm/storage/expressions/Variable.h"
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+    namespace expressions {
+        class BaseExpression;
+    }
+
+    namespace generator {
+
+        /*!
+         * An evaluator that compiles expressions into a simple stack-based bytecode and reads the values of the
+         * variables directly from the bits of a compressed state. In contrast to the exprtk-based evaluator, a state
+         * therefore does not need to be unpacked before expressions can be evaluated in it.
+         *
+         * Just like the exprtk-based evaluator, all values are represented as doubles (with booleans being encoded by
+         * zero and one), so both evaluators yield identical results.
+         */
+        class BytecodeExpressionEvaluator : public storm::expressions::ExpressionEvaluatorBase<double> {
+        public:
+            /*!
+             * Creates an evaluator for expressions over the variables of the given manager.
+             *
+             * @param manager The manager responsible for the expressions.
+             * @param variableInformation The information about how the variables are packed within the states. All
+             * variables that are not stored in the state are taken from the values set via the setters.
+             */
+            BytecodeExpressionEvaluator(storm::expressions::ExpressionManager const& manager, VariableInformation const& variableInformation);
+
+            /*!
+             * Sets the state in which the expressions are evaluated. The state needs to remain valid as long as
+             * expressions are evaluated in it.
+             */
+            void setState(CompressedState const& state);
+
+            bool asBool(storm::expressions::Expression const& expression) const override;
+            int_fast64_t asInt(storm::expressions::Expression const& expression) const override;
+            double asRational(storm::expressions::Expression const& expression) const override;
+
+            void setBooleanValue(storm::expressions::Variable const& variable, bool value) override;
+            void setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) override;
+            void setRationalValue(storm::expressions::Variable const& variable, double value) override;
+
+        private:
+            enum class Opcode : uint8_t {
+                Constant, LoadBoolean, LoadInteger, LoadExternal,
+                Add, Subtract, Multiply, Divide, Minimum, Maximum, Power, PowerWithConstantExponent, Negate, Floor, Ceil,
+                Equal, NotEqual, Less, LessOrEqual, Greater, GreaterOrEqual,
+                And, Or, Xor, Not,
+                Jump, JumpIfFalse
+            };
+
+            // A single instruction. The meaning of the arguments depends on the opcode: loads use the bit offset and
+            // width of the variable (or the index of the external value) and store the lower bound of integer
+            // variables in the value, constants store their value and jumps store their target in the index.
+            struct Instruction {
+                Opcode opcode;
+                uint64_t index;
+                uint64_t width;
+                double value;
+            };
+
+            // A compiled expression.
+            struct Program {
+                std::vector<Instruction> instructions;
+                uint64_t stackSize;
+            };
+
+            // The visitor that translates expressions into programs.
+            class Compiler;
+
+            /*!
+             * Retrieves the program for the given expression and compiles it if this has not happened before.
+             */
+            Program const& getProgram(storm::expressions::Expression const& expression) const;
+
+            /*!
+             * Executes the given program in the current state and returns the value it computes.
+             */
+            double execute(Program const& program) const;
+
+            /*!
+             * Raises the base to the given power. Constant exponents that are integers with an absolute value of at
+             * most 60 are evaluated by repeated multiplication (in the same order as exprtk does for such exponents),
+             * all others by std::pow.
+             */
+            static double powerWithConstantExponent(double base, double exponent);
+
+            /*!
+             * Retrieves the index of the external value of the given variable and creates it if it does not yet exist.
+             */
+            uint64_t getExternalIndex(storm::expressions::Variable const& variable) const;
+
+            // The information about how the variables are packed within the states.
+            VariableInformation variableInformation;
+
+            // The state in which the expressions are evaluated.
+            CompressedState const* state;
+
+            // The values of all variables that are not stored in the state.
+            mutable std::unordered_map<storm::expressions::Variable, uint64_t> externalIndices;
+            mutable std::vector<double> externalValues;
+
+            // A mapping of expressions to their compiled counterpart.
+            mutable std::unordered_map<std::shared_ptr<storm::expressions::BaseExpression const>, Program> programs;
+
+            // The stack used for executing the programs.
+            mutable std::vector<double> stack;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_BYTECODEEXPRESSIONEVALUATOR_H_ */
@@ -5,7 +5,7 @@
 
 namespace storm {
     namespace expressions {
-        template<typename ValueType> class ExpressionEvaluator;
+        template<typename ValueType> class ExpressionEvaluatorBase;
         
         class ExpressionManager;
         class SimpleValuation;
@@ -25,7 +25,7 @@ namespace storm {
          * @param evaluator The evaluator into which to load the state.
          */
         template<typename ValueType>
-        void unpackStateIntoEvaluator(CompressedState const& state, VariableInformation const& variableInformation, storm::expressions::ExpressionEvaluator<ValueType>& evaluator);
+        void unpackStateIntoEvaluator(CompressedState const& state, VariableInformation const& variableInformation, storm::expressions::ExpressionEvaluatorBase<ValueType>& evaluator);
 
         /*!
          * Converts the compressed state into an explicit representation in the form of a valuation.
@@ -0,0 +1,204 @@
+#include "storm/generator/GuardIndex.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/expressions/BaseExpression.h"
+#include "storm/storage/expressions/VariableExpression.h"
+#include "storm/storage/expressions/OperatorType.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        const uint64_t GuardIndex::MAXIMAL_NUMBER_OF_BUCKETS;
+
+        GuardIndex::GuardIndex() : bucketBitOffset(0), bucketBitWidth(0), buckets(1) {
+            // Intentionally left empty.
+        }
+
+        GuardIndex::GuardIndex(VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& guards) : constraints(guards.size()), exactGuards(guards.size()), bucketBitOffset(0), bucketBitWidth(0) {
+            // Determine the values that the variables can take in the compressed states. As the values of integer
+            // variables are stored relative to their lower bound, we only exclude values below the lower bound, so
+            // the index stays correct even if some update leaves the range of a variable.
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableRanges.emplace(booleanVariable.variable, VariableRange{booleanVariable.bitOffset, 1, 0, 1});
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                int64_t upperBound = integerVariable.bitWidth < 63 ? integerVariable.lowerBound + static_cast<int64_t>((1ull << integerVariable.bitWidth) - 1) : std::numeric_limits<int64_t>::max();
+                variableRanges.emplace(integerVariable.variable, VariableRange{integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, upperBound});
+            }
+
+            // Translate the guards into intervals of admissible values. At the same time, we determine for every
+            // variable that can serve for selecting the bucket the (fractional) number of guards it rules out,
+            // assuming that all values are equally likely.
+            std::vector<boost::container::flat_map<storm::expressions::Variable, std::pair<int64_t, int64_t>>> guardIntervals(guards.size());
+            boost::container::flat_map<storm::expressions::Variable, double> variableScores;
+            for (uint64_t position = 0; position < guards.size(); ++position) {
+                bool exact = true;
+                addConstraints(guards[position], guardIntervals[position], exact);
+                exactGuards.set(position, exact);
+
+                for (auto const& variableIntervalPair : guardIntervals[position]) {
+                    VariableRange const& range = variableRanges.at(variableIntervalPair.first);
+                    if (range.bitWidth == 0 || (1ull << range.bitWidth) > MAXIMAL_NUMBER_OF_BUCKETS) {
+                        continue;
+                    }
+                    uint64_t numberOfValues = 1ull << range.bitWidth;
+                    uint64_t numberOfAdmissibleValues = variableIntervalPair.second.first <= variableIntervalPair.second.second ? variableIntervalPair.second.second - variableIntervalPair.second.first + 1 : 0;
+                    variableScores[variableIntervalPair.first] += 1.0 - static_cast<double>(numberOfAdmissibleValues) / numberOfValues;
+                }
+            }
+
+            // Select the variable whose value determines the bucket.
+            boost::optional<storm::expressions::Variable> bucketVariable;
+            double bestScore = 0;
+            for (auto const& variableScorePair : variableScores) {
+                if (variableScorePair.second > bestScore) {
+                    bucketVariable = variableScorePair.first;
+                    bestScore = variableScorePair.second;
+                }
+            }
+            if (bucketVariable) {
+                VariableRange const& range = variableRanges.at(bucketVariable.get());
+                bucketBitOffset = range.bitOffset;
+                bucketBitWidth = range.bitWidth;
+                buckets.resize(1ull << bucketBitWidth);
+            } else {
+                buckets.resize(1);
+            }
+
+            // Finally, distribute the guards over the buckets and store the remaining constraints.
+            for (uint64_t position = 0; position < guards.size(); ++position) {
+                bool constrainsBucketVariable = false;
+                for (auto const& variableIntervalPair : guardIntervals[position]) {
+                    VariableRange const& range = variableRanges.at(variableIntervalPair.first);
+                    int64_t lowerBound = variableIntervalPair.second.first;
+                    int64_t upperBound = variableIntervalPair.second.second;
+
+                    if (bucketVariable && variableIntervalPair.first == bucketVariable.get()) {
+                        constrainsBucketVariable = true;
+                        for (int64_t value = lowerBound; value <= upperBound; ++value) {
+                            buckets[value - range.lowerBound].push_back(position);
+                        }
+                    } else if (lowerBound > upperBound) {
+                        // The guard is unsatisfiable, which we represent by an empty interval.
+                        constraints[position].push_back(Constraint{range.bitOffset, range.bitWidth, 1, 0});
+                    } else if (lowerBound > range.lowerBound || upperBound < range.upperBound) {
+                        constraints[position].push_back(Constraint{range.bitOffset, range.bitWidth, static_cast<uint64_t>(lowerBound - range.lowerBound), static_cast<uint64_t>(upperBound - range.lowerBound)});
+                    }
+                }
+
+                if (!constrainsBucketVariable) {
+                    for (auto& bucket : buckets) {
+                        bucket.push_back(position);
+                    }
+                }
+            }
+
+            STORM_LOG_TRACE("Indexed " << guards.size() << " guards (" << exactGuards.getNumberOfSetBits() << " exact) using " << buckets.size() << " buckets.");
+        }
+
+        void GuardIndex::addConstraints(storm::expressions::Expression const& guard, boost::container::flat_map<storm::expressions::Variable, std::pair<int64_t, int64_t>>& intervals, bool& exact) const {
+            // Restricts the interval of the given variable to the given bounds.
+            auto restrict = [this, &intervals] (storm::expressions::Variable const& variable, int64_t lowerBound, int64_t upperBound) {
+                auto intervalIt = intervals.find(variable);
+                if (intervalIt == intervals.end()) {
+                    VariableRange const& range = variableRanges.at(variable);
+                    intervalIt = intervals.emplace(variable, std::make_pair(range.lowerBound, range.upperBound)).first;
+                }
+                intervalIt->second.first = std::max(intervalIt->second.first, lowerBound);
+                intervalIt->second.second = std::min(intervalIt->second.second, upperBound);
+            };
+
+            // Retrieves whether the given expression is a variable that is stored in the compressed state.
+            auto isIndexedVariable = [this] (storm::expressions::Expression const& expression) {
+                return expression.isVariable() && variableRanges.find(expression.getBaseExpression().asVariableExpression().getVariable()) != variableRanges.end();
+            };
+
+            if (guard.isTrue()) {
+                return;
+            } else if (guard.isFunctionApplication() && guard.getOperator() == storm::expressions::OperatorType::And) {
+                addConstraints(guard.getOperand(0), intervals, exact);
+                addConstraints(guard.getOperand(1), intervals, exact);
+                return;
+            } else if (guard.hasBooleanType() && isIndexedVariable(guard)) {
+                restrict(guard.getBaseExpression().asVariableExpression().getVariable(), 1, 1);
+                return;
+            } else if (guard.isFunctionApplication() && guard.getOperator() == storm::expressions::OperatorType::Not && isIndexedVariable(guard.getOperand(0))) {
+                restrict(guard.getOperand(0).getBaseExpression().asVariableExpression().getVariable(), 0, 0);
+                return;
+            } else if (guard.isFunctionApplication() && guard.getArity() == 2) {
+                storm::expressions::OperatorType operatorType = guard.getOperator();
+                storm::expressions::Expression variableExpression = guard.getOperand(0);
+                storm::expressions::Expression constantExpression = guard.getOperand(1);
+
+                // Bring the comparison into the form 'variable op constant'.
+                if (!isIndexedVariable(variableExpression)) {
+                    std::swap(variableExpression, constantExpression);
+                    switch (operatorType) {
+                        case storm::expressions::OperatorType::Less: operatorType = storm::expressions::OperatorType::Greater; break;
+                        case storm::expressions::OperatorType::LessOrEqual: operatorType = storm::expressions::OperatorType::GreaterOrEqual; break;
+                        case storm::expressions::OperatorType::Greater: operatorType = storm::expressions::OperatorType::Less; break;
+                        case storm::expressions::OperatorType::GreaterOrEqual: operatorType = storm::expressions::OperatorType::LessOrEqual; break;
+                        default: break;
+                    }
+                }
+
+                if (isIndexedVariable(variableExpression) && variableExpression.hasIntegerType() && constantExpression.hasIntegerType() && !constantExpression.containsVariables()) {
+                    storm::expressions::Variable const& variable = variableExpression.getBaseExpression().asVariableExpression().getVariable();
+                    int64_t constant = constantExpression.evaluateAsInt();
+                    switch (operatorType) {
+                        case storm::expressions::OperatorType::Equal: restrict(variable, constant, constant); return;
+                        case storm::expressions::OperatorType::Less: restrict(variable, std::numeric_limits<int64_t>::min(), constant - 1); return;
+                        case storm::expressions::OperatorType::LessOrEqual: restrict(variable, std::numeric_limits<int64_t>::min(), constant); return;
+                        case storm::expressions::OperatorType::Greater: restrict(variable, constant + 1, std::numeric_limits<int64_t>::max()); return;
+                        case storm::expressions::OperatorType::GreaterOrEqual: restrict(variable, constant, std::numeric_limits<int64_t>::max()); return;
+                        default: break;
+                    }
+                }
+            }
+
+            // If we get here, the conjunct could not be translated and needs to be evaluated.
+            exact = false;
+        }
+
+        std::vector<uint64_t> const& GuardIndex::getCandidates(CompressedState const& state) const {
+            if (buckets.size() == 1) {
+                return buckets.front();
+            }
+            return buckets[getValue(state, bucketBitOffset, bucketBitWidth)];
+        }
+
+        bool GuardIndex::satisfiesConstraints(uint64_t position, CompressedState const& state) const {
+            for (auto const& constraint : constraints[position]) {
+                uint64_t value = getValue(state, constraint.bitOffset, constraint.bitWidth);
+                if (value < constraint.lowerBound || value > constraint.upperBound) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool GuardIndex::isExact(uint64_t position) const {
+            return exactGuards.get(position);
+        }
+
+        uint64_t GuardIndex::getNumberOfGuards() const {
+            return constraints.size();
+        }
+
+        uint64_t GuardIndex::getValue(CompressedState const& state, uint64_t bitOffset, uint64_t bitWidth) {
+            if (bitWidth == 0) {
+                return 0;
+            } else if (bitWidth == 1) {
+                return state.get(bitOffset) ? 1 : 0;
+            }
+            return state.getAsInt(bitOffset, bitWidth);
+        }
+
+    }
+}
@@ -0,0 +1,123 @@
+#ifndef STORM_GENERATOR_GUARDINDEX_H_
+#define STORM_GENERATOR_GUARDINDEX_H_
+
+#include <vector>
+#include <cstdint>
+
+#include <boost/container/flat_map.hpp>
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/BitVector.h"
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+    namespace generator {
+
+        /*!
+         * An index over a list of guards that allows to quickly narrow down the guards that may be satisfied in a
+         * given state without evaluating any expression.
+         *
+         * For this purpose, the conjuncts of the guards that compare a (boolean or integer) variable with a constant
+         * are translated into intervals of admissible values of the variable, which can be checked directly on the
+         * bits of the compressed state. Additionally, the guards are partitioned into buckets according to the value
+         * of the variable whose constraints rule out the most guards, so that the guards that are violated by the
+         * value of this variable are not even looked at.
+         */
+        class GuardIndex {
+        public:
+            // The maximal number of buckets the guards are distributed over.
+            static const uint64_t MAXIMAL_NUMBER_OF_BUCKETS = 1024;
+
+            /*!
+             * Creates an empty index.
+             */
+            GuardIndex();
+
+            /*!
+             * Creates an index for the given guards.
+             *
+             * @param variableInformation The information about how the variables are packed within the states.
+             * @param guards The guards to index.
+             */
+            GuardIndex(VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& guards);
+
+            /*!
+             * Retrieves the positions of all guards that are not yet known to be violated in the given state in
+             * ascending order. All other guards are violated in the given state.
+             */
+            std::vector<uint64_t> const& getCandidates(CompressedState const& state) const;
+
+            /*!
+             * Checks whether the given state satisfies the constraints of the guard at the given position that are not
+             * already taken care of by the candidate selection. If this is not the case, the guard is violated.
+             *
+             * @param position The position of a guard returned by <code>getCandidates</code>.
+             * @param state The state for which the candidates were retrieved.
+             */
+            bool satisfiesConstraints(uint64_t position, CompressedState const& state) const;
+
+            /*!
+             * Retrieves whether the guard at the given position is completely described by its constraints, i.e.
+             * whether it is satisfied by every state that passes the candidate selection and constraint check. If this
+             * is not the case, the guard needs to be evaluated.
+             */
+            bool isExact(uint64_t position) const;
+
+            /*!
+             * Retrieves the number of indexed guards.
+             */
+            uint64_t getNumberOfGuards() const;
+
+        private:
+            // A constraint requiring the value of a variable (as it is stored in the compressed state) to lie in a
+            // given interval.
+            struct Constraint {
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                uint64_t lowerBound;
+                uint64_t upperBound;
+            };
+
+            // The range of a variable as it is stored in the compressed state.
+            struct VariableRange {
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int64_t lowerBound;
+                int64_t upperBound;
+            };
+
+            /*!
+             * Translates the given guard into constraints. If a conjunct cannot be translated, it is skipped and the
+             * guard is marked as not exact.
+             */
+            void addConstraints(storm::expressions::Expression const& guard, boost::container::flat_map<storm::expressions::Variable, std::pair<int64_t, int64_t>>& intervals, bool& exact) const;
+
+            /*!
+             * Reads the value of a variable from the given state.
+             */
+            static uint64_t getValue(CompressedState const& state, uint64_t bitOffset, uint64_t bitWidth);
+
+            // The ranges of all variables that can appear in constraints.
+            boost::container::flat_map<storm::expressions::Variable, VariableRange> variableRanges;
+
+            // For each guard, the constraints that need to be checked for its candidates.
+            std::vector<std::vector<Constraint>> constraints;
+
+            // The guards that are completely described by their constraints.
+            storm::storage::BitVector exactGuards;
+
+            // The location of the variable whose value selects the bucket. If there is only one bucket, this is not
+            // used.
+            uint64_t bucketBitOffset;
+            uint64_t bucketBitWidth;
+
+            // For each value of the bucket variable, the positions of the guards that may be satisfied.
+            std::vector<std::vector<uint64_t>> buckets;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_GUARDINDEX_H_ */
@@ -1,5 +1,7 @@
 #include "storm/generator/JaniNextStateGenerator.h"
 
+#include <algorithm>
+
 #include "storm/models/sparse/StateLabeling.h"
 
 #include "storm/storage/expressions/SimpleValuation.h"
@@ -42,7 +44,7 @@ namespace storm {
             this->variableInformation = VariableInformation(model);
             
             // Create a proper evalator.
-            this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(model.getManager());
+            this->createEvaluator();
             
             if (this->options.isBuildAllRewardModelsSet()) {
                 for (auto const& variable : model.getGlobalVariables()) {
@@ -80,6 +82,9 @@ namespace storm {
             // Build the information structs for the reward models.
             buildRewardModelInformation();
             
+            // Index the guards of the edges, so we can quickly narrow down the edges enabled in a state.
+            buildGuardIndices();
+            
             // If there are terminal states we need to handle, we now need to translate all labels to expressions.
             if (this->options.hasTerminalStates()) {
                 std::vector<std::reference_wrapper<storm::jani::Automaton const>> composedAutomata;
@@ -371,17 +376,9 @@ namespace storm {
             for (auto const& automaton : model.getAutomata()) {
                 uint64_t location = locations[automatonIndex];
                 
-                // Iterate over all edges from the source location.
-                for (auto const& edge : automaton.getEdgesFromLocation(location)) {
-                    // Skip the edge if it is labeled with a non-silent action.
-                    if (edge.getActionIndex() != storm::jani::Model::SILENT_ACTION_INDEX) {
-                        continue;
-                    }
-                    
-                    // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(edge.getGuard())) {
-                        continue;
-                    }
+                // Iterate over all enabled silent edges from the source location.
+                for (auto const& edgePointer : getEnabledEdges(automatonIndex, location, storm::jani::Model::SILENT_ACTION_INDEX, state)) {
+                    storm::jani::Edge const& edge = *edgePointer;
                     
                     // Determine the exit rate if it's a Markovian edge.
                     boost::optional<ValueType> exitRate = boost::none;
@@ -548,32 +545,55 @@ namespace storm {
             return result;
         }
         
+        template<typename ValueType, typename StateType>
+        std::vector<storm::jani::Edge const*> JaniNextStateGenerator<ValueType, StateType>::getEnabledEdges(uint64_t automatonIndex, uint64_t locationIndex, uint64_t actionIndex, CompressedState const& state) {
+            std::vector<storm::jani::Edge const*> result;
+            
+            // The edges with the given action form a contiguous range of the edges leaving the location, so we only
+            // need to consider the candidates of the index that fall into this range.
+            storm::jani::Automaton const& automaton = model.getAutomaton(automatonIndex);
+            auto locationEdges = automaton.getEdgesFromLocation(locationIndex);
+            auto actionEdges = automaton.getEdgesFromLocation(locationIndex, actionIndex);
+            uint64_t firstPosition = std::distance(locationEdges.begin(), actionEdges.begin());
+            uint64_t lastPosition = firstPosition + actionEdges.size();
+            
+            GuardIndex const& guardIndex = edgeGuardIndices[automatonIndex][locationIndex];
+            std::vector<uint64_t> const& candidates = guardIndex.getCandidates(state);
+            for (auto positionIt = std::lower_bound(candidates.begin(), candidates.end(), firstPosition), positionIte = candidates.end(); positionIt != positionIte && *positionIt < lastPosition; ++positionIt) {
+                if (!guardIndex.satisfiesConstraints(*positionIt, state)) {
+                    continue;
+                }
+                
+                // Only if the guard is not fully captured by the index, we need to evaluate it.
+                storm::jani::Edge const& edge = *(locationEdges.begin() + *positionIt);
+                if (guardIndex.isExact(*positionIt) || this->evaluator->asBool(edge.getGuard())) {
+                    result.push_back(&edge);
+                }
+            }
+            
+            return result;
+        }
+        
         template<typename ValueType, typename StateType>
         std::vector<std::vector<storm::jani::Edge const*>> JaniNextStateGenerator<ValueType, StateType>::getEnabledEdges(std::vector<uint64_t> const& locationIndices, uint64_t actionIndex) {
             std::vector<std::vector<storm::jani::Edge const*>> result;
             
             // Iterate over all automata.
-            uint64_t automatonIndex = 0;
-            for (auto const& automaton : model.getAutomata()) {
+            for (uint64_t automatonIndex = 0; automatonIndex < model.getNumberOfAutomata(); ++automatonIndex) {
+                storm::jani::Automaton const& automaton = model.getAutomaton(automatonIndex);
+                
                 // If the automaton has no edge labeled with the given action, we can skip it.
                 if (!automaton.hasEdgeLabeledWithActionIndex(actionIndex)) {
                     continue;
                 }
                 
-                auto edges = automaton.getEdgesFromLocation(locationIndices[automatonIndex], actionIndex);
-                
                 // If the automaton contains the action, but there is no edge available labeled with
                 // this action, we don't have any feasible command combinations.
-                if (edges.empty()) {
+                if (automaton.getEdgesFromLocation(locationIndices[automatonIndex], actionIndex).empty()) {
                     return std::vector<std::vector<storm::jani::Edge const*>>();
                 }
                 
-                std::vector<storm::jani::Edge const*> edgePointers;
-                for (auto const& edge : edges) {
-                    if (this->evaluator->asBool(edge.getGuard())) {
-                        edgePointers.push_back(&edge);
-                    }
-                }
+                std::vector<storm::jani::Edge const*> edgePointers = getEnabledEdges(automatonIndex, locationIndices[automatonIndex], actionIndex, *this->state);
                 
                 // If there was no enabled edge although the automaton has some edge with the required action, we must
                 // not return anything.
@@ -582,7 +602,6 @@ namespace storm {
                 }
                 
                 result.emplace_back(std::move(edgePointers));
-                ++automatonIndex;
             }
             
             return result;
@@ -607,6 +626,27 @@ namespace storm {
             }
         }
         
+        template<typename ValueType, typename StateType>
+        void JaniNextStateGenerator<ValueType, StateType>::buildGuardIndices() {
+            for (auto const& automaton : model.getAutomata()) {
+                std::vector<GuardIndex> locationGuardIndices;
+                for (uint64_t locationIndex = 0; locationIndex < automaton.getNumberOfLocations(); ++locationIndex) {
+                    std::vector<storm::expressions::Expression> guards;
+                    for (auto const& edge : automaton.getEdgesFromLocation(locationIndex)) {
+                        guards.push_back(edge.getGuard());
+                    }
+                    locationGuardIndices.emplace_back(this->variableInformation, guards);
+                }
+                edgeGuardIndices.push_back(std::move(locationGuardIndices));
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        std::shared_ptr<NextStateGenerator<ValueType, StateType>> JaniNextStateGenerator<ValueType, StateType>::clone() const {
+            // The model stored by this generator is already preprocessed, so we can skip the preprocessing.
+            return std::shared_ptr<NextStateGenerator<ValueType, StateType>>(new JaniNextStateGenerator<ValueType, StateType>(model, this->options, false));
+        }
+        
         template<typename ValueType, typename StateType>
         std::size_t JaniNextStateGenerator<ValueType, StateType>::getNumberOfRewardModels() const {
             return rewardVariables.size();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/GuardIndex.h"
 
 #include "storm/storage/jani/Model.h"
 
@@ -20,6 +21,7 @@ namespace storm {
             virtual std::vector<StateType> getInitialStates(StateToIdCallback const& stateToIdCallback) override;
             
             virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
             
             virtual std::size_t getNumberOfRewardModels() const override;
             virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const override;
@@ -77,6 +79,13 @@ namespace storm {
              */
             std::vector<Choice<ValueType>> getNonsilentActionChoices(std::vector<uint64_t> const& locations, CompressedState const& state, StateToIdCallback stateToIdCallback);
             
+            /*!
+             * Retrieves the edges of the given automaton that leave the given location, are labeled with the given
+             * action and whose guards are satisfied in the given state, which needs to be the state currently loaded
+             * into the evaluator.
+             */
+            std::vector<storm::jani::Edge const*> getEnabledEdges(uint64_t automatonIndex, uint64_t locationIndex, uint64_t actionIndex, CompressedState const& state);
+            
             /*!
              * Retrieves a list of lists of edges such that the list at index i are all edges of automaton i enabled in 
              * the current state. If the list is empty, it means there was at least one automaton containing edges with
@@ -101,6 +110,11 @@ namespace storm {
              */
             void buildRewardModelInformation();
             
+            /*!
+             * Builds the indices over the guards of the edges of all automata.
+             */
+            void buildGuardIndices();
+            
             /*!
              * Checks the underlying model for validity for this next-state generator.
              */
@@ -117,6 +131,9 @@ namespace storm {
             
             /// A flag that stores whether at least one of the selected reward models has state-action rewards.
             bool hasStateActionRewards;
+            
+            /// For each automaton and each of its locations, an index over the guards of the edges leaving the location.
+            std::vector<std::vector<GuardIndex>> edgeGuardIndices;
         };
         
     }
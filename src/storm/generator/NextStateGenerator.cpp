@@ -6,6 +6,7 @@
 
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/SimpleValuation.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
 
 #include "storm/models/sparse/StateLabeling.h"
 
@@ -16,12 +17,12 @@ namespace storm {
     namespace generator {
                     
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), state(nullptr) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), bytecodeEvaluator(nullptr), state(nullptr) {
             // Intentionally left empty.
         }
         
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), bytecodeEvaluator(nullptr), state(nullptr) {
             // Intentionally left empty.
         }
         
@@ -38,7 +39,7 @@ namespace storm {
         template<typename ValueType, typename StateType>
         void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
             // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
-            unpackStateIntoEvaluator(state, variableInformation, *evaluator);
+            loadIntoEvaluator(state);
             
             // Also, we need to store a pointer to the state itself, because we need to be able to access it when expanding it.
             this->state = &state;
@@ -74,7 +75,7 @@ namespace storm {
                 result.addLabel(label.first);
             }
             for (auto const& stateIndexPair : states) {
-                unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
+                loadIntoEvaluator(stateIndexPair.first);
                 
                 for (auto const& label : labelsAndExpressions) {
                     // Add label to state, if the corresponding expression is true.
@@ -143,6 +144,34 @@ namespace storm {
             }
         }
         
+        template<typename ValueType, typename StateType>
+        void NextStateGenerator<ValueType, StateType>::createEvaluator() {
+            bytecodeEvaluator = nullptr;
+            evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(*expressionManager);
+        }
+        
+        template<>
+        void NextStateGenerator<double, uint32_t>::createEvaluator() {
+            // Expressions over floating point values can be evaluated without unpacking the states first.
+            if (options.isBytecodeEvaluationSet()) {
+                auto newEvaluator = std::make_unique<BytecodeExpressionEvaluator>(*expressionManager, variableInformation);
+                bytecodeEvaluator = newEvaluator.get();
+                evaluator = std::move(newEvaluator);
+            } else {
+                bytecodeEvaluator = nullptr;
+                evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<double>>(*expressionManager);
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        void NextStateGenerator<ValueType, StateType>::loadIntoEvaluator(CompressedState const& state) {
+            if (bytecodeEvaluator) {
+                bytecodeEvaluator->setState(state);
+            } else {
+                unpackStateIntoEvaluator(state, variableInformation, *evaluator);
+            }
+        }
+        
         template<typename ValueType, typename StateType>
         storm::expressions::SimpleValuation NextStateGenerator<ValueType, StateType>::toValuation(CompressedState const& state) const {
             return unpackStateIntoValuation(state, variableInformation, *expressionManager);
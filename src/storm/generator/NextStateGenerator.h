@@ -8,7 +8,7 @@
 
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/BitVectorHashMap.h"
-#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/expressions/ExpressionEvaluatorBase.h"
 
 #include "storm/builder/BuilderOptions.h"
 #include "storm/builder/RewardModelInformation.h"
@@ -16,6 +16,7 @@
 #include "storm/generator/VariableInformation.h"
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/StateBehavior.h"
+#include "storm/generator/BytecodeExpressionEvaluator.h"
 
 #include "storm/utility/ConstantsComparator.h"
 
@@ -51,6 +52,16 @@ namespace storm {
             
             void load(CompressedState const& state);
             virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) = 0;
+            
+            /*!
+             * Creates an independent copy of this generator that produces the same states and behaviors. As the
+             * generators keep the currently loaded state and their evaluator as internal state, every thread that
+             * explores states concurrently needs its own copy.
+             *
+             * @return The copy of this generator.
+             */
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const = 0;
+            
             bool satisfies(storm::expressions::Expression const& expression) const;
             
             virtual std::size_t getNumberOfRewardModels() const = 0;
@@ -70,6 +81,16 @@ namespace storm {
             
             void postprocess(StateBehavior<ValueType, StateType>& result);
             
+            /*!
+             * Creates the evaluator for the expressions of the model. This requires the variable information to be set.
+             */
+            void createEvaluator();
+            
+            /*!
+             * Makes the evaluator evaluate expressions in the given state.
+             */
+            void loadIntoEvaluator(CompressedState const& state);
+            
             /// The options to be used for next-state generation.
             NextStateGeneratorOptions options;
             
@@ -83,7 +104,10 @@ namespace storm {
             VariableInformation variableInformation;
             
             /// An evaluator used to evaluate expressions.
-            std::unique_ptr<storm::expressions::ExpressionEvaluator<ValueType>> evaluator;
+            std::unique_ptr<storm::expressions::ExpressionEvaluatorBase<ValueType>> evaluator;
+            
+            /// If the evaluator reads the values of the variables directly from the states, this points to it.
+            BytecodeExpressionEvaluator* bytecodeEvaluator;
             
             /// The currently loaded state.
             CompressedState const* state;
@@ -91,6 +115,9 @@ namespace storm {
             /// A comparator used to compare constants.
             storm::utility::ConstantsComparator<ValueType> comparator;
         };
+        
+        template<>
+        void NextStateGenerator<double, uint32_t>::createEvaluator();
     }
 }
 
@@ -31,7 +31,10 @@ namespace storm {
             this->variableInformation = VariableInformation(program);
             
             // Create a proper evalator.
-            this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
+            this->createEvaluator();
+            
+            // Index the guards of the commands, so we can quickly narrow down the commands enabled in a state.
+            buildGuardIndices();
             
             if (this->options.isBuildAllRewardModelsSet()) {
                 for (auto const& rewardModel : this->program.getRewardModels()) {
@@ -107,6 +110,55 @@ namespace storm {
 #endif
         }
         
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::buildGuardIndices() {
+            for (auto const& module : program.getModules()) {
+                IndexedCommands moduleUnlabeledCommands;
+                std::vector<storm::expressions::Expression> unlabeledGuards;
+                std::map<uint_fast64_t, std::pair<std::vector<uint_fast64_t>, std::vector<storm::expressions::Expression>>> labeledCommandsAndGuards;
+                
+                for (uint_fast64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+                    storm::prism::Command const& command = module.getCommand(commandIndex);
+                    if (command.isLabeled()) {
+                        auto& commandsAndGuards = labeledCommandsAndGuards[command.getActionIndex()];
+                        commandsAndGuards.first.push_back(commandIndex);
+                        commandsAndGuards.second.push_back(command.getGuardExpression());
+                    } else {
+                        moduleUnlabeledCommands.commandIndices.push_back(commandIndex);
+                        unlabeledGuards.push_back(command.getGuardExpression());
+                    }
+                }
+                
+                moduleUnlabeledCommands.guardIndex = GuardIndex(this->variableInformation, unlabeledGuards);
+                unlabeledCommands.push_back(std::move(moduleUnlabeledCommands));
+                
+                std::map<uint_fast64_t, IndexedCommands> moduleLabeledCommands;
+                for (auto& actionIndexCommandsAndGuardsPair : labeledCommandsAndGuards) {
+                    IndexedCommands& commands = moduleLabeledCommands[actionIndexCommandsAndGuardsPair.first];
+                    commands.commandIndices = std::move(actionIndexCommandsAndGuardsPair.second.first);
+                    commands.guardIndex = GuardIndex(this->variableInformation, actionIndexCommandsAndGuardsPair.second.second);
+                }
+                labeledCommands.push_back(std::move(moduleLabeledCommands));
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        std::vector<uint_fast64_t> PrismNextStateGenerator<ValueType, StateType>::getEnabledCommandIndices(storm::prism::Module const& module, IndexedCommands const& commands, CompressedState const& state) {
+            std::vector<uint_fast64_t> result;
+            for (uint64_t position : commands.guardIndex.getCandidates(state)) {
+                if (!commands.guardIndex.satisfiesConstraints(position, state)) {
+                    continue;
+                }
+                
+                // Only if the guard is not fully captured by the index, we need to evaluate it.
+                uint_fast64_t commandIndex = commands.commandIndices[position];
+                if (commands.guardIndex.isExact(position) || this->evaluator->asBool(module.getCommand(commandIndex).getGuardExpression())) {
+                    result.push_back(commandIndex);
+                }
+            }
+            return result;
+        }
+        
         template<typename ValueType, typename StateType>
         ModelType PrismNextStateGenerator<ValueType, StateType>::getModelType() const {
             switch (program.getModelType()) {
@@ -345,12 +397,9 @@ namespace storm {
                 
                 std::vector<std::reference_wrapper<storm::prism::Command const>> commands;
                 
-                // Look up commands by their indices and add them if the guard evaluates to true in the given state.
-                for (uint_fast64_t commandIndex : commandIndices) {
-                    storm::prism::Command const& command = module.getCommand(commandIndex);
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
-                        commands.push_back(command);
-                    }
+                // Look up the commands whose guard is satisfied in the given state.
+                for (uint_fast64_t commandIndex : getEnabledCommandIndices(module, labeledCommands[i].at(actionIndex), *this->state)) {
+                    commands.push_back(module.getCommand(commandIndex));
                 }
                 
                 // If there was no enabled command although the module has some command with the required action label,
@@ -374,18 +423,10 @@ namespace storm {
             for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
                 storm::prism::Module const& module = program.getModule(i);
                 
-                // Iterate over all commands.
-                for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+                // Iterate over all enabled unlabeled commands.
+                for (uint_fast64_t j : getEnabledCommandIndices(module, unlabeledCommands[i], state)) {
                     storm::prism::Command const& command = module.getCommand(j);
                     
-                    // Only consider unlabeled commands.
-                    if (command.isLabeled()) continue;
-                    
-                    // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(command.getGuardExpression())) {
-                        continue;
-                    }
-                                        
                     result.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
                     Choice<ValueType>& choice = result.back();
                     
@@ -582,6 +623,12 @@ namespace storm {
             return NextStateGenerator<ValueType, StateType>::label(states, initialStateIndices, deadlockStateIndices, labels);
         }
         
+        template<typename ValueType, typename StateType>
+        std::shared_ptr<NextStateGenerator<ValueType, StateType>> PrismNextStateGenerator<ValueType, StateType>::clone() const {
+            // The program stored by this generator is already preprocessed, so we can skip the preprocessing.
+            return std::shared_ptr<NextStateGenerator<ValueType, StateType>>(new PrismNextStateGenerator<ValueType, StateType>(program, this->options, false));
+        }
+        
         template<typename ValueType, typename StateType>
         std::size_t PrismNextStateGenerator<ValueType, StateType>::getNumberOfRewardModels() const {
             return rewardModels.size();
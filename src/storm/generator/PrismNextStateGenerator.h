@@ -1,7 +1,10 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include <map>
+
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/GuardIndex.h"
 
 #include "storm/storage/prism/Program.h"
 
@@ -21,6 +24,7 @@ namespace storm {
             virtual std::vector<StateType> getInitialStates(StateToIdCallback const& stateToIdCallback) override;
 
             virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
 
             virtual std::size_t getNumberOfRewardModels() const override;
             virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const override;
@@ -28,7 +32,26 @@ namespace storm {
             virtual storm::models::sparse::StateLabeling label(storm::storage::BitVectorHashMap<StateType> const& states, std::vector<StateType> const& initialStateIndices = {}, std::vector<StateType> const& deadlockStateIndices = {}) override;
 
         private:
+            // A group of commands of one module together with an index over their guards. The positions used by the
+            // index refer to the list of command indices.
+            struct IndexedCommands {
+                std::vector<uint_fast64_t> commandIndices;
+                GuardIndex guardIndex;
+            };
+            
             void checkValid() const;
+            
+            /*!
+             * Builds the indices over the guards of the commands of all modules.
+             */
+            void buildGuardIndices();
+            
+            /*!
+             * Retrieves the indices of all commands of the given group of the given module whose guards are satisfied
+             * in the given state, which needs to be the state currently loaded into the evaluator. The indices are
+             * returned in ascending order.
+             */
+            std::vector<uint_fast64_t> getEnabledCommandIndices(storm::prism::Module const& module, IndexedCommands const& commands, CompressedState const& state);
 
             /*!
              * A delegate constructor that is used to preprocess the program before the constructor of the superclass is
@@ -88,6 +111,12 @@ namespace storm {
             
             // A flag that stores whether at least one of the selected reward models has state-action rewards.
             bool hasStateActionRewards;
+            
+            // For each module, its unlabeled commands.
+            std::vector<IndexedCommands> unlabeledCommands;
+            
+            // For each module, its commands grouped by their action index.
+            std::vector<std::map<uint_fast64_t, IndexedCommands>> labeledCommands;
         };
         
     }
@@ -34,6 +34,16 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> computeInstantaneousRewards(storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::InstantaneousRewardFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeReachabilityRewards(storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
 
+            /*!
+             * Computes the probabilities of the given bounded until formula for each of the given upper time bounds
+             * (instead of the bound of the formula). All bounds are treated in a single uniformization sweep.
+             *
+             * @param checkTask The task whose formula is to be checked. It must not have a lower time bound.
+             * @param upperBounds The upper time bounds for which to compute the probabilities.
+             * @return One result for each of the given bounds.
+             */
+            std::vector<std::unique_ptr<CheckResult>> computeBoundedUntilProbabilitiesForTimeBounds(CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask, std::vector<double> const& upperBounds);
+
         private:
             template<typename CValueType = ValueType, typename std::enable_if<storm::NumberTraits<CValueType>::SupportsExponential, int>::type = 0>
             bool canHandleImplementation(CheckTask<storm::logic::Formula, CValueType> const& checkTask) const;
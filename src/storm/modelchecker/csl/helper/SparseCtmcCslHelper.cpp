@@ -196,6 +196,72 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
             }
 
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, std::vector<double> const& upperBounds, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
+                
+                uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+                std::vector<std::vector<ValueType>> results(upperBounds.size());
+                
+                // If we identify the states that have probability 0 of reaching the target states, we can exclude them from the
+                // further computations.
+                storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+                storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+                STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+                
+                // Treat the bounds of the form [0, 0] and [0, inf] separately and collect the remaining ones.
+                std::vector<ValueType> timeBounds;
+                std::vector<uint_fast64_t> timeBoundIndices;
+                for (uint_fast64_t index = 0; index < upperBounds.size(); ++index) {
+                    STORM_LOG_THROW(upperBounds[index] >= 0, storm::exceptions::InvalidPropertyException, "Time bounds must not be negative.");
+                    if (statesWithProbabilityGreater0NonPsi.empty() || storm::utility::isZero(upperBounds[index])) {
+                        results[index] = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
+                        storm::utility::vector::setVectorValues<ValueType>(results[index], psiStates, storm::utility::one<ValueType>());
+                    } else if (upperBounds[index] == storm::utility::infinity<double>()) {
+                        results[index] = computeUntilProbabilities(rateMatrix, backwardTransitions, exitRates, phiStates, psiStates, qualitative, linearEquationSolverFactory);
+                    } else {
+                        timeBounds.push_back(storm::utility::convertNumber<ValueType>(upperBounds[index]));
+                        timeBoundIndices.push_back(index);
+                    }
+                }
+                
+                if (!timeBounds.empty()) {
+                    // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+                    ValueType uniformizationRate = 0;
+                    for (auto const& state : statesWithProbabilityGreater0NonPsi) {
+                        uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+                    }
+                    uniformizationRate *= 1.02;
+                    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+                    
+                    // Compute the uniformized matrix.
+                    storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+                    
+                    // Compute the vector that is to be added as a compensation for removing the absorbing states.
+                    std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+                    for (auto& element : b) {
+                        element /= uniformizationRate;
+                    }
+                    
+                    // Finally compute the transient probabilities for all bounds at once.
+                    std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                    std::vector<std::vector<ValueType>> subresults = computeTransientProbabilities(uniformizedMatrix, &b, timeBounds, uniformizationRate, values, linearEquationSolverFactory);
+                    
+                    for (uint_fast64_t index = 0; index < timeBoundIndices.size(); ++index) {
+                        std::vector<ValueType>& result = results[timeBoundIndices[index]];
+                        result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
+                        storm::utility::vector::setVectorValues(result, statesWithProbabilityGreater0NonPsi, subresults[index]);
+                        storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
+                    }
+                }
+                
+                return results;
+            }
+            
+            template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, bool, std::vector<double> const&, storm::solver::LinearEquationSolverFactory<ValueType> const&) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+            }
+
             template <typename ValueType>
             std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
                 return SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(computeProbabilityMatrix(rateMatrix, exitRateVector), backwardTransitions, phiStates, psiStates, qualitative, linearEquationSolverFactory);
@@ -687,6 +753,73 @@ namespace storm {
                 return result;
             }
             
+            template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilities(storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
+                
+                // Use Fox-Glynn to get the truncation points and the weights for all time bounds for which time can pass.
+                std::vector<std::vector<ValueType>> results(timeBounds.size());
+                std::vector<std::tuple<uint_fast64_t, uint_fast64_t, ValueType, std::vector<ValueType>>> foxGlynnResults(timeBounds.size());
+                storm::storage::BitVector boundsWithZeroLambda(timeBounds.size());
+                uint_fast64_t maximalRightTruncationPoint = 0;
+                for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+                    ValueType lambda = timeBounds[index] * uniformizationRate;
+                    
+                    // If no time can pass, the current values are the result.
+                    if (storm::utility::isZero(lambda)) {
+                        boundsWithZeroLambda.set(index);
+                        results[index] = values;
+                        continue;
+                    }
+                    
+                    foxGlynnResults[index] = storm::utility::numerical::getFoxGlynnCutoff(lambda, 1e+300, storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision() / 8.0);
+                    STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[index] << ": left=" << std::get<0>(foxGlynnResults[index]) << ", right=" << std::get<1>(foxGlynnResults[index]));
+                    
+                    // Scale the weights so they add up to one.
+                    for (auto& element : std::get<3>(foxGlynnResults[index])) {
+                        element /= std::get<2>(foxGlynnResults[index]);
+                    }
+                    maximalRightTruncationPoint = std::max(maximalRightTruncationPoint, std::get<1>(foxGlynnResults[index]));
+                    
+                    // Initialize the result with the contribution of the initial values.
+                    if (std::get<0>(foxGlynnResults[index]) == 0) {
+                        results[index] = values;
+                        storm::utility::vector::scaleVectorInPlace(results[index], std::get<3>(foxGlynnResults[index])[0]);
+                    } else {
+                        results[index] = std::vector<ValueType>(values.size());
+                    }
+                }
+                
+                if (maximalRightTruncationPoint == 0) {
+                    return results;
+                }
+                
+                STORM_LOG_DEBUG("Starting " << maximalRightTruncationPoint << " iterations for " << timeBounds.size() << " time bounds with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
+                
+                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(uniformizedMatrix);
+                solver->setCachingEnabled(true);
+                
+                // Perform the matrix-vector multiplications only once and add the scaled result to all bounds whose
+                // truncation points enclose the current iteration.
+                ValueType weight = 0;
+                std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight] (ValueType const& a, ValueType const& b) { return a + weight * b; };
+                for (uint_fast64_t iteration = 1; iteration <= maximalRightTruncationPoint; ++iteration) {
+                    solver->repeatedMultiply(values, addVector, 1);
+                    
+                    for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+                        if (boundsWithZeroLambda.get(index)) {
+                            continue;
+                        }
+                        auto const& foxGlynnResult = foxGlynnResults[index];
+                        if (std::get<0>(foxGlynnResult) <= iteration && iteration <= std::get<1>(foxGlynnResult)) {
+                            weight = std::get<3>(foxGlynnResult)[iteration - std::get<0>(foxGlynnResult)];
+                            storm::utility::vector::applyPointwise(results[index], values, results[index], addAndScale);
+                        }
+                    }
+                }
+                
+                return results;
+            }
+            
             template <typename ValueType>
             storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRates) {
                 // Turn the rates into probabilities by scaling each row with the exit rate of the state.
@@ -717,6 +850,7 @@ namespace storm {
             
             
             template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory);
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, bool qualitative, std::vector<double> const& upperBounds, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory);
             
             template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory);
 
@@ -737,10 +871,13 @@ namespace storm {
             template storm::storage::SparseMatrix<double> SparseCtmcCslHelper::computeUniformizedMatrix(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& maybeStates, double uniformizationRate, std::vector<double> const& exitRates);
             
             template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound, double uniformizationRate, std::vector<double> values, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory);
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilities(storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory);
 
 #ifdef STORM_HAVE_CARL
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<storm::RationalNumber> const& linearEquationSolverFactory);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<storm::RationalFunction> const& linearEquationSolverFactory);
+            template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, std::vector<double> const& upperBounds, storm::solver::LinearEquationSolverFactory<storm::RationalNumber> const& linearEquationSolverFactory);
+            template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, std::vector<double> const& upperBounds, storm::solver::LinearEquationSolverFactory<storm::RationalFunction> const& linearEquationSolverFactory);
 
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<storm::RationalNumber> const& linearEquationSolverFactory);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeUntilProbabilities(storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::LinearEquationSolverFactory<storm::RationalFunction> const& linearEquationSolverFactory);
@@ -9,6 +9,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/MarkovAutomatonSettings.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -18,6 +19,7 @@
 #include "storm/storage/expressions/Expression.h"
 
 #include "storm/utility/numerical.h"
+#include "storm/utility/constants.h"
 
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/LpSolver.h"
@@ -30,6 +32,9 @@ namespace storm {
     namespace modelchecker {
         namespace helper {
 
+            template<typename ValueType>
+            const uint_fast64_t SparseMarkovAutomatonCslHelper<ValueType>::MAXIMAL_NUMBER_OF_REFINEMENTS;
+
             template<typename ValueType>
             void SparseMarkovAutomatonCslHelper<ValueType>::computeBoundedReachabilityProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<ValueType>& markovianNonGoalValues, std::vector<ValueType>& probabilisticNonGoalValues, ValueType delta, uint_fast64_t numberOfSteps, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
                 
@@ -117,8 +122,239 @@ namespace storm {
                 solver->solveEquations(dir, probabilisticNonGoalValues, bProbabilistic);
             }
 
+            template<typename ValueType>
+            ValueType SparseMarkovAutomatonCslHelper<ValueType>::computeUniformizedBoundedReachabilityValues(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<ValueType> const& jumpCountTerminalValues, std::vector<ValueType> const& oracleTerminalValues, ValueType time, ValueType uniformizationRate, std::vector<ValueType>& jumpCountValues, std::vector<ValueType>& oracleValues, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
+                
+                // Start by computing the same four sparse matrices as the digitization-based procedure, but this time
+                // the transitions of Markovian states are uniformized, i.e. every Markovian state takes a (potentially
+                // self-looping) jump with the uniformization rate.
+                typename storm::storage::SparseMatrix<ValueType> aMarkovian = transitionMatrix.getSubmatrix(true, markovianNonGoalStates, markovianNonGoalStates, true);
+                typename storm::storage::SparseMatrix<ValueType> aMarkovianToProbabilistic = transitionMatrix.getSubmatrix(true, markovianNonGoalStates, probabilisticNonGoalStates);
+                typename storm::storage::SparseMatrix<ValueType> aProbabilistic = transitionMatrix.getSubmatrix(true, probabilisticNonGoalStates, probabilisticNonGoalStates);
+                typename storm::storage::SparseMatrix<ValueType> aProbabilisticToMarkovian = transitionMatrix.getSubmatrix(true, probabilisticNonGoalStates, markovianNonGoalStates);
+                
+                std::vector<ValueType> bMarkovianGoal;
+                bMarkovianGoal.reserve(markovianNonGoalStates.getNumberOfSetBits());
+                uint_fast64_t rowIndex = 0;
+                for (auto state : markovianNonGoalStates) {
+                    ValueType jumpProbability = exitRates[state] / uniformizationRate;
+                    for (auto& element : aMarkovian.getRow(rowIndex)) {
+                        if (element.getColumn() == rowIndex) {
+                            element.setValue(jumpProbability * element.getValue() + storm::utility::one<ValueType>() - jumpProbability);
+                        } else {
+                            element.setValue(jumpProbability * element.getValue());
+                        }
+                    }
+                    for (auto& element : aMarkovianToProbabilistic.getRow(rowIndex)) {
+                        element.setValue(jumpProbability * element.getValue());
+                    }
+                    
+                    bMarkovianGoal.push_back(storm::utility::zero<ValueType>());
+                    for (auto& element : transitionMatrix.getRowGroup(state)) {
+                        if (goalStates.get(element.getColumn())) {
+                            bMarkovianGoal.back() += jumpProbability * element.getValue();
+                        }
+                    }
+                    ++rowIndex;
+                }
+                std::vector<ValueType> bProbabilisticGoal = transitionMatrix.getConstrainedRowGroupSumVector(probabilisticNonGoalStates, goalStates);
+                
+                // Compute the probabilities of exactly k jumps happening until the time bound. Beyond the right
+                // truncation point, these are considered to be zero.
+                std::vector<ValueType> poissonProbabilities;
+                uint_fast64_t leftTruncationPoint = 0;
+                uint_fast64_t rightTruncationPoint = 0;
+                if (storm::utility::isZero(time * uniformizationRate)) {
+                    poissonProbabilities.push_back(storm::utility::one<ValueType>());
+                } else {
+                    ValueType accuracy = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision() / 8.0;
+                    std::tuple<uint_fast64_t, uint_fast64_t, ValueType, std::vector<ValueType>> foxGlynnResult = storm::utility::numerical::getFoxGlynnCutoff(time * uniformizationRate, 1e+300, accuracy);
+                    leftTruncationPoint = std::get<0>(foxGlynnResult);
+                    rightTruncationPoint = std::get<1>(foxGlynnResult);
+                    
+                    // Fox-Glynn only guarantees that the actual probability mass between the truncation points is at
+                    // least 1 - accuracy, so the normalized weights may overestimate the actual probabilities by a
+                    // factor of up to 1 / (1 - accuracy). Scaling them by 1 - accuracy makes them lower bounds, such
+                    // that the mass missing from the weights (accuracy) bounds the error of the computed values.
+                    ValueType weightFactor = (storm::utility::one<ValueType>() - accuracy) / std::get<2>(foxGlynnResult);
+                    poissonProbabilities.resize(rightTruncationPoint + 1, storm::utility::zero<ValueType>());
+                    for (uint_fast64_t index = leftTruncationPoint; index <= rightTruncationPoint; ++index) {
+                        poissonProbabilities[index] = std::get<3>(foxGlynnResult)[index - leftTruncationPoint] * weightFactor;
+                    }
+                }
+                STORM_LOG_INFO("Performing " << 2 * (rightTruncationPoint + 1) << " iterations (uniformization rate " << uniformizationRate << ") for time bound " << time << ".");
+                
+                // The probability that at least k jumps happen until the time bound.
+                std::vector<ValueType> poissonTailProbabilities(rightTruncationPoint + 2, storm::utility::zero<ValueType>());
+                for (uint_fast64_t index = rightTruncationPoint + 1; index > 0; --index) {
+                    poissonTailProbabilities[index - 1] = poissonTailProbabilities[index] + poissonProbabilities[index - 1];
+                }
+                
+                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = minMaxLinearEquationSolverFactory.create(aProbabilistic);
+                solver->setCachingEnabled(true);
+                
+                std::vector<ValueType> markovianValues(markovianNonGoalStates.getNumberOfSetBits());
+                std::vector<ValueType> markovianValuesSwap(markovianValues.size());
+                std::vector<ValueType> probabilisticValues(probabilisticNonGoalStates.getNumberOfSetBits());
+                std::vector<ValueType> bMarkovian(markovianValues.size());
+                std::vector<ValueType> bProbabilistic(probabilisticValues.size());
+                
+                // (1) Compute the optimal values for schedulers that only observe the number of jumps that happened so
+                // far. This proceeds backwards from the right truncation point, where the value of a Markovian state
+                // after k jumps consists of the probability that exactly k jumps happen (and the terminal value is
+                // obtained) plus the value of the successors after k + 1 jumps. Goal states reached with the k-th jump
+                // contribute the probability that at least k jumps happen.
+                for (uint_fast64_t step = rightTruncationPoint + 1; step > 0; --step) {
+                    uint_fast64_t jumps = step - 1;
+                    
+                    aMarkovian.multiplyWithVector(markovianValues, markovianValuesSwap);
+                    aMarkovianToProbabilistic.multiplyWithVector(probabilisticValues, bMarkovian);
+                    storm::utility::vector::addVectors(markovianValuesSwap, bMarkovian, markovianValuesSwap);
+                    for (uint_fast64_t index = 0; index < markovianValuesSwap.size(); ++index) {
+                        markovianValuesSwap[index] += poissonProbabilities[jumps] * jumpCountTerminalValues[index] + poissonTailProbabilities[jumps + 1] * bMarkovianGoal[index];
+                    }
+                    std::swap(markovianValues, markovianValuesSwap);
+                    
+                    aProbabilisticToMarkovian.multiplyWithVector(markovianValues, bProbabilistic);
+                    for (uint_fast64_t index = 0; index < bProbabilistic.size(); ++index) {
+                        bProbabilistic[index] += poissonTailProbabilities[jumps] * bProbabilisticGoal[index];
+                    }
+                    solver->solveEquations(dir, probabilisticValues, bProbabilistic);
+                }
+                
+                jumpCountValues = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                storm::utility::vector::setVectorValues<ValueType>(jumpCountValues, goalStates, storm::utility::one<ValueType>());
+                storm::utility::vector::setVectorValues(jumpCountValues, markovianNonGoalStates, markovianValues);
+                storm::utility::vector::setVectorValues(jumpCountValues, probabilisticNonGoalStates, probabilisticValues);
+                
+                // (2) Compute the optimal values for schedulers that know the total number of jumps that happen until
+                // the time bound. For each number of remaining jumps r, we compute the optimal value of reaching a
+                // goal state with at most r jumps (and obtaining the terminal value in the end) and weigh it with the
+                // probability of exactly r jumps happening.
+                std::vector<ValueType> markovianOracleValues(markovianValues.size(), storm::utility::zero<ValueType>());
+                std::vector<ValueType> probabilisticOracleValues(probabilisticValues.size(), storm::utility::zero<ValueType>());
+                markovianValues = oracleTerminalValues;
+                for (uint_fast64_t remainingJumps = 0; remainingJumps <= rightTruncationPoint; ++remainingJumps) {
+                    if (remainingJumps > 0) {
+                        aMarkovian.multiplyWithVector(markovianValues, markovianValuesSwap);
+                        aMarkovianToProbabilistic.multiplyWithVector(probabilisticValues, bMarkovian);
+                        storm::utility::vector::addVectors(markovianValuesSwap, bMarkovian, markovianValuesSwap);
+                        storm::utility::vector::addVectors(markovianValuesSwap, bMarkovianGoal, markovianValuesSwap);
+                        std::swap(markovianValues, markovianValuesSwap);
+                    }
+                    
+                    aProbabilisticToMarkovian.multiplyWithVector(markovianValues, bProbabilistic);
+                    storm::utility::vector::addVectors(bProbabilistic, bProbabilisticGoal, bProbabilistic);
+                    solver->solveEquations(dir, probabilisticValues, bProbabilistic);
+                    
+                    if (remainingJumps >= leftTruncationPoint) {
+                        ValueType const& weight = poissonProbabilities[remainingJumps];
+                        for (uint_fast64_t index = 0; index < markovianValues.size(); ++index) {
+                            markovianOracleValues[index] += weight * markovianValues[index];
+                        }
+                        for (uint_fast64_t index = 0; index < probabilisticValues.size(); ++index) {
+                            probabilisticOracleValues[index] += weight * probabilisticValues[index];
+                        }
+                    }
+                }
+                
+                oracleValues = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                storm::utility::vector::setVectorValues<ValueType>(oracleValues, goalStates, storm::utility::one<ValueType>());
+                storm::utility::vector::setVectorValues(oracleValues, markovianNonGoalStates, markovianOracleValues);
+                storm::utility::vector::setVectorValues(oracleValues, probabilisticNonGoalStates, probabilisticOracleValues);
+                
+                // The probability mass that is missing from the weights (the Fox-Glynn accuracy), which bounds the
+                // amount by which the values underestimate the actual ones.
+                return std::max(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>() - poissonTailProbabilities[0]);
+            }
+            
             template<typename ValueType>
             std::vector<ValueType> SparseMarkovAutomatonCslHelper<ValueType>::computeBoundedUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
+                // Tools that do not register the Markov automaton settings get the default technique (Unif+).
+                if (storm::settings::hasModule<storm::settings::modules::MarkovAutomatonSettings>() && storm::settings::getModule<storm::settings::modules::MarkovAutomatonSettings>().getBoundedReachabilityTechnique() == storm::settings::modules::MarkovAutomatonSettings::BoundedReachabilityTechnique::Imca) {
+                    return computeBoundedUntilProbabilitiesImca(dir, transitionMatrix, exitRateVector, markovianStates, psiStates, boundsPair, minMaxLinearEquationSolverFactory);
+                } else {
+                    return computeBoundedUntilProbabilitiesUnifPlus(dir, transitionMatrix, exitRateVector, markovianStates, psiStates, boundsPair, minMaxLinearEquationSolverFactory);
+                }
+            }
+            
+            template<typename ValueType>
+            std::vector<ValueType> SparseMarkovAutomatonCslHelper<ValueType>::computeBoundedUntilProbabilitiesUnifPlus(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
+                
+                uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
+                
+                // 'Unpack' the bounds to make them more easily accessible.
+                double lowerBound = boundsPair.first;
+                double upperBound = boundsPair.second;
+                STORM_LOG_THROW(!std::isinf(upperBound), storm::exceptions::InvalidPropertyException, "Unable to compute time-bounded reachability probabilities for unbounded time interval.");
+                
+                ValueType precision = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision();
+                
+                // Start with the smallest possible uniformization rate, i.e. the maximal exit rate.
+                ValueType uniformizationRate = storm::utility::zero<ValueType>();
+                for (auto state : markovianStates) {
+                    uniformizationRate = std::max(uniformizationRate, exitRateVector[state]);
+                }
+                if (storm::utility::isZero(uniformizationRate)) {
+                    uniformizationRate = storm::utility::one<ValueType>();
+                }
+                
+                storm::storage::BitVector markovianNonGoalStates = markovianStates & ~psiStates;
+                storm::storage::BitVector probabilisticNonGoalStates = ~markovianStates & ~psiStates;
+                
+                // The values of schedulers that only know the number of jumps so far and the values of schedulers that
+                // additionally know the total number of jumps until the time bound enclose the optimal value (up to the
+                // probability mass lost by truncating the Poisson distribution). If the bounds are too far apart, the
+                // uniformization rate is increased, which gives the former schedulers more information.
+                std::vector<ValueType> jumpCountValues;
+                std::vector<ValueType> oracleValues;
+                ValueType truncationError;
+                ValueType difference;
+                uint_fast64_t refinement = 0;
+                while (true) {
+                    // (1) Compute the values for reaching the goal states within time upperBound - lowerBound.
+                    std::vector<ValueType> zeroTerminalValues(markovianNonGoalStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                    truncationError = computeUniformizedBoundedReachabilityValues(dir, transitionMatrix, exitRateVector, psiStates, markovianNonGoalStates, probabilisticNonGoalStates, zeroTerminalValues, zeroTerminalValues, upperBound - lowerBound, uniformizationRate, jumpCountValues, oracleValues, minMaxLinearEquationSolverFactory);
+                    
+                    // (2) If the lower bound of the interval is non-zero, the values obtained so far are the values
+                    // that are obtained when being in a state at time lowerBound.
+                    if (lowerBound != storm::utility::zero<ValueType>()) {
+                        std::vector<ValueType> jumpCountTerminalValues = storm::utility::vector::filterVector(jumpCountValues, markovianStates);
+                        std::vector<ValueType> oracleTerminalValues = storm::utility::vector::filterVector(oracleValues, markovianStates);
+                        truncationError += computeUniformizedBoundedReachabilityValues(dir, transitionMatrix, exitRateVector, storm::storage::BitVector(numberOfStates), markovianStates, ~markovianStates, jumpCountTerminalValues, oracleTerminalValues, lowerBound, uniformizationRate, jumpCountValues, oracleValues, minMaxLinearEquationSolverFactory);
+                    }
+                    
+                    difference = storm::utility::zero<ValueType>();
+                    for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                        difference = std::max(difference, storm::utility::abs<ValueType>(jumpCountValues[state] - oracleValues[state]));
+                    }
+                    difference += truncationError;
+                    
+                    if (difference <= 2 * precision) {
+                        break;
+                    }
+                    if (refinement == MAXIMAL_NUMBER_OF_REFINEMENTS) {
+                        STORM_LOG_WARN("Time-bounded reachability probabilities are only guaranteed to be precise up to " << (difference / 2) << ".");
+                        break;
+                    }
+                    
+                    // Doubling the uniformization rate gives the schedulers that only know the number of jumps more
+                    // information while keeping the number of iterations of each round proportional to the rate.
+                    ++refinement;
+                    uniformizationRate *= 2;
+                    STORM_LOG_INFO("Values differ by up to " << difference << ", increasing the uniformization rate to " << uniformizationRate << ".");
+                }
+                
+                // Return the center of the interval enclosing the actual values.
+                std::vector<ValueType> result(numberOfStates);
+                for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                    result[state] = (std::min(jumpCountValues[state], oracleValues[state]) + std::max(jumpCountValues[state], oracleValues[state]) + truncationError) / 2;
+                }
+                return result;
+            }
+            
+            template<typename ValueType>
+            std::vector<ValueType> SparseMarkovAutomatonCslHelper<ValueType>::computeBoundedUntilProbabilitiesImca(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
 
                 uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
                
@@ -14,8 +14,29 @@ namespace storm {
             template <typename ValueType>
             class SparseMarkovAutomatonCslHelper {
             public:
+                // The maximal number of times the uniformization rate is doubled to reach the required precision.
+                static const uint_fast64_t MAXIMAL_NUMBER_OF_REFINEMENTS = 10;
+                
+                /*!
+                 * Computes the probabilities of reaching the psi states within the given time interval using the
+                 * technique selected in the Markov automaton settings.
+                 */
                 static std::vector<ValueType> computeBoundedUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory);
                 
+                /*!
+                 * Computes the time-bounded reachability probabilities by digitizing time as done by IMCA. The number
+                 * of steps grows quadratically in the time bound and the maximal exit rate.
+                 */
+                static std::vector<ValueType> computeBoundedUntilProbabilitiesImca(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory);
+                
+                /*!
+                 * Computes the time-bounded reachability probabilities based on uniformization (Unif+). Lower and upper
+                 * bounds on the optimal values are computed using Fox-Glynn truncation points and the uniformization
+                 * rate is doubled until the bounds are close enough. The number of steps grows only linearly in the
+                 * time bound and the uniformization rate.
+                 */
+                static std::vector<ValueType> computeBoundedUntilProbabilitiesUnifPlus(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory);
+                
                 static std::vector<ValueType> computeUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory);
                 
                 template <typename RewardModelType>
@@ -29,6 +50,28 @@ namespace storm {
             private:
                 static void computeBoundedReachabilityProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<ValueType>& markovianNonGoalValues, std::vector<ValueType>& probabilisticNonGoalValues, ValueType delta, uint_fast64_t numberOfSteps, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory);
                 
+                /*!
+                 * Computes the values of reaching the goal states within the given time in the uniformized Markov
+                 * automaton, both for schedulers that only observe the number of jumps so far and for schedulers that
+                 * additionally know the total number of jumps until the time bound. For maximal probabilities, the
+                 * former are lower and the latter upper bounds (and vice versa for minimal probabilities).
+                 *
+                 * @param goalStates The goal states.
+                 * @param markovianNonGoalStates The Markovian states that are no goal states.
+                 * @param probabilisticNonGoalStates The probabilistic states that are no goal states.
+                 * @param jumpCountTerminalValues The values (for the first kind of schedulers) that are obtained when
+                 * being in a Markovian non-goal state when the time bound is reached.
+                 * @param oracleTerminalValues The values (for the second kind of schedulers) that are obtained when
+                 * being in a Markovian non-goal state when the time bound is reached.
+                 * @param time The time bound.
+                 * @param uniformizationRate The uniformization rate. Needs to be at least the maximal exit rate.
+                 * @param jumpCountValues Is set to the values for the first kind of schedulers for all states.
+                 * @param oracleValues Is set to the values for the second kind of schedulers for all states.
+                 * @return The probability mass missing from the Poisson weights due to truncating the number of jumps
+                 * (the Fox-Glynn accuracy). The actual values may exceed the bounds by at most this amount.
+                 */
+                static ValueType computeUniformizedBoundedReachabilityValues(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<ValueType> const& jumpCountTerminalValues, std::vector<ValueType> const& oracleTerminalValues, ValueType time, ValueType uniformizationRate, std::vector<ValueType>& jumpCountValues, std::vector<ValueType>& oracleValues, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory);
+                
                 /*!
                  * Computes the long-run average value for the given maximal end component of a Markov automaton.
                  *
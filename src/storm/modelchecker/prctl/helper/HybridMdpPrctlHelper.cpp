@@ -24,6 +24,68 @@ namespace storm {
     namespace modelchecker {
         namespace helper {
             
+            namespace {
+                /*!
+                 * An explicit equation system consisting of a solver and the vector of the right-hand side.
+                 */
+                template<typename ValueType>
+                struct ExplicitEquationSystem {
+                    // If set, the matrix kept by the model that the solver refers to. Holding it here keeps it alive
+                    // for the lifetime of the solver, even if the model drops it in the meantime.
+                    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> matrix;
+                    
+                    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+                    std::vector<ValueType> vector;
+                };
+                
+                /*!
+                 * Creates a solver for the equation system over the given maybe states together with the vector that
+                 * contains, for each choice of the maybe states, the probability to go to a target state in one step.
+                 * If the given transition matrix is the one of the model and the model can keep its explicit transition
+                 * matrix, that matrix is filtered. Otherwise, only the part of the symbolic transition matrix belonging
+                 * to the maybe states is translated.
+                 */
+                template<storm::dd::DdType DdType, typename ValueType>
+                ExplicitEquationSystem<ValueType> createExplicitEquationSystem(storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& maybeStates, storm::dd::Bdd<DdType> const& targetStates, storm::dd::Odd const& odd, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
+                    ExplicitEquationSystem<ValueType> result;
+                    if (transitionMatrix == model.getTransitionMatrix() && model.isExplicitTransitionMatrixWithinMemoryBudget()) {
+                        // As the ODD of the maybe states orders them in the same way as the one of the reachable
+                        // states, the rows of the submatrix match the entries of the vector computed here.
+                        storm::dd::Odd const& reachableStatesOdd = model.getReachableStatesOdd();
+                        result.vector = model.getExplicitTransitionMatrix()->getConstrainedRowGroupSumVector(maybeStates.toVector(reachableStatesOdd), targetStates.toVector(reachableStatesOdd));
+                        
+                        // The solver only refers to the submatrix, so it is not copied.
+                        result.matrix = model.getExplicitTransitionSubmatrix(maybeStates);
+                        result.solver = linearEquationSolverFactory.create(*result.matrix);
+                        return result;
+                    }
+                    
+                    // Create the matrix and the vector for the equation system.
+                    storm::dd::Add<DdType, ValueType> maybeStatesAdd = maybeStates.template toAdd<ValueType>();
+                    
+                    // Start by cutting away all rows that do not belong to maybe states. Note that this leaves columns targeting
+                    // non-maybe states in the matrix.
+                    storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * maybeStatesAdd;
+                    
+                    // Then compute the vector that contains the one-step probabilities to a target state for all maybe
+                    // states.
+                    storm::dd::Add<DdType, ValueType> targetStatesAsColumn = targetStates.template toAdd<ValueType>().swapVariables(model.getRowColumnMetaVariablePairs());
+                    storm::dd::Add<DdType, ValueType> subvector = (submatrix * targetStatesAsColumn).sumAbstract(model.getColumnVariables());
+                    
+                    // Before cutting the non-maybe columns, we need to compute the sizes of the row groups.
+                    std::vector<uint_fast64_t> rowGroupSizes = submatrix.notZero().existsAbstract(model.getColumnVariables()).template toAdd<uint_fast64_t>().sumAbstract(model.getNondeterminismVariables()).toVector(odd);
+                    
+                    // Finally cut away all columns targeting non-maybe states.
+                    submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+                    
+                    // Translate the symbolic matrix/vector to their explicit representations.
+                    std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = submatrix.toMatrixVector(subvector, std::move(rowGroupSizes), model.getNondeterminismVariables(), odd, odd);
+                    result.solver = linearEquationSolverFactory.create(std::move(explicitRepresentation.first));
+                    result.vector = std::move(explicitRepresentation.second);
+                    return result;
+                }
+            }
+            
             template<storm::dd::DdType DdType, typename ValueType>
             std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUntilProbabilities(OptimizationDirection dir, storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& phiStates, storm::dd::Bdd<DdType> const& psiStates, bool qualitative, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
                 // We need to identify the states which have to be taken out of the matrix, i.e. all states that have
@@ -51,34 +113,12 @@ namespace storm {
                         // Create the ODD for the translation between symbolic and explicit storage.
                         storm::dd::Odd odd = maybeStates.createOdd();
                         
-                        // Create the matrix and the vector for the equation system.
-                        storm::dd::Add<DdType, ValueType> maybeStatesAdd = maybeStates.template toAdd<ValueType>();
-                        
-                        // Start by cutting away all rows that do not belong to maybe states. Note that this leaves columns targeting
-                        // non-maybe states in the matrix.
-                        storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * maybeStatesAdd;
-                        
-                        // Then compute the vector that contains the one-step probabilities to a state with probability 1 for all
-                        // maybe states.
-                        storm::dd::Add<DdType, ValueType> prob1StatesAsColumn = statesWithProbability01.second.template toAdd<ValueType>();
-                        prob1StatesAsColumn = prob1StatesAsColumn.swapVariables(model.getRowColumnMetaVariablePairs());
-                        storm::dd::Add<DdType, ValueType> subvector = submatrix * prob1StatesAsColumn;
-                        subvector = subvector.sumAbstract(model.getColumnVariables());
-                        
-                        // Before cutting the non-maybe columns, we need to compute the sizes of the row groups.
-                        std::vector<uint_fast64_t> rowGroupSizes = submatrix.notZero().existsAbstract(model.getColumnVariables()).template toAdd<uint_fast64_t>().sumAbstract(model.getNondeterminismVariables()).toVector(odd);
-                        
-                        // Finally cut away all columns targeting non-maybe states.
-                        submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
-                        
                         // Create the solution vector.
                         std::vector<ValueType> x(maybeStates.getNonZeroCount(), ValueType(0.5));
                         
-                        // Translate the symbolic matrix/vector to their explicit representations and solve the equation system.
-                        std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = submatrix.toMatrixVector(subvector, std::move(rowGroupSizes), model.getNondeterminismVariables(), odd, odd);
-                        
-                        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(std::move(explicitRepresentation.first));
-                        solver->solveEquations(dir, x, explicitRepresentation.second);
+                        // Create the explicit equation system and solve it.
+                        auto equationSystem = createExplicitEquationSystem(model, transitionMatrix, maybeStates, statesWithProbability01.second, odd, linearEquationSolverFactory);
+                        equationSystem.solver->solveEquations(dir, x, equationSystem.vector);
                         
                         // Return a hybrid check result that stores the numerical values explicitly.
                         return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType>(model.getReachableStates(), model.getReachableStates() && !maybeStates, statesWithProbability01.second.template toAdd<ValueType>(), maybeStates, odd, x));
@@ -117,32 +157,12 @@ namespace storm {
                     // Create the ODD for the translation between symbolic and explicit storage.
                     storm::dd::Odd odd = maybeStates.createOdd();
                     
-                    // Create the matrix and the vector for the equation system.
-                    storm::dd::Add<DdType, ValueType> maybeStatesAdd = maybeStates.template toAdd<ValueType>();
-                    
-                    // Start by cutting away all rows that do not belong to maybe states. Note that this leaves columns targeting
-                    // non-maybe states in the matrix.
-                    storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * maybeStatesAdd;
-                    
-                    // Then compute the vector that contains the one-step probabilities to a state with probability 1 for all
-                    // maybe states.
-                    storm::dd::Add<DdType, ValueType> prob1StatesAsColumn = psiStates.template toAdd<ValueType>().swapVariables(model.getRowColumnMetaVariablePairs());
-                    storm::dd::Add<DdType, ValueType> subvector = (submatrix * prob1StatesAsColumn).sumAbstract(model.getColumnVariables());
-                    
-                    // Before cutting the non-maybe columns, we need to compute the sizes of the row groups.
-                    std::vector<uint_fast64_t> rowGroupSizes = submatrix.notZero().existsAbstract(model.getColumnVariables()).template toAdd<uint_fast64_t>().sumAbstract(model.getNondeterminismVariables()).toVector(odd);
-                    
-                    // Finally cut away all columns targeting non-maybe states.
-                    submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
-                    
                     // Create the solution vector.
                     std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::zero<ValueType>());
                     
-                    // Translate the symbolic matrix/vector to their explicit representations.
-                    std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = submatrix.toMatrixVector(subvector, std::move(rowGroupSizes), model.getNondeterminismVariables(), odd, odd);
-                    
-                    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(std::move(explicitRepresentation.first));
-                    solver->repeatedMultiply(dir, x, &explicitRepresentation.second, stepBound);
+                    // Create the explicit equation system and perform the matrix-vector multiplications.
+                    auto equationSystem = createExplicitEquationSystem(model, transitionMatrix, maybeStates, psiStates, odd, linearEquationSolverFactory);
+                    equationSystem.solver->repeatedMultiply(dir, x, &equationSystem.vector, stepBound);
                     
                     // Return a hybrid check result that stores the numerical values explicitly.
                     return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType>(model.getReachableStates(), model.getReachableStates() && !maybeStates, psiStates.template toAdd<ValueType>(), maybeStates, odd, x));
@@ -159,14 +179,20 @@ namespace storm {
                 // Create the ODD for the translation between symbolic and explicit storage.
                 storm::dd::Odd odd = model.getReachableStates().createOdd();
                 
-                // Translate the symbolic matrix to its explicit representations.
-                storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
-                
                 // Create the solution vector (and initialize it to the state rewards of the model).
                 std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
                 
-                // Perform the matrix-vector multiplication.
-                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(std::move(explicitMatrix));
+                // Perform the matrix-vector multiplication. If possible, the explicit transition matrix of the model is
+                // used rather than translating the symbolic matrix.
+                // The pointer to the explicit matrix keeps it alive while the solver refers to it.
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitTransitionMatrix;
+                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+                if (transitionMatrix == model.getTransitionMatrix()) {
+                    explicitTransitionMatrix = model.getExplicitTransitionMatrix();
+                    solver = linearEquationSolverFactory.create(*explicitTransitionMatrix);
+                } else {
+                    solver = linearEquationSolverFactory.create(transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd));
+                }
                 solver->repeatedMultiply(dir, x, nullptr, stepBound);
                 
                 // Return a hybrid check result that stores the numerical values explicitly.
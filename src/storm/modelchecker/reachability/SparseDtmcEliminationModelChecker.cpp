@@ -21,6 +21,7 @@
 #include "storm/solver/stateelimination/MultiValueStateEliminator.h"
 #include "storm/solver/stateelimination/ConditionalStateEliminator.h"
 #include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
+#include "storm/solver/stateelimination/ParallelStateEliminator.h"
 #include "storm/solver/stateelimination/StaticStatePriorityQueue.h"
 #include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
 
@@ -72,7 +73,7 @@ namespace storm {
             STORM_LOG_THROW(initialStates.getNumberOfSetBits() == 1, storm::exceptions::IllegalArgumentException, "Input model is required to have exactly one initial state.");
             STORM_LOG_THROW(checkTask.isOnlyInitialStatesRelevantSet(), storm::exceptions::IllegalArgumentException, "Cannot compute long-run probabilities for all states.");
             
-            storm::storage::SparseMatrix<ValueType> backwardTransitions = this->getModel().getBackwardTransitions();
+            storm::storage::SparseMatrix<ValueType> const& backwardTransitions = this->getModel().getBackwardTransitions();
             storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowCount(), true), psiStates);
             
             std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
@@ -137,7 +138,7 @@ namespace storm {
                 ++index;
             }
             
-            storm::storage::SparseMatrix<ValueType> backwardTransitions = this->getModel().getBackwardTransitions();
+            storm::storage::SparseMatrix<ValueType> const& backwardTransitions = this->getModel().getBackwardTransitions();
             
             storm::storage::BitVector allStates(numberOfStates, true);
             maybeStates = storm::utility::graph::performProbGreater0(backwardTransitions, allStates, maybeStates);
@@ -616,7 +617,7 @@ namespace storm {
             STORM_LOG_THROW(checkTask.isOnlyInitialStatesRelevantSet(), storm::exceptions::IllegalArgumentException, "Cannot compute conditional probabilities for all states.");
             storm::storage::sparse::state_type initialState = *this->getModel().getInitialStates().begin();
             
-            storm::storage::SparseMatrix<ValueType> backwardTransitions = this->getModel().getBackwardTransitions();
+            storm::storage::SparseMatrix<ValueType> const& backwardTransitions = this->getModel().getBackwardTransitions();
             
             // Compute the 'true' psi states, i.e. those psi states that can be reached without passing through another psi state first.
             psiStates = storm::utility::graph::getReachableStates(this->getModel().getTransitionMatrix(), this->getModel().getInitialStates(), trueStates, psiStates) & psiStates;
@@ -831,7 +832,23 @@ namespace storm {
             
             std::size_t numberOfStatesToEliminate = statePriorities->size();
             STORM_LOG_DEBUG("Eliminating " << numberOfStatesToEliminate << " states using the state elimination technique." << std::endl);
-            performPrioritizedStateElimination(statePriorities, transitionMatrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+            storm::settings::modules::EliminationSettings const& eliminationSettings = storm::settings::getModule<storm::settings::modules::EliminationSettings>();
+            if (eliminationSettings.isParallelEliminationSet() && eliminationOrderIsStatic(eliminationSettings.getEliminationOrder())) {
+                // For static orders, we can determine the full order upfront and eliminate independent states concurrently.
+                std::vector<storm::storage::sparse::state_type> sortedStates;
+                sortedStates.reserve(numberOfStatesToEliminate);
+                while (statePriorities->hasNext()) {
+                    sortedStates.push_back(statePriorities->pop());
+                }
+                storm::solver::stateelimination::ParallelStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, sortedStates, values);
+                if (computeResultsForInitialStatesOnly) {
+                    stateEliminator.eliminateAll(initialStates);
+                } else {
+                    stateEliminator.eliminateAll(false);
+                }
+            } else {
+                performPrioritizedStateElimination(statePriorities, transitionMatrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+            }
             STORM_LOG_DEBUG("Eliminated " << numberOfStatesToEliminate << " states." << std::endl);
         }
         
@@ -136,8 +136,9 @@ namespace storm {
                             exitRates[state] = storm::utility::zero<ValueType>();
                         }
                     }
-                    // Remove the Markovian choices for the different model ingredients
-                    this->getTransitionMatrix() = this->getTransitionMatrix().restrictRows(keptChoices);
+                    // Remove the Markovian choices for the different model ingredients. Going through the setter drops
+                    // the caches that were derived from the old transition matrix.
+                    this->setTransitionMatrix(this->getTransitionMatrix().restrictRows(keptChoices));
                     for(auto& rewModel : this->getRewardModels()) {
                         if(rewModel.second.hasStateActionRewards()) {
                             rewModel.second.getStateActionRewardVector() = storm::utility::vector::filterVector(rewModel.second.getStateActionRewardVector(), keptChoices);
@@ -252,6 +253,9 @@ namespace storm {
                         STORM_LOG_THROW(storm::utility::isOne(this->getTransitionMatrix().getRowSum(row)), storm::exceptions::InvalidArgumentException, "Entries of transition matrix do not sum up to one for (non-Markovian) choice " << row << " of state " << state << " (sum is " << this->getTransitionMatrix().getRowSum(row) << ").");
                     }
                 }
+                
+                // The values of the matrix were modified in place, so the backward transitions are outdated.
+                this->invalidateCaches();
             }
             
             template <typename ValueType, typename RewardModelType>
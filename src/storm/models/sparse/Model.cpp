@@ -40,8 +40,70 @@ namespace storm {
             }
             
             template<typename ValueType, typename RewardModelType>
-            storm::storage::SparseMatrix<ValueType> Model<ValueType, RewardModelType>::getBackwardTransitions() const {
-                return this->getTransitionMatrix().transpose(true);
+            Model<ValueType, RewardModelType>::Model(Model<ValueType, RewardModelType> const& other) : ModelBase(other), transitionMatrix(other.transitionMatrix), stateLabeling(other.stateLabeling), rewardModels(other.rewardModels), choiceLabeling(other.choiceLabeling), qualitativeResultCache(other.qualitativeResultCache) {
+                std::lock_guard<std::mutex> lock(other.backwardTransitionsMutex);
+                backwardTransitions = other.backwardTransitions;
+            }
+            
+            template<typename ValueType, typename RewardModelType>
+            Model<ValueType, RewardModelType>& Model<ValueType, RewardModelType>::operator=(Model<ValueType, RewardModelType> const& other) {
+                if (this != &other) {
+                    ModelBase::operator=(other);
+                    transitionMatrix = other.transitionMatrix;
+                    stateLabeling = other.stateLabeling;
+                    rewardModels = other.rewardModels;
+                    choiceLabeling = other.choiceLabeling;
+                    qualitativeResultCache = other.qualitativeResultCache;
+                    std::lock(backwardTransitionsMutex, other.backwardTransitionsMutex);
+                    std::lock_guard<std::mutex> lock(backwardTransitionsMutex, std::adopt_lock);
+                    std::lock_guard<std::mutex> otherLock(other.backwardTransitionsMutex, std::adopt_lock);
+                    backwardTransitions = other.backwardTransitions;
+                }
+                return *this;
+            }
+            
+#ifndef WINDOWS
+            template<typename ValueType, typename RewardModelType>
+            Model<ValueType, RewardModelType>::Model(Model<ValueType, RewardModelType>&& other) : ModelBase(std::move(other)), transitionMatrix(std::move(other.transitionMatrix)), stateLabeling(std::move(other.stateLabeling)), rewardModels(std::move(other.rewardModels)), choiceLabeling(std::move(other.choiceLabeling)), backwardTransitions(std::move(other.backwardTransitions)), qualitativeResultCache(std::move(other.qualitativeResultCache)) {
+                // Intentionally left empty.
+            }
+            
+            template<typename ValueType, typename RewardModelType>
+            Model<ValueType, RewardModelType>& Model<ValueType, RewardModelType>::operator=(Model<ValueType, RewardModelType>&& other) {
+                if (this != &other) {
+                    ModelBase::operator=(std::move(other));
+                    transitionMatrix = std::move(other.transitionMatrix);
+                    stateLabeling = std::move(other.stateLabeling);
+                    rewardModels = std::move(other.rewardModels);
+                    choiceLabeling = std::move(other.choiceLabeling);
+                    backwardTransitions = std::move(other.backwardTransitions);
+                    qualitativeResultCache = std::move(other.qualitativeResultCache);
+                }
+                return *this;
+            }
+#endif
+            
+            template<typename ValueType, typename RewardModelType>
+            storm::storage::SparseMatrix<ValueType> const& Model<ValueType, RewardModelType>::getBackwardTransitions() const {
+                std::lock_guard<std::mutex> lock(backwardTransitionsMutex);
+                if (!backwardTransitions) {
+                    backwardTransitions = this->getTransitionMatrix().transpose(true);
+                }
+                return backwardTransitions.get();
+            }
+            
+            template<typename ValueType, typename RewardModelType>
+            storm::storage::QualitativeResultCache& Model<ValueType, RewardModelType>::getQualitativeResultCache() const {
+                return qualitativeResultCache;
+            }
+            
+            template<typename ValueType, typename RewardModelType>
+            void Model<ValueType, RewardModelType>::invalidateCaches() {
+                {
+                    std::lock_guard<std::mutex> lock(backwardTransitionsMutex);
+                    backwardTransitions = boost::none;
+                }
+                qualitativeResultCache.clear();
             }
             
             template<typename ValueType, typename RewardModelType>
@@ -296,11 +358,13 @@ namespace storm {
             template<typename ValueType, typename RewardModelType>
             void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
                 this->transitionMatrix = transitionMatrix;
+                invalidateCaches();
             }
             
             template<typename ValueType, typename RewardModelType>
             void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType>&& transitionMatrix) {
                 this->transitionMatrix = std::move(transitionMatrix);
+                invalidateCaches();
             }
             
             template<typename ValueType, typename RewardModelType>
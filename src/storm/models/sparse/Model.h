@@ -2,6 +2,7 @@
 #define STORM_MODELS_SPARSE_MODEL_H_
 
 #include <vector>
+#include <mutex>
 #include <unordered_map>
 #include <boost/container/flat_set.hpp>
 #include <boost/optional.hpp>
@@ -10,6 +11,7 @@
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/sparse/StateType.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/QualitativeResultCache.h"
 #include "storm/utility/OsDetection.h"
 
 namespace storm {
@@ -43,12 +45,12 @@ namespace storm {
                 typedef CValueType ValueType;
                 typedef CRewardModelType RewardModelType;
                 
-                Model(Model<ValueType, RewardModelType> const& other) = default;
-                Model& operator=(Model<ValueType, RewardModelType> const& other) = default;
+                Model(Model<ValueType, RewardModelType> const& other);
+                Model& operator=(Model<ValueType, RewardModelType> const& other);
                 
 #ifndef WINDOWS
-                Model(Model<ValueType, RewardModelType>&& other) = default;
-                Model& operator=(Model<ValueType, RewardModelType>&& other) = default;
+                Model(Model<ValueType, RewardModelType>&& other);
+                Model& operator=(Model<ValueType, RewardModelType>&& other);
 #endif
                 
                 /*!
@@ -83,11 +85,29 @@ namespace storm {
                                 
                 /*!
                  * Retrieves the backward transition relation of the model, i.e. a set of transitions between states
-                 * that correspond to the reversed transition relation of this model.
+                 * that correspond to the reversed transition relation of this model. The backward transitions are
+                 * computed upon the first call and kept until the caches of the model are invalidated. Concurrent
+                 * calls are safe, but the returned reference only stays valid until the caches are invalidated.
                  *
                  * @return A sparse matrix that represents the backward transitions of this model.
                  */
-                storm::storage::SparseMatrix<ValueType> getBackwardTransitions() const;
+                storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions() const;
+                
+                /*!
+                 * Retrieves the cache for the results of qualitative analyses (like prob0/prob1 precomputations) of
+                 * this model. The results are kept until the caches of the model are invalidated.
+                 *
+                 * @return The cache for the results of qualitative analyses.
+                 */
+                storm::storage::QualitativeResultCache& getQualitativeResultCache() const;
+                
+                /*!
+                 * Drops the backward transitions and the results of qualitative analyses that were computed for this
+                 * model. This needs to be called whenever the transition matrix is modified in place (for example
+                 * through the non-constant getter). The setters of the transition matrix invalidate the caches
+                 * themselves. References to the backward transitions obtained before become invalid.
+                 */
+                void invalidateCaches();
                 
                 /*!
                  * Returns an object representing the matrix rows associated with the given state.
@@ -142,7 +162,8 @@ namespace storm {
                 storm::storage::SparseMatrix<ValueType> const& getTransitionMatrix() const;
                 
                 /*!
-                 * Retrieves the matrix representing the transitions of the model.
+                 * Retrieves the matrix representing the transitions of the model. This does not invalidate the
+                 * caches of the model, so callers that modify the matrix have to call invalidateCaches afterwards.
                  *
                  * @return A matrix representing the transitions of the model.
                  */
@@ -370,6 +391,15 @@ namespace storm {
                 
                 // If set, a vector representing the labels of choices.
                 boost::optional<std::vector<LabelSet>> choiceLabeling;
+                
+                // If set, the backward transitions of the model.
+                mutable boost::optional<storm::storage::SparseMatrix<ValueType>> backwardTransitions;
+                
+                // Guards the lazy construction of the backward transitions.
+                mutable std::mutex backwardTransitionsMutex;
+                
+                // The results of qualitative analyses of the model.
+                mutable storm::storage::QualitativeResultCache qualitativeResultCache;
             };
             
 #ifdef STORM_HAVE_CARL
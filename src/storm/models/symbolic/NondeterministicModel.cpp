@@ -1,8 +1,11 @@
 #include "storm/models/symbolic/NondeterministicModel.h"
 
+#include <algorithm>
+
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/BitVector.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
 
@@ -28,12 +31,52 @@ namespace storm {
                                                                           std::set<storm::expressions::Variable> const& nondeterminismVariables,
                                                                           std::map<std::string, storm::expressions::Expression> labelToExpressionMap,
                                                                           std::unordered_map<std::string, RewardModelType> const& rewardModels)
-            : Model<Type, ValueType>(modelType, manager, reachableStates, initialStates, deadlockStates, transitionMatrix, rowVariables, rowExpressionAdapter, columnVariables, columnExpressionAdapter, rowColumnMetaVariablePairs, labelToExpressionMap, rewardModels), nondeterminismVariables(nondeterminismVariables) {
+            : Model<Type, ValueType>(modelType, manager, reachableStates, initialStates, deadlockStates, transitionMatrix, rowVariables, rowExpressionAdapter, columnVariables, columnExpressionAdapter, rowColumnMetaVariablePairs, labelToExpressionMap, rewardModels), nondeterminismVariables(nondeterminismVariables), explicitRepresentationMemoryBudget(DEFAULT_EXPLICIT_REPRESENTATION_MEMORY_BUDGET), explicitTransitionMatrixSizeInBytes(0) {
                 
                 // Prepare the mask of illegal nondeterministic choices.
                 illegalMask = !(transitionMatrix.notZero().existsAbstract(this->getColumnVariables())) && reachableStates;
             }
             
+            template<storm::dd::DdType Type, typename ValueType>
+            NondeterministicModel<Type, ValueType>::NondeterministicModel(NondeterministicModel<Type, ValueType> const& other) : Model<Type, ValueType>(other), illegalMask(other.illegalMask), nondeterminismVariables(other.nondeterminismVariables), explicitRepresentationMemoryBudget(other.explicitRepresentationMemoryBudget), explicitTransitionMatrixSizeInBytes(0) {
+                // Intentionally left empty.
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            NondeterministicModel<Type, ValueType>& NondeterministicModel<Type, ValueType>::operator=(NondeterministicModel<Type, ValueType> const& other) {
+                if (this != &other) {
+                    Model<Type, ValueType>::operator=(other);
+                    illegalMask = other.illegalMask;
+                    nondeterminismVariables = other.nondeterminismVariables;
+                    
+                    std::lock_guard<std::mutex> lock(explicitRepresentationsMutex);
+                    explicitRepresentationMemoryBudget = other.explicitRepresentationMemoryBudget;
+                    explicitlyRepresentedTransitionMatrix = boost::none;
+                }
+                return *this;
+            }
+            
+#ifndef WINDOWS
+            template<storm::dd::DdType Type, typename ValueType>
+            NondeterministicModel<Type, ValueType>::NondeterministicModel(NondeterministicModel<Type, ValueType>&& other) : Model<Type, ValueType>(std::move(other)), illegalMask(std::move(other.illegalMask)), nondeterminismVariables(std::move(other.nondeterminismVariables)), explicitRepresentationMemoryBudget(other.explicitRepresentationMemoryBudget), explicitTransitionMatrixSizeInBytes(0) {
+                // Intentionally left empty.
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            NondeterministicModel<Type, ValueType>& NondeterministicModel<Type, ValueType>::operator=(NondeterministicModel<Type, ValueType>&& other) {
+                if (this != &other) {
+                    Model<Type, ValueType>::operator=(std::move(other));
+                    illegalMask = std::move(other.illegalMask);
+                    nondeterminismVariables = std::move(other.nondeterminismVariables);
+                    
+                    std::lock_guard<std::mutex> lock(explicitRepresentationsMutex);
+                    explicitRepresentationMemoryBudget = other.explicitRepresentationMemoryBudget;
+                    explicitlyRepresentedTransitionMatrix = boost::none;
+                }
+                return *this;
+            }
+#endif
+            
             template<storm::dd::DdType Type, typename ValueType>
             uint_fast64_t NondeterministicModel<Type, ValueType>::getNumberOfChoices() const {
                 std::set<storm::expressions::Variable> rowAndNondeterminismVariables;
@@ -59,6 +102,153 @@ namespace storm {
                 return !transitionMatrixBdd && transitionMatrixBdd.existsAbstract(this->getColumnVariables());
             }
             
+            template<storm::dd::DdType Type, typename ValueType>
+            const uint_fast64_t NondeterministicModel<Type, ValueType>::NUMBER_OF_CACHED_SUBMATRICES;
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            const uint_fast64_t NondeterministicModel<Type, ValueType>::DEFAULT_EXPLICIT_REPRESENTATION_MEMORY_BUDGET;
+            
+            namespace {
+                /*!
+                 * Estimates the number of bytes occupied by a matrix with the given dimensions.
+                 */
+                template<typename ValueType>
+                uint_fast64_t getSizeInBytes(uint_fast64_t entryCount, uint_fast64_t rowCount, uint_fast64_t rowGroupCount) {
+                    typedef typename storm::storage::SparseMatrix<ValueType>::index_type IndexType;
+                    return sizeof(storm::storage::SparseMatrix<ValueType>) + entryCount * sizeof(storm::storage::MatrixEntry<IndexType, ValueType>) + (rowCount + rowGroupCount + 2) * sizeof(IndexType);
+                }
+                
+                /*!
+                 * Estimates the number of bytes occupied by the given matrix.
+                 */
+                template<typename ValueType>
+                uint_fast64_t getSizeInBytes(storm::storage::SparseMatrix<ValueType> const& matrix) {
+                    return getSizeInBytes<ValueType>(matrix.getEntryCount(), matrix.getRowCount(), matrix.getRowGroupCount());
+                }
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            void NondeterministicModel<Type, ValueType>::checkExplicitRepresentationsValid() const {
+                if (!explicitlyRepresentedTransitionMatrix || !(explicitlyRepresentedTransitionMatrix.get() == this->getTransitionMatrix())) {
+                    reachableStatesOdd = boost::none;
+                    explicitTransitionMatrix.reset();
+                    explicitTransitionMatrixSizeInBytes = 0;
+                    estimatedExplicitTransitionMatrixSizeInBytes = boost::none;
+                    explicitTransitionSubmatrices.clear();
+                    explicitlyRepresentedTransitionMatrix = this->getTransitionMatrix();
+                }
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            storm::dd::Odd const& NondeterministicModel<Type, ValueType>::getReachableStatesOdd() const {
+                std::lock_guard<std::mutex> lock(explicitRepresentationsMutex);
+                checkExplicitRepresentationsValid();
+                return getReachableStatesOddUnlocked();
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            storm::dd::Odd const& NondeterministicModel<Type, ValueType>::getReachableStatesOddUnlocked() const {
+                if (!reachableStatesOdd) {
+                    reachableStatesOdd = this->getReachableStates().createOdd();
+                }
+                return reachableStatesOdd.get();
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> NondeterministicModel<Type, ValueType>::getExplicitTransitionMatrix() const {
+                std::lock_guard<std::mutex> lock(explicitRepresentationsMutex);
+                checkExplicitRepresentationsValid();
+                return getExplicitTransitionMatrixUnlocked();
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> NondeterministicModel<Type, ValueType>::getExplicitTransitionMatrixUnlocked() const {
+                if (explicitTransitionMatrix) {
+                    return explicitTransitionMatrix;
+                }
+                
+                storm::dd::Odd const& odd = this->getReachableStatesOddUnlocked();
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> matrix = std::make_shared<storm::storage::SparseMatrix<ValueType>>(this->getTransitionMatrix().toMatrix(this->getNondeterminismVariables(), odd, odd));
+                uint_fast64_t matrixSizeInBytes = getSizeInBytes(*matrix);
+                estimatedExplicitTransitionMatrixSizeInBytes = matrixSizeInBytes;
+                if (matrixSizeInBytes <= explicitRepresentationMemoryBudget) {
+                    explicitTransitionMatrix = matrix;
+                    explicitTransitionMatrixSizeInBytes = matrixSizeInBytes;
+                    enforceExplicitRepresentationMemoryBudget();
+                }
+                return matrix;
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            bool NondeterministicModel<Type, ValueType>::isExplicitTransitionMatrixWithinMemoryBudget() const {
+                std::lock_guard<std::mutex> lock(explicitRepresentationsMutex);
+                checkExplicitRepresentationsValid();
+                return getExplicitTransitionMatrixSizeInBytesUnlocked() <= explicitRepresentationMemoryBudget;
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            uint_fast64_t NondeterministicModel<Type, ValueType>::getExplicitTransitionMatrixSizeInBytesUnlocked() const {
+                if (!estimatedExplicitTransitionMatrixSizeInBytes) {
+                    // Every non-zero entry of the symbolic matrix becomes an entry of the explicit matrix and every
+                    // choice becomes a row.
+                    estimatedExplicitTransitionMatrixSizeInBytes = getSizeInBytes<ValueType>(this->getTransitionMatrix().getNonZeroCount(), this->getNumberOfChoices(), this->getNumberOfStates());
+                }
+                return estimatedExplicitTransitionMatrixSizeInBytes.get();
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> NondeterministicModel<Type, ValueType>::getExplicitTransitionSubmatrix(storm::dd::Bdd<Type> const& states) const {
+                std::lock_guard<std::mutex> lock(explicitRepresentationsMutex);
+                checkExplicitRepresentationsValid();
+                
+                auto it = std::find_if(explicitTransitionSubmatrices.begin(), explicitTransitionSubmatrices.end(), [&states] (ExplicitTransitionSubmatrix const& entry) { return entry.states == states; });
+                if (it != explicitTransitionSubmatrices.end()) {
+                    // Move the entry to the front, as it was used most recently.
+                    std::rotate(explicitTransitionSubmatrices.begin(), it, it + 1);
+                    return explicitTransitionSubmatrices.front().matrix;
+                }
+                
+                // Since the ODD of the given states orders them in the same way as the ODD of the reachable states,
+                // restricting the explicit transition matrix to the given states yields the desired submatrix.
+                storm::storage::BitVector explicitStates = states.toVector(this->getReachableStatesOddUnlocked());
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> submatrix = std::make_shared<storm::storage::SparseMatrix<ValueType>>(this->getExplicitTransitionMatrixUnlocked()->getSubmatrix(true, explicitStates, explicitStates));
+                uint_fast64_t submatrixSizeInBytes = getSizeInBytes(*submatrix);
+                if (explicitTransitionMatrixSizeInBytes + submatrixSizeInBytes <= explicitRepresentationMemoryBudget) {
+                    explicitTransitionSubmatrices.insert(explicitTransitionSubmatrices.begin(), ExplicitTransitionSubmatrix{states, submatrix, submatrixSizeInBytes});
+                    enforceExplicitRepresentationMemoryBudget();
+                }
+                return submatrix;
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            uint_fast64_t NondeterministicModel<Type, ValueType>::getExplicitRepresentationMemoryBudget() const {
+                std::lock_guard<std::mutex> lock(explicitRepresentationsMutex);
+                return explicitRepresentationMemoryBudget;
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            void NondeterministicModel<Type, ValueType>::setExplicitRepresentationMemoryBudget(uint_fast64_t memoryBudget) {
+                std::lock_guard<std::mutex> lock(explicitRepresentationsMutex);
+                explicitRepresentationMemoryBudget = memoryBudget;
+                enforceExplicitRepresentationMemoryBudget();
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            void NondeterministicModel<Type, ValueType>::enforceExplicitRepresentationMemoryBudget() const {
+                uint_fast64_t sizeInBytes = explicitTransitionMatrixSizeInBytes;
+                for (auto const& entry : explicitTransitionSubmatrices) {
+                    sizeInBytes += entry.sizeInBytes;
+                }
+                while (!explicitTransitionSubmatrices.empty() && (explicitTransitionSubmatrices.size() > NUMBER_OF_CACHED_SUBMATRICES || sizeInBytes > explicitRepresentationMemoryBudget)) {
+                    sizeInBytes -= explicitTransitionSubmatrices.back().sizeInBytes;
+                    explicitTransitionSubmatrices.pop_back();
+                }
+                if (sizeInBytes > explicitRepresentationMemoryBudget) {
+                    explicitTransitionMatrix.reset();
+                    explicitTransitionMatrixSizeInBytes = 0;
+                }
+            }
+            
             template<storm::dd::DdType Type, typename ValueType>
             void NondeterministicModel<Type, ValueType>::printModelInformationToStream(std::ostream& out) const {
                 this->printModelInformationHeaderToStream(out);
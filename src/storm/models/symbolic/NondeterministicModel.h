@@ -1,7 +1,15 @@
 #ifndef STORM_MODELS_SYMBOLIC_NONDETERMINISTICMODEL_H_
 #define STORM_MODELS_SYMBOLIC_NONDETERMINISTICMODEL_H_
 
+#include <vector>
+#include <mutex>
+#include <memory>
+
 #include "storm/models/symbolic/Model.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/Odd.h"
+#include "storm/storage/SparseMatrix.h"
 #include "storm/utility/OsDetection.h"
 
 namespace storm {
@@ -16,12 +24,14 @@ namespace storm {
             public:
                 typedef typename Model<Type, ValueType>::RewardModelType RewardModelType;
 
-                NondeterministicModel(NondeterministicModel<Type, ValueType> const& other) = default;
-                NondeterministicModel& operator=(NondeterministicModel<Type, ValueType> const& other) = default;
+                // The explicit representations kept by a model are not transferred by copying or moving it. They are
+                // recomputed upon request.
+                NondeterministicModel(NondeterministicModel<Type, ValueType> const& other);
+                NondeterministicModel& operator=(NondeterministicModel<Type, ValueType> const& other);
                 
 #ifndef WINDOWS
-                NondeterministicModel(NondeterministicModel<Type, ValueType>&& other) = default;
-                NondeterministicModel& operator=(NondeterministicModel<Type, ValueType>&& other) = default;
+                NondeterministicModel(NondeterministicModel<Type, ValueType>&& other);
+                NondeterministicModel& operator=(NondeterministicModel<Type, ValueType>&& other);
 #endif
                 
                 /*!
@@ -87,8 +97,71 @@ namespace storm {
                  */
                 storm::dd::Bdd<Type> getIllegalSuccessorMask() const;
                 
+                /*!
+                 * Retrieves the ODD of the reachable states of the model. The ODD is computed upon the first call and
+                 * kept until the transition matrix of the model is replaced.
+                 *
+                 * @return The ODD of the reachable states.
+                 */
+                storm::dd::Odd const& getReachableStatesOdd() const;
+                
+                /*!
+                 * Retrieves the explicit representation of the transition matrix of the model, whose row groups and
+                 * columns are ordered according to the ODD of the reachable states. The matrix is translated upon the
+                 * first call and kept until the transition matrix of the model is replaced, provided it fits into the
+                 * memory budget for explicit representations.
+                 *
+                 * @return The explicit transition matrix. It stays valid as long as the pointer is held, even if the
+                 * model drops it.
+                 */
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getExplicitTransitionMatrix() const;
+                
+                /*!
+                 * Retrieves whether the explicit transition matrix fits into the memory budget for explicit
+                 * representations, i.e. whether the model keeps it once it is translated. The size of the matrix is
+                 * estimated from the symbolic transition matrix, so the explicit matrix is not translated by this call.
+                 * If it does not fit, callers that only need a part of the transitions should translate that part
+                 * directly rather than going through the explicit (sub)matrices of the model.
+                 *
+                 * @return True iff the explicit transition matrix fits into the memory budget.
+                 */
+                bool isExplicitTransitionMatrixWithinMemoryBudget() const;
+                
+                /*!
+                 * Retrieves the explicit representation of the transitions between the given states, i.e. the row
+                 * groups of the given states restricted to the columns of the given states. Row groups and columns are
+                 * ordered according to the ODD of the given states. Rather than translating the symbolic transition
+                 * matrix, the submatrix is obtained by filtering the explicit transition matrix. The most recently
+                 * requested submatrices are kept as long as they fit into the memory budget for explicit
+                 * representations, so that queries sharing the same set of states can reuse them. Note that this
+                 * translates the full transition matrix if it is not kept, see isExplicitTransitionMatrixWithinMemoryBudget.
+                 *
+                 * @param states The (reachable) states whose transitions to retrieve.
+                 * @return The explicit submatrix. It stays valid as long as the pointer is held, even if the model
+                 * drops it.
+                 */
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getExplicitTransitionSubmatrix(storm::dd::Bdd<Type> const& states) const;
+                
+                /*!
+                 * Retrieves the maximal number of bytes occupied by the explicit matrices kept by the model.
+                 */
+                uint_fast64_t getExplicitRepresentationMemoryBudget() const;
+                
+                /*!
+                 * Sets the maximal number of bytes occupied by the explicit matrices kept by the model. If necessary,
+                 * the least recently used submatrices (and then the explicit transition matrix) are dropped. A budget of
+                 * zero disables keeping explicit matrices.
+                 */
+                void setExplicitRepresentationMemoryBudget(uint_fast64_t memoryBudget);
+                
                 virtual void printModelInformationToStream(std::ostream& out) const override;
                 
+                // The maximal number of explicit submatrices that are kept by the model.
+                static const uint_fast64_t NUMBER_OF_CACHED_SUBMATRICES = 4;
+                
+                // The default memory budget for the explicit matrices kept by the model (in bytes).
+                static const uint_fast64_t DEFAULT_EXPLICIT_REPRESENTATION_MEMORY_BUDGET = 256 * 1024 * 1024;
+                
             protected:
             
                 virtual void printDdVariableInformationToStream(std::ostream& out) const override;
@@ -101,6 +174,68 @@ namespace storm {
                 // The meta variables encoding the nondeterminism in the model.
                 std::set<storm::expressions::Variable> nondeterminismVariables;
                 
+                /*!
+                 * Drops the explicit representations if the transition matrix was replaced since they were computed. The
+                 * caller has to hold the lock of the explicit representations.
+                 */
+                void checkExplicitRepresentationsValid() const;
+                
+                /*!
+                 * Retrieves the ODD of the reachable states. The caller has to hold the lock of the explicit
+                 * representations.
+                 */
+                storm::dd::Odd const& getReachableStatesOddUnlocked() const;
+                
+                /*!
+                 * Retrieves the explicit transition matrix. The caller has to hold the lock of the explicit
+                 * representations.
+                 */
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getExplicitTransitionMatrixUnlocked() const;
+                
+                /*!
+                 * Retrieves the (estimated) number of bytes occupied by the explicit transition matrix. The caller has
+                 * to hold the lock of the explicit representations.
+                 */
+                uint_fast64_t getExplicitTransitionMatrixSizeInBytesUnlocked() const;
+                
+                /*!
+                 * Drops the least recently used submatrices (and then the explicit transition matrix) until the kept
+                 * matrices do not exceed the memory budget. The caller has to hold the lock of the explicit
+                 * representations.
+                 */
+                void enforceExplicitRepresentationMemoryBudget() const;
+                
+                // An explicit submatrix kept by the model together with the states defining it.
+                struct ExplicitTransitionSubmatrix {
+                    storm::dd::Bdd<Type> states;
+                    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> matrix;
+                    uint_fast64_t sizeInBytes;
+                };
+                
+                // The maximal number of bytes occupied by the kept explicit matrices.
+                uint_fast64_t explicitRepresentationMemoryBudget;
+                
+                // The transition matrix from which the explicit representations were computed (if any).
+                mutable boost::optional<storm::dd::Add<Type, ValueType>> explicitlyRepresentedTransitionMatrix;
+                
+                // If set, the ODD of the reachable states.
+                mutable boost::optional<storm::dd::Odd> reachableStatesOdd;
+                
+                // If set, the explicit representation of the transition matrix.
+                mutable std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitTransitionMatrix;
+                
+                // The number of bytes occupied by the explicit transition matrix (if it is kept).
+                mutable uint_fast64_t explicitTransitionMatrixSizeInBytes;
+                
+                // If set, the number of bytes occupied by the explicit transition matrix, regardless of whether it is kept.
+                mutable boost::optional<uint_fast64_t> estimatedExplicitTransitionMatrixSizeInBytes;
+                
+                // The most recently requested explicit submatrices. The most recently used submatrix comes first.
+                mutable std::vector<ExplicitTransitionSubmatrix> explicitTransitionSubmatrices;
+                
+                // Guards the explicit representations above, as they are computed lazily.
+                mutable std::mutex explicitRepresentationsMutex;
+                
             };
             
         } // namespace symbolic
@@ -24,6 +24,7 @@
 #include "storm/settings/modules/GmmxxEquationSolverSettings.h"
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
 #include "storm/settings/modules/EliminationSettings.h"
+#include "storm/settings/modules/MarkovAutomatonSettings.h"
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
 #include "storm/settings/modules/BisimulationSettings.h"
 #include "storm/settings/modules/GlpkSettings.h"
@@ -330,6 +331,10 @@ namespace storm {
             return *moduleIterator->second;
         }
         
+        bool SettingsManager::hasModule(std::string const& moduleName) const {
+            return this->modules.find(moduleName) != this->modules.end();
+        }
+        
         bool SettingsManager::isCompatible(std::shared_ptr<Option> const& option, std::string const& optionName, std::unordered_map<std::string, std::vector<std::shared_ptr<Option>>> const& optionMap) {
             auto optionIterator = optionMap.find(optionName);
             if (optionIterator != optionMap.end()) {
@@ -535,6 +540,7 @@ namespace storm {
             storm::settings::addModule<storm::settings::modules::JaniExportSettings>();
             storm::settings::addModule<storm::settings::modules::JitBuilderSettings>();
             storm::settings::addModule<storm::settings::modules::MultiObjectiveSettings>();
+            storm::settings::addModule<storm::settings::modules::MarkovAutomatonSettings>();
         }
 
     }
@@ -119,6 +119,14 @@ namespace storm {
              */
             modules::ModuleSettings& getModule(std::string const& moduleName);
             
+            /*!
+             * Retrieves whether a module with the given name was registered.
+             *
+             * @param moduleName The name of the module.
+             * @return True iff the module was registered.
+             */
+            bool hasModule(std::string const& moduleName) const;
+            
         private:
 			/*!
 			 * Constructs a new manager. This constructor is private to forbid instantiation of this class. The only
@@ -261,6 +269,18 @@ namespace storm {
             return dynamic_cast<SettingsType const&>(manager().getModule(SettingsType::moduleName));
         }
         
+        /*!
+         * Retrieves whether the module given as a template argument was registered. Tools that only register a subset
+         * of the modules can use this to fall back to defaults for the missing ones.
+         *
+         * @return True iff the module was registered.
+         */
+        template<typename SettingsType>
+        bool hasModule() {
+            static_assert(std::is_base_of<storm::settings::modules::ModuleSettings, SettingsType>::value, "Template argument must be derived from ModuleSettings");
+            return manager().hasModule(SettingsType::moduleName);
+        }
+        
         /*!
          * Retrieves the core settings in a mutable form. This is only meant to be used for debug purposes or very
          * rare cases where it is necessary.
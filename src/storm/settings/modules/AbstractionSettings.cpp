@@ -79,6 +79,14 @@ namespace storm {
                 return this->getOption(addAllGuardsOptionName).getArgumentByName("value").getValueAsString() == "on";
             }
             
+            void AbstractionSettings::setUseDecomposition(bool value) {
+                if (value) {
+                    this->set(useDecompositionOptionName);
+                } else {
+                    this->unset(useDecompositionOptionName);
+                }
+            }
+            
             void AbstractionSettings::setAddAllGuards(bool value) {
                 this->getOption(addAllGuardsOptionName).getArgumentByName("value").setFromStringValue(value ? "on" : "off");
             }
@@ -35,6 +35,14 @@ namespace storm {
                  */
                 bool isUseDecompositionSet() const;
                 
+                /*!
+                 * Sets whether the option to use the decomposition is set. Note that restoring the defaults does not
+                 * unset the option.
+                 *
+                 * @param value The new value.
+                 */
+                void setUseDecomposition(bool value);
+                
                 /*!
                  * Retrieves the selected split mode.
                  *
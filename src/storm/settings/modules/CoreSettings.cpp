@@ -31,6 +31,9 @@ namespace storm {
             const std::string CoreSettings::engineOptionShortName = "e";
             const std::string CoreSettings::ddLibraryOptionName = "ddlib";
             const std::string CoreSettings::cudaOptionName = "cuda";
+            const std::string CoreSettings::threadCountOptionName = "threads";
+            const std::string CoreSettings::compactMatrixOptionName = "compactmatrix";
+            const std::string CoreSettings::simdOptionName = "simd";
             
             CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(CoreSettings::Engine::Sparse) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, counterexampleOptionName, false, "Generates a counterexample for the given PRCTL formulas if not satisfied by the model.").setShortName(counterexampleOptionShortName).build());
@@ -40,7 +43,7 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, engineOptionName, false, "Sets which engine is used for model building and model checking.").setShortName(engineOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the engine to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(engines)).setDefaultValueString("sparse").build()).build());
                 
-                std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination"};
+                std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination", "topological"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, eqSolverOptionName, false, "Sets which solver is preferred for solving systems of linear equations.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the solver to prefer.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(linearEquationSolver)).setDefaultValueString("gmm++").build()).build());
                 
@@ -56,6 +59,12 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of an SMT solver.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(smtSolvers)).setDefaultValueString("z3").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, statisticsOptionName, false, "Sets whether to display statistics if available.").setShortName(statisticsOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, cudaOptionName, false, "Sets whether to use CUDA.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, false, "Sets the number of threads used by storm's built-in parallel numerical kernels.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').").setDefaultValueUnsignedInteger(1).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, compactMatrixOptionName, false, "Sets whether iterative solvers use a copy of the matrix with 32-bit indices for their matrix-vector multiplications. This speeds up the multiplications. Min/max solvers only release the original matrix if they own it and use value iteration.").build());
+                std::vector<std::string> instructionSets = {"auto", "none", "avx2", "avx512"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, simdOptionName, false, "Sets which vector instruction set the matrix-vector multiplications of compact matrices use.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the instruction set ('auto' selects the best one supported by the machine).").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(instructionSets)).setDefaultValueString("auto").build()).build());
             }
 
             bool CoreSettings::isCounterexampleSet() const {
@@ -80,6 +89,8 @@ namespace storm {
                     return storm::solver::EquationSolverType::Eigen;
                 } else if (equationSolverName == "elimination") {
                     return storm::solver::EquationSolverType::Elimination;
+                } else if (equationSolverName == "topological") {
+                    return storm::solver::EquationSolverType::Topological;
                 }
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown equation solver '" << equationSolverName << "'.");
             }
@@ -125,6 +136,28 @@ namespace storm {
                 return this->getOption(cudaOptionName).getHasOptionBeenSet();
             }
             
+            uint_fast64_t CoreSettings::getNumberOfThreads() const {
+                return this->getOption(threadCountOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            bool CoreSettings::isUseCompactMatrixSet() const {
+                return this->getOption(compactMatrixOptionName).getHasOptionBeenSet();
+            }
+            
+            storm::utility::simd::InstructionSet CoreSettings::getSimdInstructionSet() const {
+                std::string instructionSetName = this->getOption(simdOptionName).getArgumentByName("name").getValueAsString();
+                if (instructionSetName == "auto") {
+                    return storm::utility::simd::getSupportedInstructionSet();
+                } else if (instructionSetName == "none") {
+                    return storm::utility::simd::InstructionSet::None;
+                } else if (instructionSetName == "avx2") {
+                    return storm::utility::simd::InstructionSet::Avx2;
+                } else if (instructionSetName == "avx512") {
+                    return storm::utility::simd::InstructionSet::Avx512;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown instruction set '" << instructionSetName << "'.");
+            }
+            
             CoreSettings::Engine CoreSettings::getEngine() const {
                 return engine;
             }
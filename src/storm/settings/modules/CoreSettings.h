@@ -5,6 +5,7 @@
 #include "storm/settings/modules/ModuleSettings.h"
 
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/utility/simd.h"
 
 namespace storm {
     namespace solver {
@@ -116,6 +117,29 @@ namespace storm {
                  */
                 bool isCudaSet() const;
 
+                /*!
+                 * Retrieves the number of threads that storm's built-in parallel kernels may use.
+                 *
+                 * @return The number of threads (0 means 'auto-detect').
+                 */
+                uint_fast64_t getNumberOfThreads() const;
+
+                /*!
+                 * Retrieves whether iterative solvers are to perform their matrix-vector multiplications on a copy of
+                 * the matrix that uses 32-bit indices.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isUseCompactMatrixSet() const;
+
+                /*!
+                 * Retrieves the vector instruction set that the matrix-vector multiplications of compact matrices are
+                 * to use.
+                 *
+                 * @return The instruction set.
+                 */
+                storm::utility::simd::InstructionSet getSimdInstructionSet() const;
+
                 /*!
                  * Retrieves the selected engine.
                  *
@@ -151,6 +175,9 @@ namespace storm {
                 static const std::string engineOptionShortName;
                 static const std::string ddLibraryOptionName;
                 static const std::string cudaOptionName;
+                static const std::string threadCountOptionName;
+                static const std::string compactMatrixOptionName;
+                static const std::string simdOptionName;
             };
 
         } // namespace modules
@@ -15,7 +15,7 @@ namespace storm {
                 /*!
                  * An enum that contains all available state elimination orders.
                  */
-                enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression };
+                enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression, MinimumDegree };
 				
                 /*!
                  * An enum that contains all available elimination methods.
@@ -61,6 +61,14 @@ namespace storm {
                  * @return True iff the option was set.
                  */
                 bool isUseDedicatedModelCheckerSet() const;
+                
+                /*!
+                 * Retrieves whether independent states are to be eliminated concurrently. This only affects static
+                 * elimination orders.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isParallelEliminationSet() const;
 				
                 const static std::string moduleName;
                 
@@ -70,6 +78,7 @@ namespace storm {
                 const static std::string entryStatesLastOptionName;
                 const static std::string maximalSccSizeOptionName;
                 const static std::string useDedicatedModelCheckerOptionName;
+                const static std::string parallelEliminationOptionName;
             };
             
         } // namespace modules
@@ -31,6 +31,7 @@ namespace storm {
             const std::string GeneralSettings::parametricOptionName = "parametric";
             const std::string GeneralSettings::parametricRegionOptionName = "parametricRegion";
             const std::string GeneralSettings::exactOptionName = "exact";
+            const std::string GeneralSettings::soundOptionName = "sound";
 
             GeneralSettings::GeneralSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, helpOptionName, false, "Shows all available options, arguments and descriptions.").setShortName(helpOptionShortName)
@@ -45,6 +46,7 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, bisimulationOptionName, false, "Sets whether to perform bisimulation minimization.").setShortName(bisimulationOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, parametricOptionName, false, "Sets whether to enable parametric model checking.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exactOptionName, false, "Sets whether to enable exact model checking.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, soundOptionName, false, "Sets whether iterative solvers are to guarantee that the result is within the precision (by iterating lower and upper bounds).").build());
             }
             
             bool GeneralSettings::isHelpSet() const {
@@ -92,6 +94,10 @@ namespace storm {
                 return this->getOption(exactOptionName).getHasOptionBeenSet();
             }
             
+            bool GeneralSettings::isSoundSet() const {
+                return this->getOption(soundOptionName).getHasOptionBeenSet();
+            }
+            
             void GeneralSettings::finalize() {
                 // Intentionally left empty.
             }
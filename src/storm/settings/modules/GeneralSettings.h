@@ -105,6 +105,13 @@ namespace storm {
                  * @return True iff the option was set.
                  */
                 bool isExactSet() const;
+                
+                /*!
+                 * Retrieves whether the option enforcing sound iterative solving is set.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isSoundSet() const;
 
                 bool check() const override;
                 void finalize() override;
@@ -132,6 +139,7 @@ namespace storm {
                 static const std::string parametricRegionOptionName;
 
                 static const std::string exactOptionName;
+                static const std::string soundOptionName;
             };
 
         } // namespace modules
@@ -29,6 +29,8 @@ namespace storm {
             const std::string IOSettings::explorationOrderOptionShortName = "eo";
             const std::string IOSettings::explorationChecksOptionName = "explchecks";
             const std::string IOSettings::explorationChecksOptionShortName = "ec";
+            const std::string IOSettings::parallelExplorationOptionName = "explparallel";
+            const std::string IOSettings::exprtkEvaluationOptionName = "exprtk";
             const std::string IOSettings::transitionRewardsOptionName = "transrew";
             const std::string IOSettings::stateRewardsOptionName = "staterew";
             const std::string IOSettings::choiceLabelingOptionName = "choicelab";
@@ -42,6 +44,7 @@ namespace storm {
             const std::string IOSettings::janiPropertyOptionShortName = "jprop";
             const std::string IOSettings::propertyOptionName = "prop";
             const std::string IOSettings::propertyOptionShortName = "prop";
+            const std::string IOSettings::timeBoundsOptionName = "timebounds";
 
             
             IOSettings::IOSettings() : ModuleSettings(moduleName) {
@@ -65,10 +68,14 @@ namespace storm {
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("property or filename", "The formula or the file containing the formulas.").build())
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filter", "The names of the properties to check.").setDefaultValueString("all").build())
                                         .build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, timeBoundsOptionName, false, "If given, time-bounded reachability properties on CTMCs are checked for each of the given upper time bounds (instead of their own bound) in a single pass.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A comma separated list of upper time bounds, e.g. 0.5,1,2.").build()).build());
                 std::vector<std::string> explorationOrders = {"dfs", "bfs"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationOrderOptionName, false, "Sets which exploration order to use.").setShortName(explorationOrderOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the exploration order to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(explorationOrders)).setDefaultValueString("bfs").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false, "If set, additional checks (if available) are performed during model exploration to debug the model.").setShortName(explorationChecksOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, parallelExplorationOptionName, false, "If set, the explicit state space is explored breadth-first with the number of threads given by --threads. The resulting model is identical to the one obtained by the sequential exploration.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exprtkEvaluationOptionName, false, "If set, expressions are evaluated with exprtk instead of the native evaluator when exploring the explicit state space of models with floating point values.").build());
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, transitionRewardsOptionName, false, "If given, the transition rewards are read from this file and added to the explicit model. Note that this requires the model to be given as an explicit model (i.e., via --" + explicitOptionName + ").")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The file from which to read the transition rewards.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
@@ -137,6 +144,10 @@ namespace storm {
             bool IOSettings::isJitSet() const {
                 return this->getOption(jitOptionName).getHasOptionBeenSet();
             }
+            
+            std::unique_ptr<storm::settings::SettingMemento> IOSettings::overrideJitSet(bool stateToSet) {
+                return this->overrideOption(jitOptionName, stateToSet);
+            }
 
             bool IOSettings::isExplorationOrderSet() const {
                 return this->getOption(explorationOrderOptionName).getHasOptionBeenSet();
@@ -156,6 +167,14 @@ namespace storm {
                 return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
             }
             
+            bool IOSettings::isParallelExplorationSet() const {
+                return this->getOption(parallelExplorationOptionName).getHasOptionBeenSet();
+            }
+
+            bool IOSettings::isExprtkEvaluationSet() const {
+                return this->getOption(exprtkEvaluationOptionName).getHasOptionBeenSet();
+            }
+            
             bool IOSettings::isTransitionRewardsSet() const {
                 return this->getOption(transitionRewardsOptionName).getHasOptionBeenSet();
             }
@@ -200,6 +219,22 @@ namespace storm {
                 return storm::parser::parseCommaSeperatedValues(this->getOption(janiPropertyOptionName).getArgumentByName("values").getValueAsString());
             }
 
+            bool IOSettings::isTimeBoundsSet() const {
+                return this->getOption(timeBoundsOptionName).getHasOptionBeenSet();
+            }
+            
+            std::vector<double> IOSettings::getTimeBounds() const {
+                std::vector<double> result;
+                for (auto const& value : storm::parser::parseCommaSeperatedValues(this->getOption(timeBoundsOptionName).getArgumentByName("values").getValueAsString())) {
+                    try {
+                        result.push_back(std::stod(value));
+                    } catch (std::exception const&) {
+                        STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal time bound '" << value << "'.");
+                    }
+                }
+                return result;
+            }
+
             bool IOSettings::isPrismCompatibilityEnabled() const {
                 return this->getOption(prismCompatibilityOptionName).getHasOptionBeenSet();
             }
@@ -123,6 +123,15 @@ namespace storm {
                  */
                 bool isJitSet() const;
                 
+                /*!
+                 * Overrides the option to use the JIT builder by setting it to the specified value. As soon as the
+                 * returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param stateToSet The value that is to be set for the option.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideJitSet(bool stateToSet);
+                
                 /*!
                  * Retrieves whether the model exploration order was set.
                  *
@@ -143,6 +152,21 @@ namespace storm {
                  * @return The chosen exploration order.
                  */
                 storm::builder::ExplorationOrder getExplorationOrder() const;
+                
+                /*!
+                 * Retrieves whether the explicit state space is to be explored with multiple threads.
+                 *
+                 * @return True if the state space is to be explored in parallel.
+                 */
+                bool isParallelExplorationSet() const;
+
+                /*!
+                 * Retrieves whether expressions are to be evaluated with exprtk (instead of the native evaluator) during
+                 * the exploration of the explicit state space.
+                 *
+                 * @return True if exprtk is to be used.
+                 */
+                bool isExprtkEvaluationSet() const;
 
                 /*!
                  * Retrieves whether the transition reward option was set.
@@ -244,6 +268,20 @@ namespace storm {
                  */
                 std::string getPropertyFilter() const;
 
+                /*!
+                 * Retrieves whether the time bounds option was set.
+                 *
+                 * @return True if the time bounds option was set.
+                 */
+                bool isTimeBoundsSet() const;
+                
+                /*!
+                 * Retrieves the upper time bounds for which the time-bounded properties are to be checked.
+                 *
+                 * @return The upper time bounds.
+                 */
+                std::vector<double> getTimeBounds() const;
+
                 /*!
                  * Retrieves whether the PRISM compatibility mode was enabled.
                  *
@@ -283,6 +321,8 @@ namespace storm {
                 static const std::string explorationChecksOptionShortName;
                 static const std::string explorationOrderOptionName;
                 static const std::string explorationOrderOptionShortName;
+                static const std::string parallelExplorationOptionName;
+                static const std::string exprtkEvaluationOptionName;
                 static const std::string transitionRewardsOptionName;
                 static const std::string stateRewardsOptionName;
                 static const std::string choiceLabelingOptionName;
@@ -296,6 +336,7 @@ namespace storm {
                 static const std::string janiPropertyOptionShortName;
                 static const std::string propertyOptionName;
                 static const std::string propertyOptionShortName;
+                static const std::string timeBoundsOptionName;
             };
 
         } // namespace modules
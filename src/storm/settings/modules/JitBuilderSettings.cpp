@@ -20,6 +20,8 @@ namespace storm {
             const std::string JitBuilderSettings::boostIncludeDirectoryOptionName = "boost";
             const std::string JitBuilderSettings::carlIncludeDirectoryOptionName = "carl";
             const std::string JitBuilderSettings::compilerFlagsOptionName = "cxxflags";
+            const std::string JitBuilderSettings::cacheDirectoryOptionName = "cachedir";
+            const std::string JitBuilderSettings::noCacheOptionName = "nocache";
 
             JitBuilderSettings::JitBuilderSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, doctorOptionName, false, "Show debugging information on why the jit-based model builder is not working on your system.").build());
@@ -33,6 +35,9 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The directory containing the carl headers.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, compilerFlagsOptionName, false, "The flags passed to the compiler.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("flags", "The compiler flags.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, cacheDirectoryOptionName, false, "The directory in which the compiled models are kept, so they do not need to be compiled again in later runs.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The cache directory, which must be owned by the current user. Defaults to $XDG_CACHE_HOME/storm or ~/.cache/storm.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, noCacheOptionName, false, "If set, compiled models are neither taken from nor stored in the cache.").build());
             }
             
             bool JitBuilderSettings::isCompilerSet() const {
@@ -79,6 +84,18 @@ namespace storm {
                 return this->getOption(compilerFlagsOptionName).getArgumentByName("flags").getValueAsString();
             }
             
+            bool JitBuilderSettings::isCacheDirectorySet() const {
+                return this->getOption(cacheDirectoryOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string JitBuilderSettings::getCacheDirectory() const {
+                return this->getOption(cacheDirectoryOptionName).getArgumentByName("dir").getValueAsString();
+            }
+            
+            bool JitBuilderSettings::isNoCacheSet() const {
+                return this->getOption(noCacheOptionName).getHasOptionBeenSet();
+            }
+            
             void JitBuilderSettings::finalize() {
                 // Intentionally left empty.
             }
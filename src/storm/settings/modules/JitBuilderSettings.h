@@ -30,6 +30,11 @@ namespace storm {
                 bool isCompilerFlagsSet() const;
                 std::string getCompilerFlags() const;
                 
+                bool isCacheDirectorySet() const;
+                std::string getCacheDirectory() const;
+                
+                bool isNoCacheSet() const;
+                
                 bool check() const override;
                 void finalize() override;
                 
@@ -42,6 +47,8 @@ namespace storm {
                 static const std::string carlIncludeDirectoryOptionName;
                 static const std::string compilerFlagsOptionName;
                 static const std::string doctorOptionName;
+                static const std::string cacheDirectoryOptionName;
+                static const std::string noCacheOptionName;
             };
             
         }
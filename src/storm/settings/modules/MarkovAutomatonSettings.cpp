@@ -0,0 +1,36 @@
+#include "storm/settings/modules/MarkovAutomatonSettings.h"
+
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Argument.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/IllegalArgumentValueException.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            const std::string MarkovAutomatonSettings::moduleName = "ma";
+            const std::string MarkovAutomatonSettings::techniqueOptionName = "technique";
+            
+            MarkovAutomatonSettings::MarkovAutomatonSettings() : ModuleSettings(moduleName) {
+                std::vector<std::string> techniques = {"imca", "unifplus"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, techniqueOptionName, true, "The technique to use for time-bounded reachability.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the technique to use. 'imca' digitizes time, 'unifplus' is based on uniformization.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(techniques)).setDefaultValueString("unifplus").build()).build());
+            }
+            
+            MarkovAutomatonSettings::BoundedReachabilityTechnique MarkovAutomatonSettings::getBoundedReachabilityTechnique() const {
+                std::string techniqueAsString = this->getOption(techniqueOptionName).getArgumentByName("name").getValueAsString();
+                if (techniqueAsString == "imca") {
+                    return BoundedReachabilityTechnique::Imca;
+                } else if (techniqueAsString == "unifplus") {
+                    return BoundedReachabilityTechnique::UnifPlus;
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal technique for time-bounded reachability selected.");
+                }
+            }
+            
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
@@ -0,0 +1,42 @@
+#ifndef STORM_SETTINGS_MODULES_MARKOVAUTOMATONSETTINGS_H_
+#define STORM_SETTINGS_MODULES_MARKOVAUTOMATONSETTINGS_H_
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            /*!
+             * This class represents the settings for the analysis of Markov automata.
+             */
+            class MarkovAutomatonSettings : public ModuleSettings {
+            public:
+                /*!
+                 * An enum that contains all available techniques for time-bounded reachability.
+                 */
+                enum class BoundedReachabilityTechnique { Imca, UnifPlus };
+                
+                /*!
+                 * Creates a new set of Markov automaton settings.
+                 */
+                MarkovAutomatonSettings();
+                
+                /*!
+                 * Retrieves the selected technique for time-bounded reachability.
+                 *
+                 * @return The selected technique.
+                 */
+                BoundedReachabilityTechnique getBoundedReachabilityTechnique() const;
+                
+                const static std::string moduleName;
+                
+            private:
+                const static std::string techniqueOptionName;
+            };
+            
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
+
+#endif /* STORM_SETTINGS_MODULES_MARKOVAUTOMATONSETTINGS_H_ */
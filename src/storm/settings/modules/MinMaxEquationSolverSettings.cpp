@@ -17,9 +17,11 @@ namespace storm {
             const std::string MinMaxEquationSolverSettings::maximalIterationsOptionShortName = "i";
             const std::string MinMaxEquationSolverSettings::precisionOptionName = "precision";
             const std::string MinMaxEquationSolverSettings::absoluteOptionName = "absolute";
+            const std::string MinMaxEquationSolverSettings::topologicalOrderOptionName = "sccorder";
+            const std::string MinMaxEquationSolverSettings::mixedPrecisionOptionName = "mixedprecision";
 
             MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration"};
+                std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "gs", "gauss-seidel", "pi", "policy-iteration"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which min/max linear equation solving technique is preferred.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a min/max linear equation solving technique.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(minMaxSolvingTechniques)).setDefaultValueString("vi").build()).build());
                 
@@ -28,12 +30,18 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision used for detecting convergence of iterative methods.").addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.").setDefaultValueDouble(1e-06).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, absoluteOptionName, false, "Sets whether the relative or the absolute error is considered for detecting convergence.").build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, topologicalOrderOptionName, false, "Sets whether Gauss-Seidel value iteration processes the states in the topological order of the SCCs.").build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false, "Sets whether value iteration performs most iterations in single precision before refining the result in double precision.").build());
             }
             
             storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
                 std::string minMaxEquationSolvingTechnique = this->getOption(solvingMethodOptionName).getArgumentByName("name").getValueAsString();
                 if (minMaxEquationSolvingTechnique == "value-iteration" || minMaxEquationSolvingTechnique == "vi") {
                     return storm::solver::MinMaxMethod::ValueIteration;
+                } else if (minMaxEquationSolvingTechnique == "gauss-seidel" || minMaxEquationSolvingTechnique == "gs") {
+                    return storm::solver::MinMaxMethod::GaussSeidel;
                 } else if (minMaxEquationSolvingTechnique == "policy-iteration" || minMaxEquationSolvingTechnique == "pi") {
                     return storm::solver::MinMaxMethod::PolicyIteration;
                 }
@@ -68,6 +76,14 @@ namespace storm {
                 return this->getOption(absoluteOptionName).getHasOptionBeenSet() ? MinMaxEquationSolverSettings::ConvergenceCriterion::Absolute : MinMaxEquationSolverSettings::ConvergenceCriterion::Relative;
             }
             
+            bool MinMaxEquationSolverSettings::isUseTopologicalOrderSet() const {
+                return this->getOption(topologicalOrderOptionName).getHasOptionBeenSet();
+            }
+            
+            bool MinMaxEquationSolverSettings::isUseMixedPrecisionSet() const {
+                return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+            }
+            
         }
     }
 }
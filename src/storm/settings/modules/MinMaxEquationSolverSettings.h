@@ -75,6 +75,22 @@ namespace storm {
                  */
                 ConvergenceCriterion getConvergenceCriterion() const;
                 
+                /*!
+                 * Retrieves whether Gauss-Seidel value iteration is to process the states in the topological order of
+                 * the strongly connected components of the system.
+                 *
+                 * @return True iff the topological order is to be used.
+                 */
+                bool isUseTopologicalOrderSet() const;
+                
+                /*!
+                 * Retrieves whether value iteration is to perform the bulk of the iterations in single precision and
+                 * only refine the result in double precision.
+                 *
+                 * @return True iff mixed precision is to be used.
+                 */
+                bool isUseMixedPrecisionSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -84,6 +100,8 @@ namespace storm {
                 static const std::string maximalIterationsOptionShortName;
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
+                static const std::string topologicalOrderOptionName;
+                static const std::string mixedPrecisionOptionName;
             };
             
         }
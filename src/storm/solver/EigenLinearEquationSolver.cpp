@@ -285,6 +285,11 @@ namespace storm {
             return settings;
         }
         
+        template<typename ValueType>
+        void EigenLinearEquationSolver<ValueType>::setPrecision(ValueType const& precision) {
+            settings.setPrecision(precision);
+        }
+        
         template<typename ValueType>
         uint64_t EigenLinearEquationSolver<ValueType>::getMatrixRowCount() const {
             return eigenA->rows();
@@ -321,6 +326,17 @@ namespace storm {
             solver._solve_impl(eigenB, eigenX);
             return solver.info() == StormEigen::ComputationInfo::Success;
         }
+        
+        // The rational solvers are exact, so there is no precision to set.
+        template<>
+        void EigenLinearEquationSolver<storm::RationalNumber>::setPrecision(storm::RationalNumber const&) {
+            // Intentionally left empty.
+        }
+        
+        template<>
+        void EigenLinearEquationSolver<storm::RationalFunction>::setPrecision(storm::RationalFunction const&) {
+            // Intentionally left empty.
+        }
 #endif
 
         template<typename ValueType>
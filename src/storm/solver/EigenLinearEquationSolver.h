@@ -71,6 +71,8 @@ namespace storm {
 
             EigenLinearEquationSolverSettings<ValueType>& getSettings();
             EigenLinearEquationSolverSettings<ValueType> const& getSettings() const;
+            
+            virtual void setPrecision(ValueType const& precision) override;
                         
         private:
             virtual uint64_t getMatrixRowCount() const override;
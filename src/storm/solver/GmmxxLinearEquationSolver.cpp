@@ -135,6 +135,28 @@ namespace storm {
             clearCache();
         }
         
+        template<typename ValueType>
+        void GmmxxLinearEquationSolver<ValueType>::updateMatrixRows(storm::storage::SparseMatrix<ValueType> const& A, std::vector<uint_fast64_t> const& rows) {
+            if (this->A != &A || !gmmxxA) {
+                setMatrix(A);
+                return;
+            }
+            
+            // The rows keep their number of entries, so we can overwrite them in the converted matrix. The
+            // preconditioners and the Jacobi decomposition depend on the values and are recomputed when needed.
+            for (auto row : rows) {
+                uint_fast64_t position = gmmxxA->jc[row];
+                for (auto const& entry : A.getRow(row)) {
+                    gmmxxA->ir[position] = entry.getColumn();
+                    gmmxxA->pr[position] = entry.getValue();
+                    ++position;
+                }
+            }
+            iluPreconditioner.reset();
+            diagonalPreconditioner.reset();
+            jacobiDecomposition.reset();
+        }
+        
         template<typename ValueType>
         bool GmmxxLinearEquationSolver<ValueType>::solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             auto method = this->getSettings().getSolutionMethod();
@@ -300,6 +322,11 @@ namespace storm {
             return settings;
         }
         
+        template<typename ValueType>
+        void GmmxxLinearEquationSolver<ValueType>::setPrecision(ValueType const& precision) {
+            settings.setPrecision(precision);
+        }
+        
         template<typename ValueType>
         void GmmxxLinearEquationSolver<ValueType>::clearCache() const {
             gmmxxA.reset();
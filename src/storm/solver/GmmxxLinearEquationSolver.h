@@ -91,6 +91,7 @@ namespace storm {
             
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& A) override;
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) override;
+            virtual void updateMatrixRows(storm::storage::SparseMatrix<ValueType> const& A, std::vector<uint_fast64_t> const& rows) override;
             
             virtual bool solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
             virtual void multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
@@ -99,6 +100,8 @@ namespace storm {
             GmmxxLinearEquationSolverSettings<ValueType> const& getSettings() const;
 
 
+            virtual void setPrecision(ValueType const& precision) override;
+            
             virtual void clearCache() const override;
 
         private:
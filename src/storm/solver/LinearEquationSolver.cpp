@@ -6,6 +6,7 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 #include "storm/solver/EigenLinearEquationSolver.h"
 #include "storm/solver/EliminationLinearEquationSolver.h"
+#include "storm/solver/TopologicalLinearEquationSolver.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
@@ -90,6 +91,16 @@ namespace storm {
             setUpperBound(upper);
         }
         
+        template<typename ValueType>
+        void LinearEquationSolver<ValueType>::setPrecision(ValueType const&) {
+            // Intentionally left empty.
+        }
+        
+        template<typename ValueType>
+        void LinearEquationSolver<ValueType>::updateMatrixRows(storm::storage::SparseMatrix<ValueType> const& A, std::vector<uint_fast64_t> const&) {
+            setMatrix(A);
+        }
+        
         template<typename ValueType>
         std::unique_ptr<LinearEquationSolver<ValueType>> LinearEquationSolverFactory<ValueType>::create(storm::storage::SparseMatrix<ValueType>&& matrix) const {
             return create(matrix);
@@ -114,6 +125,7 @@ namespace storm {
                 case EquationSolverType::Native: return std::make_unique<NativeLinearEquationSolver<ValueType>>(std::forward<MatrixType>(matrix));
                 case EquationSolverType::Eigen: return std::make_unique<EigenLinearEquationSolver<ValueType>>(std::forward<MatrixType>(matrix));
                 case EquationSolverType::Elimination: return std::make_unique<EliminationLinearEquationSolver<ValueType>>(std::forward<MatrixType>(matrix));
+                case EquationSolverType::Topological: return std::make_unique<TopologicalLinearEquationSolver<ValueType>>(std::forward<MatrixType>(matrix));
                 default: return std::make_unique<GmmxxLinearEquationSolver<ValueType>>(std::forward<MatrixType>(matrix));
             }
         }
@@ -31,6 +31,16 @@ namespace storm {
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& A) = 0;
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) = 0;
 
+            /*!
+             * Informs the solver that the given rows of the matrix were changed in place, where no row changed its
+             * number of entries. Solvers that refer to the matrix update the affected parts of their cached data
+             * instead of recomputing it. By default, the changed matrix is set anew.
+             *
+             * @param A The changed matrix. It must be the matrix the solver refers to, if it refers to one.
+             * @param rows The rows that were changed.
+             */
+            virtual void updateMatrixRows(storm::storage::SparseMatrix<ValueType> const& A, std::vector<uint_fast64_t> const& rows);
+
             /*!
              * Solves the equation system A*x = b. The matrix A is required to be square and have a unique solution.
              * The solution of the set of linear equations will be written to the vector x. Note that the matrix A has
@@ -98,6 +108,12 @@ namespace storm {
              * Sets bounds for the solution that can potentially used by the solver.
              */
             void setBounds(ValueType const& lower, ValueType const& upper);
+            
+            /*!
+             * Sets the precision up to which the equation system is to be solved. Solvers that do not solve the
+             * equation system iteratively ignore this value.
+             */
+            virtual void setPrecision(ValueType const& precision);
 
         protected:
             // auxiliary storage. If set, this vector has getMatrixRowCount() entries.
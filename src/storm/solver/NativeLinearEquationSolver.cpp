@@ -4,6 +4,8 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
+#include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/utility/vector.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -31,6 +33,8 @@ namespace storm {
             precision = settings.getPrecision();
             relative = settings.getConvergenceCriterion() == storm::settings::modules::NativeEquationSolverSettings::ConvergenceCriterion::Relative;
             omega = storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getOmega();
+            forceSoundness = storm::settings::getModule<storm::settings::modules::GeneralSettings>().isSoundSet();
+            useCompactMatrix = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseCompactMatrixSet();
         }
         
         template<typename ValueType>
@@ -58,6 +62,16 @@ namespace storm {
             this->omega = omega;
         }
         
+        template<typename ValueType>
+        void NativeLinearEquationSolverSettings<ValueType>::setForceSoundness(bool value) {
+            this->forceSoundness = value;
+        }
+        
+        template<typename ValueType>
+        void NativeLinearEquationSolverSettings<ValueType>::setUseCompactMatrix(bool value) {
+            this->useCompactMatrix = value;
+        }
+        
         template<typename ValueType>
         typename NativeLinearEquationSolverSettings<ValueType>::SolutionMethod NativeLinearEquationSolverSettings<ValueType>::getSolutionMethod() const {
             return method;
@@ -83,6 +97,16 @@ namespace storm {
             return omega;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolverSettings<ValueType>::getForceSoundness() const {
+            return forceSoundness;
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolverSettings<ValueType>::getUseCompactMatrix() const {
+            return useCompactMatrix;
+        }
+        
         template<typename ValueType>
         NativeLinearEquationSolver<ValueType>::NativeLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A, NativeLinearEquationSolverSettings<ValueType> const& settings) : localA(nullptr), A(nullptr), settings(settings) {
             this->setMatrix(A);
@@ -106,6 +130,30 @@ namespace storm {
             this->A = localA.get();
             clearCache();
         }
+        
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::updateMatrixRows(storm::storage::SparseMatrix<ValueType> const& A, std::vector<uint_fast64_t> const& rows) {
+            if (this->A != &A || !jacobiDecomposition || compactJacobiLU) {
+                setMatrix(A);
+                return;
+            }
+            
+            // As every row of A has a diagonal entry, the rows of the decomposition keep their number of entries, so
+            // we can overwrite them in place. The multiplication cache and the bounds do not depend on the values.
+            for (auto row : rows) {
+                auto luIt = jacobiDecomposition->first.begin(row);
+                for (auto const& entry : A.getRow(row)) {
+                    if (entry.getColumn() == row) {
+                        jacobiDecomposition->second[row] = storm::utility::one<ValueType>() / entry.getValue();
+                    } else {
+                        luIt->setColumn(entry.getColumn());
+                        luIt->setValue(entry.getValue());
+                        ++luIt;
+                    }
+                }
+            }
+            jacobiDecomposition->first.updateNonzeroEntryCount();
+        }
 
         
         template<typename ValueType>
@@ -114,6 +162,13 @@ namespace storm {
                 this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
             }
             
+            if (this->getSettings().getForceSoundness()) {
+                if (this->lowerBound && this->upperBound) {
+                    return solveEquationsSound(x, b);
+                }
+                STORM_LOG_WARN("Sound iteration requires a lower and an upper bound on the solution, falling back to the selected method.");
+            }
+            
             if (this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::SOR || this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::GaussSeidel) {
                 // Define the omega used for SOR.
                 ValueType omega = this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::SOR ? this->getSettings().getOmega() : storm::utility::one<ValueType>();
@@ -147,6 +202,16 @@ namespace storm {
                 // Get a Jacobi decomposition of the matrix A.
                 if(!jacobiDecomposition) {
                     jacobiDecomposition = std::make_unique<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>>>(A->getJacobiDecomposition());
+                    
+                    // If requested, we only keep a compact copy of LU. As LU is owned by the solver, this saves memory.
+                    if (this->getSettings().getUseCompactMatrix()) {
+                        if (storm::storage::CompactSparseMatrix<ValueType>::isRepresentable(jacobiDecomposition->first)) {
+                            compactJacobiLU = std::make_unique<storm::storage::CompactSparseMatrix<ValueType>>(jacobiDecomposition->first);
+                            jacobiDecomposition->first = storm::storage::SparseMatrix<ValueType>();
+                        } else {
+                            STORM_LOG_WARN("The matrix is too large to be stored with compact indices.");
+                        }
+                    }
                 }
                 storm::storage::SparseMatrix<ValueType> const& jacobiLU = jacobiDecomposition->first;
                 std::vector<ValueType> const& jacobiD = jacobiDecomposition->second;
@@ -160,7 +225,11 @@ namespace storm {
                 
                 while (!converged && iterationCount < this->getSettings().getMaximalNumberOfIterations() && !(this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(*currentX))) {
                     // Compute D^-1 * (b - LU * x) and store result in nextX.
-                    jacobiLU.multiplyWithVector(*currentX, *nextX);
+                    if (compactJacobiLU) {
+                        compactJacobiLU->multiplyWithVector(*currentX, *nextX);
+                    } else {
+                        jacobiLU.multiplyWithVector(*currentX, *nextX);
+                    }
                     storm::utility::vector::subtractVectors(b, *nextX, *nextX);
                     storm::utility::vector::multiplyVectorsPointwise(jacobiD, *nextX, *nextX);
                     
@@ -188,25 +257,57 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsSound(std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            // We perform Gauss-Seidel steps on a vector of lower bounds (stored in x) and a vector of upper bounds.
+            // For the equation systems (I - P)x = b we solve, these steps are monotone, so the iterates remain lower
+            // and upper bounds of the solution, respectively. Note that SOR steps do not have this property.
+            std::vector<ValueType>& lowerX = x;
+            std::vector<ValueType>& upperX = *this->cachedRowVector;
+            std::fill(lowerX.begin(), lowerX.end(), this->lowerBound.get());
+            std::fill(upperX.begin(), upperX.end(), this->upperBound.get());
+            ValueType two = storm::utility::convertNumber<ValueType>(2.0);
+            
+            // Set up additional environment variables.
+            uint_fast64_t iterationCount = 0;
+            bool converged = false;
+            
+            while (!converged && iterationCount < this->getSettings().getMaximalNumberOfIterations() && !(this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(lowerX))) {
+                A->performSuccessiveOverRelaxationStep(storm::utility::one<ValueType>(), lowerX, b);
+                A->performSuccessiveOverRelaxationStep(storm::utility::one<ValueType>(), upperX, b);
+                
+                // The difference between the bounds is twice the error we make by taking their mean.
+                converged = storm::utility::vector::equalModuloPrecision<ValueType>(upperX, lowerX, two * static_cast<ValueType>(this->getSettings().getPrecision()), this->getSettings().getRelativeTerminationCriterion());
+                
+                // Increase iteration count so we can abort if convergence is too slow.
+                ++iterationCount;
+            }
+            
+            if (converged) {
+                storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(lowerX, upperX, lowerX, [&two] (ValueType const& lower, ValueType const& upper) { return (lower + upper) / two; });
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return converged;
+        }
+        
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            // The summand b (if any) is added by the matrix-vector multiplication itself, which avoids another pass
+            // over the result vector.
             if (&x != &result) {
-                A->multiplyWithVector(x, result);
-                if (b != nullptr) {
-                    storm::utility::vector::addVectors(result, *b, result);
-                }
+                A->multiplyWithVector(x, result, b);
             } else {
                 // If the two vectors are aliases, we need to create a temporary.
                 if(!this->cachedRowVector) {
                     this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
                 }
                 
-                A->multiplyWithVector(x, *this->cachedRowVector);
-                if (b != nullptr) {
-                    storm::utility::vector::addVectors(*this->cachedRowVector, *b, result);
-                } else {
-                    result.swap(*this->cachedRowVector);
-                }
+                A->multiplyWithVector(x, *this->cachedRowVector, b);
+                result.swap(*this->cachedRowVector);
                 
                 if (!this->isCachingEnabled()) {
                     clearCache();
@@ -224,9 +325,15 @@ namespace storm {
             return settings;
         }
         
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::setPrecision(ValueType const& precision) {
+            settings.setPrecision(precision);
+        }
+        
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::clearCache() const {
             jacobiDecomposition.reset();
+            compactJacobiLU.reset();
             LinearEquationSolver<ValueType>::clearCache();
         }
         
@@ -5,6 +5,8 @@
 
 #include "LinearEquationSolver.h"
 
+#include "storm/storage/CompactSparseMatrix.h"
+
 namespace storm {
     namespace solver {
         
@@ -22,12 +24,16 @@ namespace storm {
             void setMaximalNumberOfIterations(uint64_t maximalNumberOfIterations);
             void setRelativeTerminationCriterion(bool value);
             void setOmega(ValueType omega);
+            void setForceSoundness(bool value);
+            void setUseCompactMatrix(bool value);
             
             SolutionMethod getSolutionMethod() const;
             ValueType getPrecision() const;
             uint64_t getMaximalNumberOfIterations() const;
             uint64_t getRelativeTerminationCriterion() const;
             ValueType getOmega() const;
+            bool getForceSoundness() const;
+            bool getUseCompactMatrix() const;
             
         private:
             SolutionMethod method;
@@ -35,6 +41,8 @@ namespace storm {
             bool relative;
             uint_fast64_t maximalNumberOfIterations;
             ValueType omega;
+            bool forceSoundness;
+            bool useCompactMatrix;
         };
         
         /*!
@@ -48,6 +56,7 @@ namespace storm {
             
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& A) override;
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) override;
+            virtual void updateMatrixRows(storm::storage::SparseMatrix<ValueType> const& A, std::vector<uint_fast64_t> const& rows) override;
             
             virtual bool solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
             virtual void multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
@@ -55,9 +64,17 @@ namespace storm {
             void setSettings(NativeLinearEquationSolverSettings<ValueType> const& newSettings);
             NativeLinearEquationSolverSettings<ValueType> const& getSettings() const;
 
+            virtual void setPrecision(ValueType const& precision) override;
+            
             virtual void clearCache() const override;
 
         private:
+            /*!
+             * Solves the equation system by iterating a lower and an upper bound on the solution until they are
+             * sufficiently close. This requires a lower and an upper bound to be set.
+             */
+            bool solveEquationsSound(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
             virtual uint64_t getMatrixRowCount() const override;
             virtual uint64_t getMatrixColumnCount() const override;
 
@@ -74,6 +91,7 @@ namespace storm {
             
             // cached auxiliary data
             mutable std::unique_ptr<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>>> jacobiDecomposition;
+            mutable std::unique_ptr<storm::storage::CompactSparseMatrix<ValueType>> compactJacobiLU; // If set, replaces the LU part of jacobiDecomposition
         };
         
         template<typename ValueType>
@@ -14,6 +14,14 @@ namespace storm {
             return manager;
         }
         
+        SmtSolver::ScopedBacktrackingPoint::ScopedBacktrackingPoint(SmtSolver& solver) : solver(solver) {
+            solver.push();
+        }
+        
+        SmtSolver::ScopedBacktrackingPoint::~ScopedBacktrackingPoint() {
+            solver.pop();
+        }
+        
         SmtSolver::SmtSolver(storm::expressions::ExpressionManager& manager) : manager(manager) {
             // Intentionally left empty.
         }
@@ -54,6 +54,32 @@ namespace storm {
                 storm::expressions::ExpressionManager const& manager;
 			};
             
+            /*!
+             * Pushes a backtracking point on the stack of a solver upon construction and pops it upon destruction. This
+             * way, the assertions that were added in the meantime are removed even if an exception is thrown.
+             */
+            class ScopedBacktrackingPoint {
+            public:
+                /*!
+                 * Pushes a backtracking point on the stack of the given solver.
+                 *
+                 * @param solver The solver on whose stack to push the backtracking point.
+                 */
+                ScopedBacktrackingPoint(SmtSolver& solver);
+                
+                ScopedBacktrackingPoint(ScopedBacktrackingPoint const& other) = delete;
+                ScopedBacktrackingPoint& operator=(ScopedBacktrackingPoint const& other) = delete;
+                
+                /*!
+                 * Pops the backtracking point from the stack of the solver.
+                 */
+                ~ScopedBacktrackingPoint();
+                
+            private:
+                // The solver on whose stack the backtracking point was pushed.
+                SmtSolver& solver;
+            };
+            
 		public:
 			/*!
              * Constructs a new Smt solver with the given options.
@@ -8,6 +8,8 @@ namespace storm {
                     return "policy";
                 case MinMaxMethod::ValueIteration:
                     return "value";
+                case MinMaxMethod::GaussSeidel:
+                    return "gauss-seidel";
                 case MinMaxMethod::Topological:
                     return "topological";
 
@@ -35,6 +37,8 @@ namespace storm {
                     return "Eigen";
                 case EquationSolverType::Elimination:
                     return "Elimination";
+                case EquationSolverType::Topological:
+                    return "Topological";
             }
             return "invalid";
         }
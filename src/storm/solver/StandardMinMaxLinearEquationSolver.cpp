@@ -1,17 +1,30 @@
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <type_traits>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
+#include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/solver/GmmxxLinearEquationSolver.h"
 #include "storm/solver/EigenLinearEquationSolver.h"
 #include "storm/solver/NativeLinearEquationSolver.h"
 #include "storm/solver/EliminationLinearEquationSolver.h"
+#include "storm/solver/TopologicalLinearEquationSolver.h"
+
+#include "storm/storage/CompactStronglyConnectedComponentDecomposition.h"
+#include "storm/storage/CompactMaximalEndComponentDecomposition.h"
 
 #include "storm/utility/vector.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/ConstantsComparator.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/NoConvergenceException.h"
 namespace storm {
     namespace solver {
         
@@ -23,10 +36,15 @@ namespace storm {
             maximalNumberOfIterations = settings.getMaximalIterationCount();
             precision = storm::utility::convertNumber<ValueType>(settings.getPrecision());
             relative = settings.getConvergenceCriterion() == storm::settings::modules::MinMaxEquationSolverSettings::ConvergenceCriterion::Relative;
+            useTopologicalOrder = settings.isUseTopologicalOrderSet();
+            forceSoundness = storm::settings::getModule<storm::settings::modules::GeneralSettings>().isSoundSet();
+            useMixedPrecision = settings.isUseMixedPrecisionSet();
+            useCompactMatrix = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseCompactMatrixSet();
             
             auto method = settings.getMinMaxEquationSolvingMethod();
             switch (method) {
                 case MinMaxMethod::ValueIteration: this->solutionMethod = SolutionMethod::ValueIteration; break;
+                case MinMaxMethod::GaussSeidel: this->solutionMethod = SolutionMethod::GaussSeidel; break;
                 case MinMaxMethod::PolicyIteration: this->solutionMethod = SolutionMethod::PolicyIteration; break;
                 default:
                     STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
@@ -53,6 +71,26 @@ namespace storm {
             this->precision = precision;
         }
         
+        template<typename ValueType>
+        void StandardMinMaxLinearEquationSolverSettings<ValueType>::setUseTopologicalOrder(bool value) {
+            this->useTopologicalOrder = value;
+        }
+        
+        template<typename ValueType>
+        void StandardMinMaxLinearEquationSolverSettings<ValueType>::setForceSoundness(bool value) {
+            this->forceSoundness = value;
+        }
+        
+        template<typename ValueType>
+        void StandardMinMaxLinearEquationSolverSettings<ValueType>::setUseMixedPrecision(bool value) {
+            this->useMixedPrecision = value;
+        }
+        
+        template<typename ValueType>
+        void StandardMinMaxLinearEquationSolverSettings<ValueType>::setUseCompactMatrix(bool value) {
+            this->useCompactMatrix = value;
+        }
+        
         template<typename ValueType>
         typename StandardMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod const& StandardMinMaxLinearEquationSolverSettings<ValueType>::getSolutionMethod() const {
             return solutionMethod;
@@ -74,20 +112,49 @@ namespace storm {
         }
         
         template<typename ValueType>
-        StandardMinMaxLinearEquationSolver<ValueType>::StandardMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& linearEquationSolverFactory, StandardMinMaxLinearEquationSolverSettings<ValueType> const& settings) : settings(settings), linearEquationSolverFactory(std::move(linearEquationSolverFactory)), localA(nullptr), A(A) {
+        bool StandardMinMaxLinearEquationSolverSettings<ValueType>::getUseTopologicalOrder() const {
+            return useTopologicalOrder;
+        }
+        
+        template<typename ValueType>
+        bool StandardMinMaxLinearEquationSolverSettings<ValueType>::getForceSoundness() const {
+            return forceSoundness;
+        }
+        
+        template<typename ValueType>
+        bool StandardMinMaxLinearEquationSolverSettings<ValueType>::getUseMixedPrecision() const {
+            return useMixedPrecision;
+        }
+        
+        template<typename ValueType>
+        bool StandardMinMaxLinearEquationSolverSettings<ValueType>::getUseCompactMatrix() const {
+            return useCompactMatrix;
+        }
+        
+        template<typename ValueType>
+        StandardMinMaxLinearEquationSolver<ValueType>::StandardMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& linearEquationSolverFactory, StandardMinMaxLinearEquationSolverSettings<ValueType> const& settings) : settings(settings), linearEquationSolverFactory(std::move(linearEquationSolverFactory)), localA(nullptr), A(A), matrixReleased(false) {
             // Intentionally left empty.
         }
         
         template<typename ValueType>
-        StandardMinMaxLinearEquationSolver<ValueType>::StandardMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& linearEquationSolverFactory, StandardMinMaxLinearEquationSolverSettings<ValueType> const& settings) : settings(settings), linearEquationSolverFactory(std::move(linearEquationSolverFactory)), localA(std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A))), A(*localA) {
+        StandardMinMaxLinearEquationSolver<ValueType>::StandardMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& linearEquationSolverFactory, StandardMinMaxLinearEquationSolverSettings<ValueType> const& settings) : settings(settings), linearEquationSolverFactory(std::move(linearEquationSolverFactory)), localA(std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A))), A(*localA), matrixReleased(false) {
             // Intentionally left empty.
         }
         
         template<typename ValueType>
         bool StandardMinMaxLinearEquationSolver<ValueType>::solveEquations(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            if (this->getSettings().getForceSoundness()) {
+                if (this->lowerBound && this->upperBound) {
+                    return solveEquationsSoundValueIteration(dir, x, b);
+                }
+                STORM_LOG_WARN("Sound value iteration requires a lower and an upper bound on the solution, falling back to the selected method.");
+            }
+            
             switch (this->getSettings().getSolutionMethod()) {
                 case StandardMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::ValueIteration:
                     return solveEquationsValueIteration(dir, x, b);
+                case StandardMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::GaussSeidel:
+                    return solveEquationsGaussSeidel(dir, x, b);
                 case StandardMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::PolicyIteration:
                     return solveEquationsPolicyIteration(dir, x, b);
             }
@@ -96,6 +163,8 @@ namespace storm {
         
         template<typename ValueType>
         bool StandardMinMaxLinearEquationSolver<ValueType>::solveEquationsPolicyIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            restoreMatrix();
+            
             // Create the initial scheduler.
             std::vector<storm::storage::sparse::state_type> scheduler(this->A.getRowGroupCount());
             
@@ -105,13 +174,15 @@ namespace storm {
             }
             std::vector<ValueType>& subB = *auxiliaryRowGroupVector;
 
-            // Resolve the nondeterminism according to the current scheduler.
-            storm::storage::SparseMatrix<ValueType> submatrix = this->A.selectRowsFromRowGroups(scheduler, true);
+            // Resolve the nondeterminism according to the current scheduler. Every row gets the space of the largest
+            // row of its group, so the rows can be patched in place whenever the scheduler changes.
+            storm::storage::SparseMatrix<ValueType> submatrix = this->A.selectRowsFromRowGroupsWithSlack(scheduler);
             submatrix.convertToEquationSystem();
             storm::utility::vector::selectVectorValues<ValueType>(subB, scheduler, this->A.getRowGroupIndices(), b);
 
-            // Create a solver that we will use throughout the procedure. We will modify the matrix in each iteration.
-            auto solver = linearEquationSolverFactory->create(std::move(submatrix));
+            // Create a solver that we will use throughout the procedure. The solver only refers to the matrix, which
+            // allows us to patch the matrix whenever the scheduler changes.
+            auto solver = linearEquationSolverFactory->create(submatrix);
             if (this->lowerBound) {
                 solver->setLowerBound(this->lowerBound.get());
             }
@@ -120,18 +191,46 @@ namespace storm {
             }
             solver->setCachingEnabled(true);
             
+            // The inner equation systems are first solved with a coarse precision that is refined as the
+            // improvements of the scheduler get smaller. Only once the scheduler cannot be improved any more at the
+            // target precision, we are done.
+            // For exact value types, the inner solvers are exact and choices are switched on any strict improvement.
+            ValueType const targetPrecision = std::is_floating_point<ValueType>::value ? this->getSettings().getPrecision() : storm::utility::zero<ValueType>();
+            ValueType innerPrecision = std::is_floating_point<ValueType>::value ? std::max(targetPrecision, storm::utility::convertNumber<ValueType>(1e-2)) : targetPrecision;
+            ValueType const refinementFactor = storm::utility::convertNumber<ValueType>(1e-1);
+            bool relative = this->getSettings().getRelativeTerminationCriterion();
+            
+            // With the relative criterion, the threshold vanishes for values close to zero, where the imprecision of
+            // the inner solver is not relative to the value, so we never let it drop below an absolute floor.
+            ValueType const absoluteThresholdFloor = std::is_floating_point<ValueType>::value ? storm::utility::convertNumber<ValueType>(1e-12) : storm::utility::zero<ValueType>();
+            auto getThreshold = [&] (ValueType const& value) { return relative ? std::max(absoluteThresholdFloor, innerPrecision * storm::utility::abs(value)) : innerPrecision; };
+            
+            // The choices are evaluated on the compact copy of A, if there is one.
+            storm::storage::CompactSparseMatrix<ValueType> const* compactMatrix = getCompactMatrix();
+            
+            std::vector<uint_fast64_t> changedGroups;
             Status status = Status::InProgress;
             uint64_t iterations = 0;
             do {
-                // Solve the equation system for the 'DTMC'.
+                // Solve the equation system for the 'DTMC'. As x still holds the solution for the previous scheduler,
+                // this warm-starts the inner solver.
                 // FIXME: we need to remove the 0- and 1- states to make the solution unique.
                 // HOWEVER: if we start with a valid scheduler, then we will never get an illegal one, because staying
                 // within illegal MECs will never strictly improve the value. Is this true?
+                if (std::is_floating_point<ValueType>::value) {
+                    solver->setPrecision(innerPrecision);
+                }
                 solver->solveEquations(x, subB);
                 
-                // Go through the multiplication result and see whether we can improve any of the choices.
-                bool schedulerImproved = false;
+                // Go through the multiplication result and see whether we can improve any of the choices. To avoid
+                // switching choices due to the imprecision of the inner solver, a choice only counts as an improvement
+                // if it is better by more than the inner precision.
+                changedGroups.clear();
+                ValueType maximalImprovement = storm::utility::zero<ValueType>();
                 for (uint_fast64_t group = 0; group < this->A.getRowGroupCount(); ++group) {
+                    ValueType currentValue = x[group];
+                    ValueType threshold = getThreshold(currentValue);
+                    bool groupChanged = false;
                     for (uint_fast64_t choice = this->A.getRowGroupIndices()[group]; choice < this->A.getRowGroupIndices()[group + 1]; ++choice) {
                         // If the choice is the currently selected one, we can skip it.
                         if (choice - this->A.getRowGroupIndices()[group] == scheduler[group]) {
@@ -139,31 +238,44 @@ namespace storm {
                         }
                         
                         // Create the value of the choice.
-                        ValueType choiceValue = storm::utility::zero<ValueType>();
-                        for (auto const& entry : this->A.getRow(choice)) {
-                            choiceValue += entry.getValue() * x[entry.getColumn()];
-                        }
-                        choiceValue += b[choice];
+                        ValueType choiceValue = (compactMatrix ? compactMatrix->multiplyRowWithVector(choice, x) : this->A.multiplyRowWithVector(choice, x)) + b[choice];
                         
-                        // If the value is strictly better than the solution of the inner system, we need to improve the scheduler.
-                        // TODO: If the underlying solver is not precise, this might run forever (i.e. when a state has two choices where the (exact) values are equal).
-                        // only changing the scheduler if the values are not equal (modulo precision) would make this unsound.
-                        if (valueImproved(dir, x[group], choiceValue)) {
-                            schedulerImproved = true;
+                        // If the value is better than the solution of the inner system, we need to improve the scheduler.
+                        ValueType improvement = dir == OptimizationDirection::Minimize ? currentValue - choiceValue : choiceValue - currentValue;
+                        if (improvement > threshold) {
+                            groupChanged = true;
                             scheduler[group] = choice - this->A.getRowGroupIndices()[group];
+                            maximalImprovement = std::max(maximalImprovement, dir == OptimizationDirection::Minimize ? x[group] - choiceValue : choiceValue - x[group]);
+                            currentValue = choiceValue;
+                            threshold = getThreshold(currentValue);
                         }
                     }
+                    if (groupChanged) {
+                        changedGroups.push_back(group);
+                    }
                 }
                 
-                // If the scheduler did not improve, we are done.
-                if (!schedulerImproved) {
-                    status = Status::Converged;
+                if (changedGroups.empty()) {
+                    if (innerPrecision == targetPrecision) {
+                        // If the scheduler did not improve at the target precision, we are done.
+                        status = Status::Converged;
+                    } else {
+                        // Otherwise, solve the current system once more with the target precision.
+                        innerPrecision = targetPrecision;
+                    }
                 } else {
-                    // Update the scheduler and the solver.
-                    submatrix = this->A.selectRowsFromRowGroups(scheduler, true);
-                    submatrix.convertToEquationSystem();
-                    storm::utility::vector::selectVectorValues<ValueType>(subB, scheduler, this->A.getRowGroupIndices(), b);
-                    solver->setMatrix(std::move(submatrix));
+                    // Update the matrix rows and right-hand side entries of the groups whose choice changed. As the
+                    // rows were created with enough space for every choice of their group, the new rows always fit and
+                    // the solver can update the data it derived from the matrix for the changed rows only.
+                    bool replaced = submatrix.replaceRowsFromRowGroups(this->A, scheduler, changedGroups, true);
+                    STORM_LOG_THROW(replaced, storm::exceptions::InvalidStateException, "Unable to replace the rows of the inner equation system.");
+                    for (auto group : changedGroups) {
+                        subB[group] = b[this->A.getRowGroupIndices()[group] + scheduler[group]];
+                    }
+                    solver->updateMatrixRows(submatrix, changedGroups);
+                    
+                    // Adapt the precision of the inner solver to the size of the improvement.
+                    innerPrecision = std::max(targetPrecision, std::min(innerPrecision, maximalImprovement * refinementFactor));
                 }
                 
                 // Update environment variables.
@@ -189,21 +301,6 @@ namespace storm {
             }
         }
         
-        template<typename ValueType>
-        bool StandardMinMaxLinearEquationSolver<ValueType>::valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const {
-            if (dir == OptimizationDirection::Minimize) {
-                if (value1 > value2) {
-                    return true;
-                }
-                return false;
-            } else {
-                if (value1 < value2) {
-                    return true;
-                }
-                return false;
-            }
-        }
-
         template<typename ValueType>
         ValueType StandardMinMaxLinearEquationSolver<ValueType>::getPrecision() const {
             return this->getSettings().getPrecision();
@@ -216,33 +313,38 @@ namespace storm {
 
         template<typename ValueType>
         bool StandardMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
-            if(!linEqSolverA) {
-                linEqSolverA = linearEquationSolverFactory->create(A);
-                linEqSolverA->setCachingEnabled(true);
-            }
-            
-            if (!auxiliaryRowVector.get()) {
-                auxiliaryRowVector = std::make_unique<std::vector<ValueType>>(A.getRowCount());
-            }
-            std::vector<ValueType>& multiplyResult = *auxiliaryRowVector;
-            
+            // As A may have been released, the number of row groups is taken from x.
             if (!auxiliaryRowGroupVector.get()) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(A.getRowGroupCount());
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(x.size());
             }
             std::vector<ValueType>* newX = auxiliaryRowGroupVector.get();
             
             std::vector<ValueType>* currentX = &x;
             
-            // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
+            // If requested, we first iterate in single precision, which halves the memory traffic of the vectors, and
+            // then refine the result in full precision. The iterations of both phases count towards the maximum.
             uint64_t iterations = 0;
+            if (this->getSettings().getUseMixedPrecision()) {
+                iterations = performSinglePrecisionValueIteration(dir, x, b);
+            }
+            
+            // Value iteration only needs the compact copy of A, so A is released (if the solver owns it) to
+            // actually save memory. With mixed precision, A is kept to build the single precision copy.
+            storm::storage::CompactSparseMatrix<ValueType> const* compactMatrix = getCompactMatrix();
+            if (compactMatrix && !this->getSettings().getUseMixedPrecision()) {
+                releaseMatrix();
+            }
+            
+            // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
             
             Status status = Status::InProgress;
             while (status == Status::InProgress) {
-                // Compute x' = A*x + b.
-                linEqSolverA->multiply(*currentX, &b, multiplyResult);
-                
-                // Reduce the vector x' by applying min/max for all non-deterministic choices.
-                storm::utility::vector::reduceVectorMinOrMax(dir, multiplyResult, *newX, this->A.getRowGroupIndices());
+                // Compute x' = min/max(A*x + b) in a single pass over the matrix.
+                if (compactMatrix) {
+                    compactMatrix->multiplyAndReduce(dir, *currentX, &b, *newX);
+                } else {
+                    A.multiplyAndReduce(dir, A.getRowGroupIndices(), *currentX, &b, *newX);
+                }
                 
                 // Determine whether the method converged.
                 if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, this->getSettings().getPrecision(), this->getSettings().getRelativeTerminationCriterion())) {
@@ -265,14 +367,13 @@ namespace storm {
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
-                // Due to a custom termination condition, it may be the case that no iterations are performed. In this
-                // case we need to compute x'= A*x+b once.
-                if (iterations==0) {
-                    linEqSolverA->multiply(x, &b, multiplyResult);
+                // Perform one more multiplication with the final result and keep track of the choices made.
+                std::vector<storm::storage::sparse::state_type> choices(x.size());
+                if (compactMatrix) {
+                    compactMatrix->multiplyAndReduce(dir, x, &b, *auxiliaryRowGroupVector, &choices);
+                } else {
+                    A.multiplyAndReduce(dir, A.getRowGroupIndices(), x, &b, *auxiliaryRowGroupVector, &choices);
                 }
-                std::vector<storm::storage::sparse::state_type> choices(this->A.getRowGroupCount());
-                // Reduce the multiplyResult and keep track of the choices made
-                storm::utility::vector::reduceVectorMinOrMax(dir, multiplyResult, x, this->A.getRowGroupIndices(), &choices);
                 this->scheduler = std::make_unique<storm::storage::TotalScheduler>(std::move(choices));
             }
 
@@ -288,23 +389,382 @@ namespace storm {
         }
         
         template<typename ValueType>
-        void StandardMinMaxLinearEquationSolver<ValueType>::repeatedMultiply(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType>* b, uint_fast64_t n) const {
-            if(!linEqSolverA) {
-                linEqSolverA = linearEquationSolverFactory->create(A);
-                linEqSolverA->setCachingEnabled(true);
+        uint64_t StandardMinMaxLinearEquationSolver<ValueType>::performSinglePrecisionValueIteration(OptimizationDirection, std::vector<ValueType>&, std::vector<ValueType> const&) const {
+            STORM_LOG_WARN("Mixed precision value iteration is only supported for double precision values, falling back to standard value iteration.");
+            return 0;
+        }
+        
+        template<>
+        uint64_t StandardMinMaxLinearEquationSolver<double>::performSinglePrecisionValueIteration(OptimizationDirection dir, std::vector<double>& x, std::vector<double> const& b) const {
+            if (!singlePrecisionA) {
+                restoreMatrix();
+                if (!storm::storage::CompactSparseMatrix<float>::isRepresentable(A)) {
+                    STORM_LOG_WARN("The matrix is too large to be stored with compact indices, falling back to standard value iteration.");
+                    return 0;
+                }
+                singlePrecisionA = std::make_unique<storm::storage::CompactSparseMatrix<float>>(A);
             }
             
-            if (!auxiliaryRowVector.get()) {
-                auxiliaryRowVector = std::make_unique<std::vector<ValueType>>(A.getRowCount());
+            std::vector<float> currentX = storm::utility::vector::toValueType<float>(x);
+            std::vector<float> newX(currentX.size());
+            std::vector<float> singlePrecisionB = storm::utility::vector::toValueType<float>(b);
+            
+            // Single precision iterates can not reliably get closer than a few ulps, so we stop at a coarser precision
+            // and leave the rest to the double precision phase.
+            float precision = std::max(static_cast<float>(this->getSettings().getPrecision()), 1e-5f);
+            
+            uint64_t iterations = 0;
+            bool converged = false;
+            while (!converged && iterations < this->getSettings().getMaximalNumberOfIterations()) {
+                singlePrecisionA->multiplyAndReduce(dir, currentX, &singlePrecisionB, newX);
+                converged = storm::utility::vector::equalModuloPrecision<float>(currentX, newX, precision, this->getSettings().getRelativeTerminationCriterion());
+                std::swap(currentX, newX);
+                ++iterations;
             }
-            std::vector<ValueType>& multiplyResult = *auxiliaryRowVector;
+            STORM_LOG_INFO("Single precision value iteration " << (converged ? "converged" : "stopped") << " after " << iterations << " iterations.");
             
-            for (uint64_t i = 0; i < n; ++i) {
-                linEqSolverA->multiply(x, b, multiplyResult);
+            // Unless the solver is asked to keep its data, the single precision copy is released before the double
+            // precision phase, so the two copies of the matrix are not needed at the same time.
+            if (!this->isCachingEnabled()) {
+                singlePrecisionA.reset();
+            }
+            
+            std::transform(currentX.begin(), currentX.end(), x.begin(), [] (float value) { return static_cast<double>(value); });
+            return iterations;
+        }
+        
+        template<typename ValueType>
+        bool StandardMinMaxLinearEquationSolver<ValueType>::solveEquationsGaussSeidel(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            restoreMatrix();
+            
+            if (!auxiliaryRowGroupVector.get()) {
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(A.getRowGroupCount());
+            }
+            std::vector<ValueType>& previousX = *auxiliaryRowGroupVector;
+            
+            std::vector<uint_fast64_t> const* order = getRowGroupOrder();
+            
+            // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
+            uint64_t iterations = 0;
+            
+            Status status = Status::InProgress;
+            while (status == Status::InProgress) {
+                previousX = x;
+                
+                // Compute x = min/max(A*x + b) in place, i.e. every state already uses the new values of the states
+                // that were processed before it.
+                A.multiplyAndReduceGaussSeidel(dir, A.getRowGroupIndices(), x, &b, nullptr, order);
+                
+                // Determine whether the method converged.
+                if (storm::utility::vector::equalModuloPrecision<ValueType>(previousX, x, this->getSettings().getPrecision(), this->getSettings().getRelativeTerminationCriterion())) {
+                    status = Status::Converged;
+                }
+                
+                ++iterations;
+                status = updateStatusIfNotConverged(status, x, iterations);
+            }
+            
+            reportStatus(status, iterations);
+            
+            // If requested, we store the scheduler for retrieval.
+            if (this->isTrackSchedulerSet()) {
+                std::vector<storm::storage::sparse::state_type> choices(this->A.getRowGroupCount());
+                A.multiplyAndReduce(dir, A.getRowGroupIndices(), x, &b, previousX, &choices);
+                this->scheduler = std::make_unique<storm::storage::TotalScheduler>(std::move(choices));
+            }
+            
+            if(!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return status == Status::Converged || status == Status::TerminatedEarly;
+        }
+        
+        template<typename ValueType>
+        bool StandardMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            restoreMatrix();
+            
+            // When maximizing, the upper bounds of states in end components are not forced down by the iteration (the
+            // scheduler staying in the end component forever keeps them at their initial value), so we iterate on the
+            // system in which the end components are collapsed. When minimizing, the greatest fixed point and the least
+            // one coincide on the systems we are given, because the callers remove the end components beforehand.
+            Status status = Status::InProgress;
+            bool solvedOnQuotient = dir == OptimizationDirection::Maximize && solveEquationsSoundValueIterationOnQuotient(dir, x, b, status);
+            
+            if (!solvedOnQuotient) {
+                if (!auxiliaryRowGroupVector.get()) {
+                    auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(A.getRowGroupCount());
+                }
+                std::vector<ValueType>& upperX = *auxiliaryRowGroupVector;
+                status = performIntervalIteration(dir, A, x, upperX, b, getRowGroupOrder(), true);
+                
+                // If requested, we store the scheduler for retrieval.
+                if (this->isTrackSchedulerSet()) {
+                    std::vector<storm::storage::sparse::state_type> choices(this->A.getRowGroupCount());
+                    A.multiplyAndReduce(dir, A.getRowGroupIndices(), x, &b, upperX, &choices);
+                    this->scheduler = std::make_unique<storm::storage::TotalScheduler>(std::move(choices));
+                }
+            }
+            
+            if(!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            STORM_LOG_THROW(status != Status::MaximalIterationsExceeded, storm::exceptions::NoConvergenceException, "Sound value iteration did not converge within " << this->getSettings().getMaximalNumberOfIterations() << " iterations.");
+            return status == Status::Converged || status == Status::TerminatedEarly;
+        }
+        
+        template<typename ValueType>
+        typename StandardMinMaxLinearEquationSolver<ValueType>::Status StandardMinMaxLinearEquationSolver<ValueType>::performIntervalIteration(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType>& lowerX, std::vector<ValueType>& upperX, std::vector<ValueType> const& b, std::vector<uint_fast64_t> const* order, bool checkTerminationCondition) const {
+            // We iterate a vector of lower bounds and a vector of upper bounds. As the min/max operator is monotone,
+            // the iterates stay lower and upper bounds of the (unique) solution, respectively. Since the iterates are
+            // updated in place, each sweep uses the values that were already computed in the same sweep.
+            std::fill(lowerX.begin(), lowerX.end(), this->lowerBound.get());
+            std::fill(upperX.begin(), upperX.end(), this->upperBound.get());
+            ValueType two = storm::utility::convertNumber<ValueType>(2.0);
+            
+            // Proceed with the iterations until the bounds are sufficiently close or the maximal number of
+            // iterations is reached. The termination criterion is checked on the lower bounds, because they are
+            // the result if the procedure is terminated early.
+            uint64_t iterations = 0;
+            
+            Status status = Status::InProgress;
+            while (status == Status::InProgress) {
+                matrix.multiplyAndReduceGaussSeidel(dir, matrix.getRowGroupIndices(), lowerX, &b, nullptr, order);
+                matrix.multiplyAndReduceGaussSeidel(dir, matrix.getRowGroupIndices(), upperX, &b, nullptr, order);
+                
+                // The difference between the bounds is twice the error we make by taking their mean.
+                if (storm::utility::vector::equalModuloPrecision<ValueType>(upperX, lowerX, two * this->getSettings().getPrecision(), this->getSettings().getRelativeTerminationCriterion())) {
+                    status = Status::Converged;
+                }
+                
+                ++iterations;
+                if (checkTerminationCondition) {
+                    status = updateStatusIfNotConverged(status, lowerX, iterations);
+                } else if (status != Status::Converged && iterations >= this->getSettings().getMaximalNumberOfIterations()) {
+                    status = Status::MaximalIterationsExceeded;
+                }
+            }
+            
+            reportStatus(status, iterations);
+            
+            // Take the mean of the bounds as the result.
+            if (status == Status::Converged) {
+                storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(lowerX, upperX, lowerX, [&two] (ValueType const& lower, ValueType const& upper) { return (lower + upper) / two; });
+            }
+            return status;
+        }
+        
+        template<typename ValueType>
+        bool StandardMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIterationOnQuotient(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, Status& status) const {
+            uint_fast64_t numberOfStates = A.getRowGroupCount();
+            
+            // A choice only stays in an end component if it neither has a positive constant part nor loses probability
+            // mass. We make this visible to the decomposition by redirecting the missing mass to an additional sink.
+            storm::utility::ConstantsComparator<ValueType> comparator;
+            storm::storage::SparseMatrixBuilder<ValueType> builder(A.getRowCount() + 1, numberOfStates + 1, 0, false, true, numberOfStates + 1);
+            for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                builder.newRowGroup(A.getRowGroupIndices()[state]);
+                for (uint_fast64_t row = A.getRowGroupIndices()[state]; row < A.getRowGroupIndices()[state + 1]; ++row) {
+                    for (auto const& entry : A.getRow(row)) {
+                        builder.addNextValue(row, entry.getColumn(), entry.getValue());
+                    }
+                    if (!storm::utility::isZero(b[row]) || !comparator.isOne(A.getRowSum(row))) {
+                        builder.addNextValue(row, numberOfStates, storm::utility::one<ValueType>());
+                    }
+                }
+            }
+            builder.newRowGroup(A.getRowCount());
+            builder.addNextValue(A.getRowCount(), numberOfStates, storm::utility::one<ValueType>());
+            storm::storage::SparseMatrix<ValueType> extendedMatrix = builder.build();
+            
+            storm::storage::BitVector subsystem(numberOfStates + 1, true);
+            subsystem.set(numberOfStates, false);
+            storm::storage::CompactMaximalEndComponentDecomposition<ValueType> mecDecomposition(extendedMatrix, extendedMatrix.transpose(true), subsystem);
+            if (mecDecomposition.getNumberOfMecs() == 0) {
+                return false;
+            }
+            STORM_LOG_TRACE("Collapsing " << mecDecomposition.getNumberOfMecs() << " end components before sound value iteration.");
+            
+            // Mark the choices that stay within their MEC, as they are dropped from the quotient.
+            storm::storage::BitVector stayingChoices(A.getRowCount());
+            for (auto const& choice : mecDecomposition.getChoices()) {
+                stayingChoices.set(choice);
+            }
+            
+            // Every MEC is represented by its smallest state, all other states keep their own quotient state.
+            std::vector<uint_fast64_t> stateToQuotientState(numberOfStates);
+            std::vector<uint_fast64_t> quotientStateToState;
+            for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                uint_fast64_t mec = mecDecomposition.getMecIndex(state);
+                if (mec == storm::storage::CompactMaximalEndComponentDecomposition<ValueType>::NO_MEC || *mecDecomposition.begin(mec) == state) {
+                    stateToQuotientState[state] = quotientStateToState.size();
+                    quotientStateToState.push_back(state);
+                } else {
+                    stateToQuotientState[state] = stateToQuotientState[*mecDecomposition.begin(mec)];
+                }
+            }
+            
+            // Build the quotient. The leaving choices of all MEC states become choices of the MEC and an additional
+            // empty choice represents staying in the MEC forever. We remember the original row of every quotient row.
+            uint_fast64_t const noRow = std::numeric_limits<uint_fast64_t>::max();
+            std::vector<uint_fast64_t> quotientRowToRow;
+            std::vector<ValueType> quotientB;
+            storm::storage::SparseMatrixBuilder<ValueType> quotientBuilder(0, quotientStateToState.size(), 0, false, true, quotientStateToState.size());
+            std::map<uint_fast64_t, ValueType> quotientRow;
+            auto addRow = [&] (uint_fast64_t row) {
+                quotientRow.clear();
+                for (auto const& entry : A.getRow(row)) {
+                    quotientRow[stateToQuotientState[entry.getColumn()]] += entry.getValue();
+                }
+                for (auto const& entry : quotientRow) {
+                    quotientBuilder.addNextValue(quotientRowToRow.size(), entry.first, entry.second);
+                }
+                quotientRowToRow.push_back(row);
+                quotientB.push_back(b[row]);
+            };
+            for (auto state : quotientStateToState) {
+                quotientBuilder.newRowGroup(quotientRowToRow.size());
+                uint_fast64_t mec = mecDecomposition.getMecIndex(state);
+                if (mec == storm::storage::CompactMaximalEndComponentDecomposition<ValueType>::NO_MEC) {
+                    for (uint_fast64_t row = A.getRowGroupIndices()[state]; row < A.getRowGroupIndices()[state + 1]; ++row) {
+                        addRow(row);
+                    }
+                } else {
+                    for (auto mecIt = mecDecomposition.begin(mec), mecIte = mecDecomposition.end(mec); mecIt != mecIte; ++mecIt) {
+                        for (uint_fast64_t row = A.getRowGroupIndices()[*mecIt]; row < A.getRowGroupIndices()[*mecIt + 1]; ++row) {
+                            if (!stayingChoices.get(row)) {
+                                addRow(row);
+                            }
+                        }
+                    }
+                    quotientRowToRow.push_back(noRow);
+                    quotientB.push_back(storm::utility::zero<ValueType>());
+                }
+            }
+            storm::storage::SparseMatrix<ValueType> quotientMatrix = quotientBuilder.build(quotientRowToRow.size(), quotientStateToState.size(), quotientStateToState.size());
+            
+            std::vector<ValueType> lowerQuotientX(quotientStateToState.size());
+            std::vector<ValueType> upperQuotientX(quotientStateToState.size());
+            status = performIntervalIteration(dir, quotientMatrix, lowerQuotientX, upperQuotientX, quotientB, nullptr, false);
+            for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                x[state] = lowerQuotientX[stateToQuotientState[state]];
+            }
+            
+            // If requested, we store the scheduler for retrieval. Outside of MECs, the choices are taken from the
+            // quotient. Within a MEC, the state of the chosen leaving choice takes it, while all other states move
+            // towards this state along staying choices.
+            if (this->isTrackSchedulerSet()) {
+                std::vector<ValueType> quotientMultiplyResult(quotientStateToState.size());
+                std::vector<storm::storage::sparse::state_type> quotientChoices(quotientStateToState.size());
+                quotientMatrix.multiplyAndReduce(dir, quotientMatrix.getRowGroupIndices(), lowerQuotientX, &quotientB, quotientMultiplyResult, &quotientChoices);
                 
-                // Reduce the vector x' by applying min/max for all non-deterministic choices as given by the topmost
-                // element of the min/max operator stack.
-                storm::utility::vector::reduceVectorMinOrMax(dir, multiplyResult, x, this->A.getRowGroupIndices());
+                std::vector<storm::storage::sparse::state_type> choices(numberOfStates);
+                storm::storage::BitVector hasChoice(numberOfStates);
+                for (uint_fast64_t quotientState = 0; quotientState < quotientStateToState.size(); ++quotientState) {
+                    uint_fast64_t row = quotientRowToRow[quotientMatrix.getRowGroupIndices()[quotientState] + quotientChoices[quotientState]];
+                    if (row != noRow) {
+                        uint_fast64_t state = std::upper_bound(A.getRowGroupIndices().begin(), A.getRowGroupIndices().end(), row) - A.getRowGroupIndices().begin() - 1;
+                        choices[state] = row - A.getRowGroupIndices()[state];
+                        hasChoice.set(state);
+                    }
+                }
+                
+                // Whenever a MEC state has a staying choice that reaches a state with a choice, it can take it. If the
+                // MEC is never left, every staying choice is fine.
+                std::vector<uint_fast64_t> const& mecChoices = mecDecomposition.getChoices();
+                std::vector<uint_fast64_t> const& choiceOffsets = mecDecomposition.getChoiceOffsets();
+                std::vector<uint_fast64_t> const& mecStates = mecDecomposition.getStatesOrderedByMecs();
+                for (uint_fast64_t mec = 0; mec < mecDecomposition.getNumberOfMecs(); ++mec) {
+                    uint_fast64_t firstPosition = mecDecomposition.getMecOffsets()[mec];
+                    uint_fast64_t lastPosition = mecDecomposition.getMecOffsets()[mec + 1];
+                    bool leavesMec = std::any_of(mecStates.begin() + firstPosition, mecStates.begin() + lastPosition, [&hasChoice] (uint_fast64_t state) { return hasChoice.get(state); });
+                    bool changed = true;
+                    while (changed) {
+                        changed = false;
+                        for (uint_fast64_t position = firstPosition; position < lastPosition; ++position) {
+                            uint_fast64_t state = mecStates[position];
+                            if (hasChoice.get(state)) {
+                                continue;
+                            }
+                            for (uint_fast64_t choiceIndex = choiceOffsets[position]; choiceIndex < choiceOffsets[position + 1]; ++choiceIndex) {
+                                uint_fast64_t row = mecChoices[choiceIndex];
+                                bool reachesChosenState = !leavesMec || std::any_of(A.getRow(row).begin(), A.getRow(row).end(), [&hasChoice] (storm::storage::MatrixEntry<uint_fast64_t, ValueType> const& entry) { return !storm::utility::isZero(entry.getValue()) && hasChoice.get(entry.getColumn()); });
+                                if (reachesChosenState) {
+                                    choices[state] = row - A.getRowGroupIndices()[state];
+                                    hasChoice.set(state);
+                                    changed = true;
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                }
+                this->scheduler = std::make_unique<storm::storage::TotalScheduler>(std::move(choices));
+            }
+            
+            return true;
+        }
+        
+        template<typename ValueType>
+        storm::storage::CompactSparseMatrix<ValueType> const* StandardMinMaxLinearEquationSolver<ValueType>::getCompactMatrix() const {
+            if (!this->getSettings().getUseCompactMatrix()) {
+                return nullptr;
+            }
+            
+            if (!compactA) {
+                STORM_LOG_WARN_COND(storm::storage::CompactSparseMatrix<ValueType>::isRepresentable(A), "The matrix is too large to be stored with compact indices.");
+                if (storm::storage::CompactSparseMatrix<ValueType>::isRepresentable(A)) {
+                    compactA = std::make_unique<storm::storage::CompactSparseMatrix<ValueType>>(A);
+                }
+            }
+            return compactA.get();
+        }
+        
+        template<typename ValueType>
+        void StandardMinMaxLinearEquationSolver<ValueType>::releaseMatrix() const {
+            if (localA && compactA && !matrixReleased) {
+                *localA = storm::storage::SparseMatrix<ValueType>();
+                matrixReleased = true;
+            }
+        }
+        
+        template<typename ValueType>
+        void StandardMinMaxLinearEquationSolver<ValueType>::restoreMatrix() const {
+            if (matrixReleased) {
+                STORM_LOG_INFO("Restoring the matrix of the solver from its compact copy.");
+                *localA = compactA->toSparseMatrix();
+                matrixReleased = false;
+            }
+        }
+        
+        template<typename ValueType>
+        std::vector<uint_fast64_t> const* StandardMinMaxLinearEquationSolver<ValueType>::getRowGroupOrder() const {
+            if (!this->getSettings().getUseTopologicalOrder()) {
+                return nullptr;
+            }
+            
+            // Process the states such that the successor SCCs of a state are treated before the state itself. As the
+            // SCC decomposition yields the SCCs in reverse topological order, this is just the order in which the
+            // states appear in the decomposition.
+            if (!rowGroupOrder) {
+                storm::storage::CompactStronglyConnectedComponentDecomposition<ValueType> sccDecomposition(A);
+                rowGroupOrder = std::make_unique<std::vector<uint_fast64_t>>(sccDecomposition.getStatesOrderedBySccs());
+            }
+            return rowGroupOrder.get();
+        }
+        
+        template<typename ValueType>
+        void StandardMinMaxLinearEquationSolver<ValueType>::repeatedMultiply(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType>* b, uint_fast64_t n) const {
+            restoreMatrix();
+            if (!auxiliaryRowGroupVector.get()) {
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(A.getRowGroupCount());
+            }
+            
+            for (uint64_t i = 0; i < n; ++i) {
+                // Compute x' = min/max(A*x + b) in a single pass over the matrix.
+                A.multiplyAndReduce(dir, A.getRowGroupIndices(), x, b, *auxiliaryRowGroupVector);
+                std::swap(x, *auxiliaryRowGroupVector);
             }
             
             if(!this->isCachingEnabled()) {
@@ -347,9 +807,13 @@ namespace storm {
         
         template<typename ValueType>
         void StandardMinMaxLinearEquationSolver<ValueType>::clearCache() const {
-            linEqSolverA.reset();
-            auxiliaryRowVector.reset();
             auxiliaryRowGroupVector.reset();
+            rowGroupOrder.reset();
+            // If A was released, the compact copy is the only copy of the matrix and must be kept.
+            if (!matrixReleased) {
+                compactA.reset();
+            }
+            singlePrecisionA.reset();
             MinMaxLinearEquationSolver<ValueType>::clearCache();
         }
 
@@ -370,6 +834,7 @@ namespace storm {
                 case EquationSolverType::Eigen: linearEquationSolverFactory = std::make_unique<EigenLinearEquationSolverFactory<ValueType>>(); break;
                 case EquationSolverType::Native: linearEquationSolverFactory = std::make_unique<NativeLinearEquationSolverFactory<ValueType>>(); break;
                 case EquationSolverType::Elimination: linearEquationSolverFactory = std::make_unique<EliminationLinearEquationSolverFactory<ValueType>>(); break;
+                case EquationSolverType::Topological: linearEquationSolverFactory = std::make_unique<TopologicalLinearEquationSolverFactory<ValueType>>(); break;
             }
         }
         
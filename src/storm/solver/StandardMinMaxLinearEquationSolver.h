@@ -3,6 +3,8 @@
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 
+#include "storm/storage/CompactSparseMatrix.h"
+
 namespace storm {
     namespace solver {
         
@@ -12,10 +14,14 @@ namespace storm {
             StandardMinMaxLinearEquationSolverSettings();
             
             enum class SolutionMethod {
-                ValueIteration, PolicyIteration
+                ValueIteration, GaussSeidel, PolicyIteration
             };
             
             void setSolutionMethod(SolutionMethod const& solutionMethod);
+            void setUseTopologicalOrder(bool value);
+            void setForceSoundness(bool value);
+            void setUseMixedPrecision(bool value);
+            void setUseCompactMatrix(bool value);
             void setMaximalNumberOfIterations(uint64_t maximalNumberOfIterations);
             void setRelativeTerminationCriterion(bool value);
             void setPrecision(ValueType precision);
@@ -24,12 +30,20 @@ namespace storm {
             uint64_t getMaximalNumberOfIterations() const;
             ValueType getPrecision() const;
             bool getRelativeTerminationCriterion() const;
+            bool getUseTopologicalOrder() const;
+            bool getForceSoundness() const;
+            bool getUseMixedPrecision() const;
+            bool getUseCompactMatrix() const;
 
         private:
             SolutionMethod solutionMethod;
             uint64_t maximalNumberOfIterations;
             ValueType precision;
             bool relative;
+            bool useTopologicalOrder;
+            bool forceSoundness;
+            bool useMixedPrecision;
+            bool useCompactMatrix;
         };
         
         template<typename ValueType>
@@ -49,19 +63,45 @@ namespace storm {
             virtual ValueType getPrecision() const override;
             virtual bool getRelative() const override;
         private:
+            enum class Status {
+                Converged, TerminatedEarly, MaximalIterationsExceeded, InProgress
+            };
+            
             bool solveEquationsPolicyIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             bool solveEquationsValueIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            bool solveEquationsGaussSeidel(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            bool solveEquationsSoundValueIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
-            bool valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const;
+            // Iterates the lower and upper bounds of interval iteration on the given system until they are sufficiently
+            // close. The custom termination condition is only checked if the system is the one of this solver.
+            Status performIntervalIteration(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType>& lowerX, std::vector<ValueType>& upperX, std::vector<ValueType> const& b, std::vector<uint_fast64_t> const* order, bool checkTerminationCondition) const;
             
-            enum class Status {
-                Converged, TerminatedEarly, MaximalIterationsExceeded, InProgress
-            };
+            // Performs interval iteration on the system in which every maximal end component is collapsed into a
+            // single state. Returns true iff the system had at least one end component (and x was set).
+            bool solveEquationsSoundValueIterationOnQuotient(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, Status& status) const;
+
+            // Performs value iteration on a single precision copy of the system until the iterates converge up to the
+            // precision that can be reached in single precision and stores the result in x. Returns the number of
+            // iterations that were performed.
+            uint64_t performSinglePrecisionValueIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
+            // Retrieves a compact copy of A if the settings request it and A is small enough (or null otherwise).
+            storm::storage::CompactSparseMatrix<ValueType> const* getCompactMatrix() const;
+
+            // If the solver owns A and there is a compact copy of it, releases A so that only the copy is kept.
+            void releaseMatrix() const;
+
+            // If A was released, restores it from its compact copy. Must be called before using A.
+            void restoreMatrix() const;
+
+            // Retrieves the order in which Gauss-Seidel sweeps process the row groups (or null for the natural order).
+            std::vector<uint_fast64_t> const* getRowGroupOrder() const;
             
             // possibly cached data
-            mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolverA;
-            mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowVector; // A.rowCount() entries
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector; // A.rowGroupCount() entries
+            mutable std::unique_ptr<std::vector<uint_fast64_t>> rowGroupOrder; // A.rowGroupCount() entries
+            mutable std::unique_ptr<storm::storage::CompactSparseMatrix<ValueType>> compactA; // A copy of A with compact indices
+            mutable std::unique_ptr<storm::storage::CompactSparseMatrix<float>> singlePrecisionA; // A copy of A in single precision
 
             Status updateStatusIfNotConverged(Status status, std::vector<ValueType> const& x, uint64_t iterations) const;
             void reportStatus(Status status, uint64_t iterations) const;
@@ -73,13 +113,17 @@ namespace storm {
             std::unique_ptr<LinearEquationSolverFactory<ValueType>> linearEquationSolverFactory;
             
             // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
-            // when the solver is destructed.
+            // when the solver is destructed. While value iteration runs on the compact copy of the matrix, this
+            // matrix is released (see releaseMatrix).
             std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
             
             // A reference to the original sparse matrix given to this solver. If the solver takes posession of the matrix
             // the reference refers to localA.
             storm::storage::SparseMatrix<ValueType> const& A;
             
+            // A flag indicating whether localA was released, i.e. whether compactA is the only copy of the matrix.
+            mutable bool matrixReleased;
+            
         };
      
         template<typename ValueType>
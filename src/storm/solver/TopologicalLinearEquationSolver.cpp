@@ -0,0 +1,314 @@
+#include "storm/solver/TopologicalLinearEquationSolver.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "storm/solver/NativeLinearEquationSolver.h"
+
+#include "storm/storage/CompactStronglyConnectedComponentDecomposition.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/exceptions/InvalidStateException.h"
+
+namespace storm {
+    namespace solver {
+
+        namespace {
+            // The minimal number of states a level of the SCC DAG needs to have in order to solve its SCCs in parallel.
+            static const uint_fast64_t MINIMAL_PARALLEL_LEVEL_SIZE = 1024;
+        }
+
+        template<typename ValueType>
+        TopologicalLinearEquationSolver<ValueType>::TopologicalLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& sccSolverFactory) : localA(nullptr), A(nullptr), sccSolverFactory(std::move(sccSolverFactory)) {
+            if (!this->sccSolverFactory) {
+                this->sccSolverFactory = std::make_unique<NativeLinearEquationSolverFactory<ValueType>>();
+            }
+            this->setMatrix(A);
+        }
+
+        template<typename ValueType>
+        TopologicalLinearEquationSolver<ValueType>::TopologicalLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& sccSolverFactory) : localA(nullptr), A(nullptr), sccSolverFactory(std::move(sccSolverFactory)) {
+            if (!this->sccSolverFactory) {
+                this->sccSolverFactory = std::make_unique<NativeLinearEquationSolverFactory<ValueType>>();
+            }
+            this->setMatrix(std::move(A));
+        }
+
+        template<typename ValueType>
+        void TopologicalLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& A) {
+            localA.reset();
+            this->A = &A;
+            clearCache();
+        }
+
+        template<typename ValueType>
+        void TopologicalLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& A) {
+            localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A));
+            this->A = localA.get();
+            clearCache();
+        }
+
+        template<typename ValueType>
+        bool TopologicalLinearEquationSolver<ValueType>::solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_DEBUG("Solving equation system SCC by SCC.");
+
+            SccData const& data = getSccData();
+
+            // Treat the levels of the SCC DAG one after another. As the SCCs of one level only depend on SCCs of
+            // lower levels, they can be solved independently of each other.
+            std::atomic<bool> converged(true);
+            for (uint_fast64_t level = 0; level + 1 < data.levelIndices.size(); ++level) {
+                uint_fast64_t firstScc = data.levelIndices[level];
+                uint_fast64_t numberOfSccs = data.levelIndices[level + 1] - firstScc;
+
+                uint_fast64_t numberOfStates = 0;
+                for (uint_fast64_t index = firstScc; index < firstScc + numberOfSccs; ++index) {
+                    uint_fast64_t scc = data.sccsByLevel[index];
+                    numberOfStates += data.sccIndices[scc + 1] - data.sccIndices[scc];
+                }
+
+                if (numberOfSccs > 1 && numberOfStates >= MINIMAL_PARALLEL_LEVEL_SIZE && storm::utility::parallel::isParallelismEnabled()) {
+                    storm::utility::parallel::getThreadPool().execute(numberOfSccs, [&] (uint_fast64_t index) {
+                        if (!solveScc(data, data.sccsByLevel[firstScc + index], x, b)) {
+                            converged = false;
+                        }
+                    });
+                } else {
+                    for (uint_fast64_t index = firstScc; index < firstScc + numberOfSccs; ++index) {
+                        if (!solveScc(data, data.sccsByLevel[index], x, b)) {
+                            converged = false;
+                        }
+                    }
+                }
+            }
+
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+
+            return converged;
+        }
+
+        template<typename ValueType>
+        bool TopologicalLinearEquationSolver<ValueType>::solveScc(SccData const& data, uint_fast64_t scc, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            uint_fast64_t const* sccBegin = data.states.data() + data.sccIndices[scc];
+            uint_fast64_t const* sccEnd = data.states.data() + data.sccIndices[scc + 1];
+
+            if (sccEnd - sccBegin == 1) {
+                // If the SCC consists of a single state, we can directly compute its value from the values of its
+                // successors, because x_s = (b_s - sum_{t != s} A_st * x_t) / A_ss.
+                uint_fast64_t state = *sccBegin;
+                ValueType diagonal = storm::utility::zero<ValueType>();
+                ValueType value = b[state];
+                for (auto const& entry : A->getRow(state)) {
+                    if (entry.getColumn() == state) {
+                        diagonal += entry.getValue();
+                    } else {
+                        value -= entry.getValue() * x[entry.getColumn()];
+                    }
+                }
+                STORM_LOG_THROW(!storm::utility::isZero(diagonal), storm::exceptions::InvalidStateException, "The equation system does not have a unique solution, because the diagonal entry of row " << state << " is zero.");
+                x[state] = value / diagonal;
+                return true;
+            }
+
+            // Otherwise, we move the contribution of the already solved states to the right-hand side and solve the
+            // equation system restricted to the SCC.
+            std::vector<ValueType> sccX;
+            std::vector<ValueType> sccB;
+            sccX.reserve(sccEnd - sccBegin);
+            sccB.reserve(sccEnd - sccBegin);
+            for (uint_fast64_t const* stateIt = sccBegin; stateIt != sccEnd; ++stateIt) {
+                ValueType value = b[*stateIt];
+                for (auto const& entry : A->getRow(*stateIt)) {
+                    if (data.stateToScc[entry.getColumn()] != scc) {
+                        value -= entry.getValue() * x[entry.getColumn()];
+                    }
+                }
+                sccB.push_back(value);
+                sccX.push_back(x[*stateIt]);
+            }
+
+            bool converged = data.sccSolvers[scc]->solveEquations(sccX, sccB);
+
+            for (uint_fast64_t const* stateIt = sccBegin; stateIt != sccEnd; ++stateIt) {
+                x[*stateIt] = sccX[stateIt - sccBegin];
+            }
+            return converged;
+        }
+
+        template<typename ValueType>
+        typename TopologicalLinearEquationSolver<ValueType>::SccData const& TopologicalLinearEquationSolver<ValueType>::getSccData() const {
+            if (sccData) {
+                return *sccData;
+            }
+
+            sccData = std::make_unique<SccData>();
+            SccData& data = *sccData;
+            uint_fast64_t numberOfStates = A->getRowCount();
+
+            // The SCC decomposition yields the SCCs in reverse topological order, i.e. the successors of an SCC always
+            // have smaller indices, and the states within every SCC are sorted, so the columns of the restricted
+            // matrices are ordered in the same way as the ones of the original matrix.
+            storm::storage::CompactStronglyConnectedComponentDecomposition<ValueType> decomposition(*A);
+            data.states = decomposition.getStatesOrderedBySccs();
+            data.sccIndices = decomposition.getSccOffsets();
+            data.stateToScc = decomposition.getStateToSccMapping();
+            data.stateToLocalIndex.resize(numberOfStates);
+            for (uint_fast64_t scc = 0; scc < decomposition.getNumberOfSccs(); ++scc) {
+                for (uint_fast64_t position = data.sccIndices[scc]; position < data.sccIndices[scc + 1]; ++position) {
+                    data.stateToLocalIndex[data.states[position]] = position - data.sccIndices[scc];
+                }
+            }
+            uint_fast64_t numberOfSccs = data.sccIndices.size() - 1;
+
+            // Compute the level of every SCC in the DAG of SCCs, i.e. the length of the longest path to a bottom SCC.
+            // As the successor SCCs are treated first, their levels are already known.
+            std::vector<uint_fast64_t> sccToLevel(numberOfSccs, 0);
+            uint_fast64_t numberOfLevels = 0;
+            for (uint_fast64_t scc = 0; scc < numberOfSccs; ++scc) {
+                uint_fast64_t level = 0;
+                for (uint_fast64_t position = data.sccIndices[scc]; position < data.sccIndices[scc + 1]; ++position) {
+                    for (auto const& entry : A->getRow(data.states[position])) {
+                        uint_fast64_t successorScc = data.stateToScc[entry.getColumn()];
+                        if (successorScc != scc) {
+                            level = std::max(level, sccToLevel[successorScc] + 1);
+                        }
+                    }
+                }
+                sccToLevel[scc] = level;
+                numberOfLevels = std::max(numberOfLevels, level + 1);
+            }
+
+            // Group the SCCs by their level (using a counting sort).
+            data.levelIndices.assign(numberOfLevels + 1, 0);
+            for (auto level : sccToLevel) {
+                ++data.levelIndices[level + 1];
+            }
+            for (uint_fast64_t level = 1; level <= numberOfLevels; ++level) {
+                data.levelIndices[level] += data.levelIndices[level - 1];
+            }
+            data.sccsByLevel.resize(numberOfSccs);
+            std::vector<uint_fast64_t> nextPosition(data.levelIndices.begin(), data.levelIndices.end() - 1);
+            for (uint_fast64_t scc = 0; scc < numberOfSccs; ++scc) {
+                data.sccsByLevel[nextPosition[sccToLevel[scc]]++] = scc;
+            }
+
+            // Finally, create the solvers for the nontrivial SCCs.
+            data.sccSolvers.resize(numberOfSccs);
+            for (uint_fast64_t scc = 0; scc < numberOfSccs; ++scc) {
+                uint_fast64_t sccSize = data.sccIndices[scc + 1] - data.sccIndices[scc];
+                if (sccSize == 1) {
+                    continue;
+                }
+
+                storm::storage::SparseMatrixBuilder<ValueType> builder(sccSize, sccSize);
+                for (uint_fast64_t position = data.sccIndices[scc]; position < data.sccIndices[scc + 1]; ++position) {
+                    for (auto const& entry : A->getRow(data.states[position])) {
+                        if (data.stateToScc[entry.getColumn()] == scc) {
+                            builder.addNextValue(position - data.sccIndices[scc], data.stateToLocalIndex[entry.getColumn()], entry.getValue());
+                        }
+                    }
+                }
+
+                std::unique_ptr<LinearEquationSolver<ValueType>> solver = sccSolverFactory->create(builder.build());
+                solver->setCachingEnabled(true);
+                if (this->lowerBound) {
+                    solver->setLowerBound(this->lowerBound.get());
+                }
+                if (this->upperBound) {
+                    solver->setUpperBound(this->upperBound.get());
+                }
+                if (precision) {
+                    solver->setPrecision(precision.get());
+                }
+                data.sccSolvers[scc] = std::move(solver);
+            }
+
+            STORM_LOG_DEBUG("Equation system has " << numberOfSccs << " SCCs in " << numberOfLevels << " levels.");
+            return data;
+        }
+
+        template<typename ValueType>
+        void TopologicalLinearEquationSolver<ValueType>::multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            if (&x != &result) {
+                A->multiplyWithVector(x, result, b);
+            } else {
+                // If the two vectors are aliases, we need to create a temporary.
+                if (!this->cachedRowVector) {
+                    this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+                }
+
+                A->multiplyWithVector(x, *this->cachedRowVector, b);
+                result.swap(*this->cachedRowVector);
+
+                if (!this->isCachingEnabled()) {
+                    clearCache();
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void TopologicalLinearEquationSolver<ValueType>::setPrecision(ValueType const& precision) {
+            this->precision = precision;
+            if (sccData) {
+                for (auto& solver : sccData->sccSolvers) {
+                    if (solver) {
+                        solver->setPrecision(precision);
+                    }
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void TopologicalLinearEquationSolver<ValueType>::clearCache() const {
+            sccData.reset();
+            LinearEquationSolver<ValueType>::clearCache();
+        }
+
+        template<typename ValueType>
+        uint64_t TopologicalLinearEquationSolver<ValueType>::getMatrixRowCount() const {
+            return this->A->getRowCount();
+        }
+
+        template<typename ValueType>
+        uint64_t TopologicalLinearEquationSolver<ValueType>::getMatrixColumnCount() const {
+            return this->A->getColumnCount();
+        }
+
+        template<typename ValueType>
+        TopologicalLinearEquationSolverFactory<ValueType>::TopologicalLinearEquationSolverFactory() : sccSolverFactory(nullptr) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        TopologicalLinearEquationSolverFactory<ValueType>::TopologicalLinearEquationSolverFactory(std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& sccSolverFactory) : sccSolverFactory(std::move(sccSolverFactory)) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        TopologicalLinearEquationSolverFactory<ValueType>::TopologicalLinearEquationSolverFactory(TopologicalLinearEquationSolverFactory const& other) : sccSolverFactory(other.sccSolverFactory ? other.sccSolverFactory->clone() : nullptr) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> TopologicalLinearEquationSolverFactory<ValueType>::create(storm::storage::SparseMatrix<ValueType> const& matrix) const {
+            return std::make_unique<storm::solver::TopologicalLinearEquationSolver<ValueType>>(matrix, sccSolverFactory ? sccSolverFactory->clone() : nullptr);
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> TopologicalLinearEquationSolverFactory<ValueType>::create(storm::storage::SparseMatrix<ValueType>&& matrix) const {
+            return std::make_unique<storm::solver::TopologicalLinearEquationSolver<ValueType>>(std::move(matrix), sccSolverFactory ? sccSolverFactory->clone() : nullptr);
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<LinearEquationSolverFactory<ValueType>> TopologicalLinearEquationSolverFactory<ValueType>::clone() const {
+            return std::make_unique<TopologicalLinearEquationSolverFactory<ValueType>>(*this);
+        }
+
+        template class TopologicalLinearEquationSolver<double>;
+        template class TopologicalLinearEquationSolverFactory<double>;
+    }
+}
@@ -0,0 +1,108 @@
+#ifndef STORM_SOLVER_TOPOLOGICALLINEAREQUATIONSOLVER_H_
+#define STORM_SOLVER_TOPOLOGICALLINEAREQUATIONSOLVER_H_
+
+#include <boost/optional.hpp>
+
+#include "storm/solver/LinearEquationSolver.h"
+
+namespace storm {
+    namespace solver {
+
+        /*!
+         * A class that solves the equation system in topological order of its strongly connected components (SCCs),
+         * i.e. an SCC is only treated once the values of all SCCs it depends on are known. SCCs consisting of a
+         * single state are solved by direct substitution and all other SCCs are solved by a separate solver that is
+         * restricted to the SCC. SCCs that do not depend on each other are solved concurrently if parallelism is
+         * enabled.
+         */
+        template<typename ValueType>
+        class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
+        public:
+            TopologicalLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& sccSolverFactory = nullptr);
+            TopologicalLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& sccSolverFactory = nullptr);
+
+            virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& A) override;
+            virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) override;
+
+            virtual bool solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+            virtual void multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+
+            virtual void setPrecision(ValueType const& precision) override;
+
+            virtual void clearCache() const override;
+
+        private:
+            // The data describing the SCCs of the matrix that is needed to solve the equation system.
+            struct SccData {
+                // The states of all SCCs in reverse topological order. The states of SCC i are stored in the range
+                // [sccIndices[i], sccIndices[i + 1]).
+                std::vector<uint_fast64_t> states;
+                std::vector<uint_fast64_t> sccIndices;
+
+                // The SCC of each state and the position of each state within its SCC.
+                std::vector<uint_fast64_t> stateToScc;
+                std::vector<uint_fast64_t> stateToLocalIndex;
+
+                // The SCCs grouped by their level in the DAG of SCCs. The SCCs of level i are stored in the range
+                // [levelIndices[i], levelIndices[i + 1]) and only depend on SCCs of lower levels.
+                std::vector<uint_fast64_t> sccsByLevel;
+                std::vector<uint_fast64_t> levelIndices;
+
+                // For every nontrivial SCC, a solver for the equation system restricted to the SCC.
+                std::vector<std::unique_ptr<LinearEquationSolver<ValueType>>> sccSolvers;
+            };
+
+            /*!
+             * Retrieves the SCC data of the matrix, which is created if it is not yet cached.
+             */
+            SccData const& getSccData() const;
+
+            /*!
+             * Solves the equation system restricted to the given SCC, assuming that the values of all states the SCC
+             * depends on are already stored in x.
+             *
+             * @return True iff the solver of the SCC (if any) converged.
+             */
+            bool solveScc(SccData const& data, uint_fast64_t scc, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
+            virtual uint64_t getMatrixRowCount() const override;
+            virtual uint64_t getMatrixColumnCount() const override;
+
+            // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
+            // when the solver is destructed.
+            std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
+
+            // A pointer to the original sparse matrix given to this solver. If the solver takes posession of the matrix
+            // the pointer refers to localA.
+            storm::storage::SparseMatrix<ValueType> const* A;
+
+            // The factory used to create the solvers for the nontrivial SCCs.
+            std::unique_ptr<LinearEquationSolverFactory<ValueType>> sccSolverFactory;
+
+            // The precision that is passed to the solvers of the SCCs if one was set.
+            boost::optional<ValueType> precision;
+
+            // The SCC data of the matrix.
+            mutable std::unique_ptr<SccData> sccData;
+        };
+
+        template<typename ValueType>
+        class TopologicalLinearEquationSolverFactory : public LinearEquationSolverFactory<ValueType> {
+        public:
+            TopologicalLinearEquationSolverFactory();
+            TopologicalLinearEquationSolverFactory(std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& sccSolverFactory);
+            TopologicalLinearEquationSolverFactory(TopologicalLinearEquationSolverFactory const& other);
+
+            virtual std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> create(storm::storage::SparseMatrix<ValueType> const& matrix) const override;
+            virtual std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> create(storm::storage::SparseMatrix<ValueType>&& matrix) const override;
+
+            virtual std::unique_ptr<LinearEquationSolverFactory<ValueType>> clone() const override;
+
+        private:
+            // The factory used to create the solvers for the nontrivial SCCs. If not set, the native solver is used.
+            std::unique_ptr<LinearEquationSolverFactory<ValueType>> sccSolverFactory;
+        };
+    }
+}
+
+#endif /* STORM_SOLVER_TOPOLOGICALLINEAREQUATIONSOLVER_H_ */
@@ -3,7 +3,7 @@
 #include <utility>
 #include "storm/utility/vector.h"
 #include "storm/utility/graph.h"
-#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/CompactStronglyConnectedComponentDecomposition.h"
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 
@@ -116,17 +116,20 @@ namespace storm {
 				throw storm::exceptions::InvalidStateException() << "The useGpu Flag of a SCC was set, but this version of storm does not support CUDA acceleration. Internal Error!";
 #endif
 			} else {
-				storm::storage::BitVector fullSystem(this->A.getRowGroupCount(), true);
-				storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(this->A, fullSystem, false, false);
+				storm::storage::CompactStronglyConnectedComponentDecomposition<ValueType> sccDecomposition(this->A);
 
-                STORM_LOG_THROW(sccDecomposition.size() > 0, storm::exceptions::IllegalArgumentException, "Can not solve given equation system as the SCC decomposition returned no SCCs.");
+                STORM_LOG_THROW(sccDecomposition.getNumberOfSccs() > 0, storm::exceptions::IllegalArgumentException, "Can not solve given equation system as the SCC decomposition returned no SCCs.");
 
-                storm::storage::SparseMatrix<ValueType> stronglyConnectedComponentsDependencyGraph = sccDecomposition.extractPartitionDependencyGraph(this->A);
-				std::vector<uint_fast64_t> topologicalSort = storm::utility::graph::getTopologicalSort(stronglyConnectedComponentsDependencyGraph);
+				// The SCCs are numbered in reverse topological order, so every SCC comes after the SCCs it depends on.
+				std::vector<storm::storage::StateBlock> topologicallySortedSccs;
+				topologicallySortedSccs.reserve(sccDecomposition.getNumberOfSccs());
+				for (uint_fast64_t scc = 0; scc < sccDecomposition.getNumberOfSccs(); ++scc) {
+					topologicallySortedSccs.emplace_back(sccDecomposition.begin(scc), sccDecomposition.end(scc), true);
+				}
 
 				// Calculate the optimal distribution of sccs
-				std::vector<std::pair<bool, storm::storage::StateBlock>> optimalSccs = this->getOptimalGroupingFromTopologicalSccDecomposition(sccDecomposition, topologicalSort, this->A);
-				STORM_LOG_INFO("Optimized SCC Decomposition, originally " << topologicalSort.size() << " SCCs, optimized to " << optimalSccs.size() << " SCCs.");
+				std::vector<std::pair<bool, storm::storage::StateBlock>> optimalSccs = this->getOptimalGroupingFromTopologicalSccDecomposition(topologicallySortedSccs, this->A);
+				STORM_LOG_INFO("Optimized SCC Decomposition, originally " << topologicallySortedSccs.size() << " SCCs, optimized to " << optimalSccs.size() << " SCCs.");
 
 				std::vector<ValueType>* currentX = nullptr;
 				std::vector<ValueType>* swap = nullptr;
@@ -287,7 +290,7 @@ namespace storm {
 
 		template<typename ValueType>
 		std::vector<std::pair<bool, storm::storage::StateBlock>>
-			TopologicalMinMaxLinearEquationSolver<ValueType>::getOptimalGroupingFromTopologicalSccDecomposition(storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sccDecomposition, std::vector<uint_fast64_t> const& topologicalSort, storm::storage::SparseMatrix<ValueType> const& matrix) const {
+			TopologicalMinMaxLinearEquationSolver<ValueType>::getOptimalGroupingFromTopologicalSccDecomposition(std::vector<storm::storage::StateBlock> const& topologicallySortedSccs, storm::storage::SparseMatrix<ValueType> const& matrix) const {
                 
                 (void)matrix;
                 
@@ -307,8 +310,8 @@ namespace storm {
 				size_t currentSize = 0;
 				size_t neededReserveSize = 0;
 				size_t startIndex = 0;
-				for (size_t i = 0; i < topologicalSort.size(); ++i) {
-					storm::storage::StateBlock const& scc = sccDecomposition[topologicalSort[i]];
+				for (size_t i = 0; i < topologicallySortedSccs.size(); ++i) {
+					storm::storage::StateBlock const& scc = topologicallySortedSccs[i];
 					size_t const currentSccSize = scc.size();
 
 					uint_fast64_t rowCount = 0;
@@ -335,13 +338,13 @@ namespace storm {
 								tempGroups.reserve(neededReserveSize);
 
 								// Copy the first group to make inplace_merge possible
-								storm::storage::StateBlock const& scc_first = sccDecomposition[topologicalSort[startIndex]];
+								storm::storage::StateBlock const& scc_first = topologicallySortedSccs[startIndex];
 								tempGroups.insert(tempGroups.cend(), scc_first.cbegin(), scc_first.cend());
 
 								if (((startIndex + 1) + 80) >= i) {
 									size_t lastSize = 0;
-									for (size_t j = startIndex + 1; j < topologicalSort.size(); ++j) {
-										storm::storage::StateBlock const& scc = sccDecomposition[topologicalSort[j]];
+									for (size_t j = startIndex + 1; j < topologicallySortedSccs.size(); ++j) {
+										storm::storage::StateBlock const& scc = topologicallySortedSccs[j];
 										lastSize = tempGroups.size();
 										tempGroups.insert(tempGroups.cend(), scc.cbegin(), scc.cend());
 										std::vector<uint_fast64_t>::iterator middleIterator = tempGroups.begin();
@@ -351,7 +354,7 @@ namespace storm {
 								} else {
 									// Use std::sort
 									for (size_t j = startIndex + 1; j < i; ++j) {
-										storm::storage::StateBlock const& scc = sccDecomposition[topologicalSort[j]];
+										storm::storage::StateBlock const& scc = topologicallySortedSccs[j];
 										tempGroups.insert(tempGroups.cend(), scc.cbegin(), scc.cend());
 									}
 									std::sort(tempGroups.begin(), tempGroups.end());
@@ -359,7 +362,7 @@ namespace storm {
 								result.push_back(std::make_pair(true, storm::storage::StateBlock(tempGroups.cbegin(), tempGroups.cend())));
 							} else {
 								// Only one group, copy construct.
-								result.push_back(std::make_pair(true, storm::storage::StateBlock(std::move(sccDecomposition[topologicalSort[startIndex]]))));
+								result.push_back(std::make_pair(true, storm::storage::StateBlock(topologicallySortedSccs[startIndex])));
 							}
 							++lastResultIndex;
 						}
@@ -370,7 +373,7 @@ namespace storm {
 							startIndex = i;
 						} else {
 							// This group is too big to fit into the CUDA Memory by itself
-							result.push_back(std::make_pair(false, storm::storage::StateBlock(std::move(sccDecomposition[topologicalSort[i]]))));
+							result.push_back(std::make_pair(false, storm::storage::StateBlock(topologicallySortedSccs[i])));
 							++lastResultIndex;
 
 							currentSize = 0;
@@ -380,7 +383,7 @@ namespace storm {
 					}
 				}
 
-				size_t const topologicalSortSize = topologicalSort.size();
+				size_t const topologicalSortSize = topologicallySortedSccs.size();
 				if (startIndex < topologicalSortSize) {
 					if ((startIndex + 1) < topologicalSortSize) {
 						// More than one component
@@ -388,14 +391,14 @@ namespace storm {
 						tempGroups.reserve(neededReserveSize);
 						
 						// Copy the first group to make inplace_merge possible.
-						storm::storage::StateBlock const& scc_first = sccDecomposition[topologicalSort[startIndex]];
+						storm::storage::StateBlock const& scc_first = topologicallySortedSccs[startIndex];
 						tempGroups.insert(tempGroups.cend(), scc_first.cbegin(), scc_first.cend());
 
 						// For set counts <= 80, in-place merge is faster.
 						if (((startIndex + 1) + 80) >= topologicalSortSize) {
 							size_t lastSize = 0;
-							for (size_t j = startIndex + 1; j < topologicalSort.size(); ++j) {
-								storm::storage::StateBlock const& scc = sccDecomposition[topologicalSort[j]];
+							for (size_t j = startIndex + 1; j < topologicallySortedSccs.size(); ++j) {
+								storm::storage::StateBlock const& scc = topologicallySortedSccs[j];
 								lastSize = tempGroups.size();
 								tempGroups.insert(tempGroups.cend(), scc.cbegin(), scc.cend());
 								std::vector<uint_fast64_t>::iterator middleIterator = tempGroups.begin();
@@ -404,8 +407,8 @@ namespace storm {
 							}
 						} else {
 							// Use std::sort
-							for (size_t j = startIndex + 1; j < topologicalSort.size(); ++j) {
-								storm::storage::StateBlock const& scc = sccDecomposition[topologicalSort[j]];
+							for (size_t j = startIndex + 1; j < topologicallySortedSccs.size(); ++j) {
+								storm::storage::StateBlock const& scc = topologicallySortedSccs[j];
 								tempGroups.insert(tempGroups.cend(), scc.cbegin(), scc.cend());
 							}
 							std::sort(tempGroups.begin(), tempGroups.end());
@@ -414,13 +417,12 @@ namespace storm {
 					}
 					else {
 						// Only one group, copy construct.
-						result.push_back(std::make_pair(true, storm::storage::StateBlock(std::move(sccDecomposition[topologicalSort[startIndex]]))));
+						result.push_back(std::make_pair(true, storm::storage::StateBlock(topologicallySortedSccs[startIndex])));
 					}
 					++lastResultIndex;
 				}
 #else
-				for (auto sccIndexIt = topologicalSort.cbegin(); sccIndexIt != topologicalSort.cend(); ++sccIndexIt) {
-					storm::storage::StateBlock const& scc = sccDecomposition[*sccIndexIt];
+				for (auto const& scc : topologicallySortedSccs) {
 					result.push_back(std::make_pair(false, scc));
 				}
 #endif
@@ -2,7 +2,7 @@
 #define STORM_SOLVER_TOPOLOGICALVALUEITERATIONMINMAXLINEAREQUATIONSOLVER_H_
 
 #include "storm/solver/MinMaxLinearEquationSolver.h"
-#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/StateBlock.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -47,9 +47,9 @@ namespace storm {
             
             bool enableCuda;
             /*!
-             * Given a topological sort of a SCC Decomposition, this will calculate the optimal grouping of SCCs with respect to the size of the GPU memory.
+             * Given the topologically sorted SCCs of a SCC Decomposition, this will calculate the optimal grouping of SCCs with respect to the size of the GPU memory.
              */
-            std::vector<std::pair<bool, storm::storage::StateBlock>> getOptimalGroupingFromTopologicalSccDecomposition(storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sccDecomposition, std::vector<uint_fast64_t> const& topologicalSort, storm::storage::SparseMatrix<ValueType> const& matrix) const;
+            std::vector<std::pair<bool, storm::storage::StateBlock>> getOptimalGroupingFromTopologicalSccDecomposition(std::vector<storm::storage::StateBlock> const& topologicallySortedSccs, storm::storage::SparseMatrix<ValueType> const& matrix) const;
         };
         
         template <typename IndexType, typename ValueType>
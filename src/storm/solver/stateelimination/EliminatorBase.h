@@ -4,6 +4,8 @@
 
 #include "storm/storage/FlexibleSparseMatrix.h"
 
+#include "storm/utility/OperationCache.h"
+
 namespace storm {
     namespace solver {
         namespace stateelimination {
@@ -32,6 +34,9 @@ namespace storm {
             protected:
                 storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
                 storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+                
+                // Performs the arithmetic operations of the elimination (and possibly reuses their results).
+                storm::utility::OperationCache<ValueType> operationCache;
             };
             
         } // namespace stateelimination
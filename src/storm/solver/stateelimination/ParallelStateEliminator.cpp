@@ -0,0 +1,146 @@
+#include "storm/solver/stateelimination/ParallelStateEliminator.h"
+
+#include <type_traits>
+
+#include "storm/adapters/CarlAdapter.h"
+
+#include "storm/storage/BitVector.h"
+
+#include "storm/utility/parallel.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+        namespace stateelimination {
+
+            namespace {
+                // The minimal number of states in a batch for which the batch is eliminated concurrently.
+                static const uint_fast64_t MINIMAL_PARALLEL_BATCH_SIZE = 4;
+
+                // The maximal number of states that may be deferred while collecting the states of a batch.
+                static const uint_fast64_t MAXIMAL_DEFERRED_STATES = 64;
+            }
+
+            template<typename ValueType>
+            ParallelStateEliminator<ValueType>::ParallelStateEliminator(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<storm::storage::sparse::state_type> const& statesToEliminate, std::vector<ValueType>& stateValues) : PrioritizedStateEliminator<ValueType>(transitionMatrix, backwardTransitions, statesToEliminate, stateValues), statesToEliminate(statesToEliminate), numberOfBatches(0) {
+                // Intentionally left empty.
+            }
+
+            template<typename ValueType>
+            void ParallelStateEliminator<ValueType>::eliminateAll(bool removeForwardTransitions) {
+                eliminateInBatches([removeForwardTransitions] (storm::storage::sparse::state_type const&) { return removeForwardTransitions; });
+            }
+
+            template<typename ValueType>
+            void ParallelStateEliminator<ValueType>::eliminateAll(storm::storage::BitVector const& statesKeepingForwardTransitions) {
+                eliminateInBatches([&statesKeepingForwardTransitions] (storm::storage::sparse::state_type const& state) { return !statesKeepingForwardTransitions.get(state); });
+            }
+
+            template<typename ValueType>
+            uint_fast64_t ParallelStateEliminator<ValueType>::getNumberOfBatches() const {
+                return numberOfBatches;
+            }
+
+            template<typename ValueType>
+            bool ParallelStateEliminator<ValueType>::supportsConcurrentElimination() {
+                // Exact numbers and rational functions may share their (reference-counted or cached) representations
+                // across entries of different rows, which makes concurrent arithmetic on them unsafe.
+                return std::is_same<ValueType, double>::value;
+            }
+
+            template<typename ValueType>
+            void ParallelStateEliminator<ValueType>::eliminateInBatches(std::function<bool (storm::storage::sparse::state_type const&)> const& removeForwardTransitions) {
+                auto performElimination = [&] (storm::storage::sparse::state_type const& state) {
+                    bool removeForwardTransitionsOfState = removeForwardTransitions(state);
+                    this->eliminateState(state, removeForwardTransitionsOfState);
+                    if (removeForwardTransitionsOfState) {
+                        this->clearStateValues(state);
+                    }
+                };
+
+                if (!supportsConcurrentElimination() || !storm::utility::parallel::isParallelismEnabled()) {
+                    for (auto const& state : statesToEliminate) {
+                        performElimination(state);
+                    }
+                    numberOfBatches = statesToEliminate.size();
+                    return;
+                }
+
+                // Every state that is considered for a batch marks its neighbourhood with the index of the batch. A
+                // state can only join the batch if no state of its neighbourhood is marked. States that cannot join the
+                // batch are deferred to the next one, but still mark their neighbourhood, such that the states joining
+                // the batch are also independent of the states they overtake.
+                std::vector<uint_fast64_t> batchMarks(this->matrix.getRowCount(), 0);
+                auto isNeighbourhoodMarked = [&] (storm::storage::sparse::state_type const& state) {
+                    if (batchMarks[state] == numberOfBatches) {
+                        return true;
+                    }
+                    for (auto const& entry : this->matrix.getRow(state)) {
+                        if (batchMarks[entry.getColumn()] == numberOfBatches) {
+                            return true;
+                        }
+                    }
+                    for (auto const& entry : this->transposedMatrix.getRow(state)) {
+                        if (batchMarks[entry.getColumn()] == numberOfBatches) {
+                            return true;
+                        }
+                    }
+                    return false;
+                };
+                auto markNeighbourhood = [&] (storm::storage::sparse::state_type const& state) {
+                    batchMarks[state] = numberOfBatches;
+                    for (auto const& entry : this->matrix.getRow(state)) {
+                        batchMarks[entry.getColumn()] = numberOfBatches;
+                    }
+                    for (auto const& entry : this->transposedMatrix.getRow(state)) {
+                        batchMarks[entry.getColumn()] = numberOfBatches;
+                    }
+                };
+
+                std::vector<storm::storage::sparse::state_type> batch;
+                std::vector<storm::storage::sparse::state_type> deferredStates;
+                std::vector<storm::storage::sparse::state_type> nextDeferredStates;
+                auto considerState = [&] (storm::storage::sparse::state_type const& state) {
+                    if (isNeighbourhoodMarked(state)) {
+                        nextDeferredStates.push_back(state);
+                    } else {
+                        batch.push_back(state);
+                    }
+                    markNeighbourhood(state);
+                };
+
+                numberOfBatches = 0;
+                uint_fast64_t position = 0;
+                while (position < statesToEliminate.size() || !deferredStates.empty()) {
+                    ++numberOfBatches;
+                    batch.clear();
+                    nextDeferredStates.clear();
+                    for (auto const& state : deferredStates) {
+                        considerState(state);
+                    }
+                    for (; position < statesToEliminate.size() && nextDeferredStates.size() < MAXIMAL_DEFERRED_STATES; ++position) {
+                        considerState(statesToEliminate[position]);
+                    }
+                    STORM_LOG_ASSERT(!batch.empty(), "Expected non-empty batch of states.");
+
+                    if (batch.size() >= MINIMAL_PARALLEL_BATCH_SIZE) {
+                        storm::utility::parallel::getThreadPool().execute(batch.size(), [&] (uint_fast64_t index) { performElimination(batch[index]); });
+                    } else {
+                        for (auto const& state : batch) {
+                            performElimination(state);
+                        }
+                    }
+                    std::swap(deferredStates, nextDeferredStates);
+                }
+                STORM_LOG_DEBUG("Eliminated " << statesToEliminate.size() << " states in " << numberOfBatches << " batches.");
+            }
+
+            template class ParallelStateEliminator<double>;
+
+#ifdef STORM_HAVE_CARL
+            template class ParallelStateEliminator<storm::RationalNumber>;
+            template class ParallelStateEliminator<storm::RationalFunction>;
+#endif
+        } // namespace stateelimination
+    } // namespace storage
+} // namespace storm
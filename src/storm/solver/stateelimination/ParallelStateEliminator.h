@@ -0,0 +1,67 @@
+#ifndef STORM_SOLVER_STATEELIMINATION_PARALLELSTATEELIMINATOR_H_
+#define STORM_SOLVER_STATEELIMINATION_PARALLELSTATEELIMINATOR_H_
+
+#include <functional>
+
+#include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
+
+namespace storm {
+    namespace storage {
+        class BitVector;
+    }
+
+    namespace solver {
+        namespace stateelimination {
+
+            /*!
+             * An eliminator that eliminates the states in a fixed order, but splits the order into batches of states
+             * whose neighbourhoods (the state itself, its predecessors and its successors) are pairwise disjoint. As
+             * the elimination of a state only touches the transitions of its neighbourhood, the states of a batch can
+             * be eliminated concurrently and the result is the same as for the sequential elimination in the given
+             * order. Batches are only processed concurrently if parallelism is enabled and the value type supports it.
+             */
+            template<typename ValueType>
+            class ParallelStateEliminator : public PrioritizedStateEliminator<ValueType> {
+            public:
+                ParallelStateEliminator(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<storm::storage::sparse::state_type> const& statesToEliminate, std::vector<ValueType>& stateValues);
+
+                virtual void eliminateAll(bool removeForwardTransitions = true) override;
+
+                /*!
+                 * Eliminates all states and removes the forward transitions of all of them except for the given ones.
+                 *
+                 * @param statesKeepingForwardTransitions The states whose forward transitions are kept.
+                 */
+                void eliminateAll(storm::storage::BitVector const& statesKeepingForwardTransitions);
+
+                /*!
+                 * Retrieves the number of batches in which the states were eliminated by the last call to eliminateAll.
+                 */
+                uint_fast64_t getNumberOfBatches() const;
+
+                /*!
+                 * Retrieves whether batches of states can be eliminated concurrently for the value type.
+                 */
+                static bool supportsConcurrentElimination();
+
+            private:
+                /*!
+                 * Eliminates all states in batches of independent states.
+                 *
+                 * @param removeForwardTransitions A function that determines whether to remove the forward transitions
+                 * of an eliminated state.
+                 */
+                void eliminateInBatches(std::function<bool (storm::storage::sparse::state_type const&)> const& removeForwardTransitions);
+
+                // The states to eliminate in the order of their elimination.
+                std::vector<storm::storage::sparse::state_type> statesToEliminate;
+
+                // The number of batches used by the last elimination.
+                uint_fast64_t numberOfBatches;
+            };
+
+        } // namespace stateelimination
+    } // namespace storage
+} // namespace storm
+
+#endif // STORM_SOLVER_STATEELIMINATION_PARALLELSTATEELIMINATOR_H_
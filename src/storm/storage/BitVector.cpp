@@ -115,6 +115,7 @@ namespace storm {
         BitVector& BitVector::operator=(BitVector const& other) {
             // Only perform the assignment if the source and target are not identical.
             if (this != &other) {
+                delete[] buckets;
                 bitCount = other.bitCount;
                 buckets = new uint64_t[other.bucketCount()];
                 std::copy_n(other.buckets, other.bucketCount(), buckets);
@@ -151,6 +152,7 @@ namespace storm {
         BitVector& BitVector::operator=(BitVector&& other) {
             // Only perform the assignment if the source and target are not identical.
             if (this != &other) {
+                delete[] buckets;
                 bitCount = other.bitCount;
                 this->buckets = other.buckets;
                 other.buckets = nullptr;
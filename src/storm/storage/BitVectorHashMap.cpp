@@ -198,6 +198,15 @@ namespace storm {
         bool BitVectorHashMap<ValueType, Hash1, Hash2>::contains(storm::storage::BitVector const& key) const {
             return findBucket(key).first;
         }
+        
+        template<class ValueType, class Hash1, class Hash2>
+        std::pair<bool, ValueType> BitVectorHashMap<ValueType, Hash1, Hash2>::find(storm::storage::BitVector const& key) const {
+            std::pair<bool, std::size_t> flagBucketPair = this->findBucket(key);
+            if (flagBucketPair.first) {
+                return std::make_pair(true, values[flagBucketPair.second]);
+            }
+            return std::make_pair(false, ValueType());
+        }
 
         template<class ValueType, class Hash1, class Hash2>
         typename BitVectorHashMap<ValueType, Hash1, Hash2>::const_iterator BitVectorHashMap<ValueType, Hash1, Hash2>::begin() const {
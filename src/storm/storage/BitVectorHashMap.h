@@ -121,6 +121,16 @@ namespace storm {
              * @return True if the key is already contained in the map
              */
             bool contains(storm::storage::BitVector const& key) const;
+            
+            /*!
+             * Searches for the given key in the map without modifying the map. Hence, it is safe to call this method
+             * concurrently as long as the map is not modified at the same time.
+             *
+             * @param key The key to search.
+             * @return A pair whose first component indicates whether the key is contained in the map and whose second
+             * component is the value associated with the key (if it is contained).
+             */
+            std::pair<bool, ValueType> find(storm::storage::BitVector const& key) const;
 
             /*!
              * Retrieves an iterator to the elements of the map.
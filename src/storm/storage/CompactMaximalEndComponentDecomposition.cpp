@@ -0,0 +1,362 @@
+#include "storm/storage/CompactMaximalEndComponentDecomposition.h"
+
+#include <algorithm>
+
+#include "storm/adapters/CarlAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace {
+            // The label of all states that are not (or no longer) part of a candidate.
+            uint_fast64_t const NO_CANDIDATE = std::numeric_limits<uint_fast64_t>::max();
+
+            // The marker for states that have not yet been visited by the SCC search.
+            uint_fast64_t const NO_PREORDER_NUMBER = std::numeric_limits<uint_fast64_t>::max();
+
+            // A set of states that may still contain MECs. All states of the candidate carry its label.
+            struct Candidate {
+                uint_fast64_t label;
+                std::vector<uint_fast64_t> states;
+            };
+
+            /*!
+             * Computes the MECs by repeatedly removing the states of a candidate that cannot stay within the candidate
+             * and splitting the remainder into its SCCs. A candidate that neither loses states nor splits is an MEC.
+             */
+            template <typename ValueType>
+            class EndComponentRefinement {
+            public:
+                EndComponentRefinement(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions) : transitionMatrix(transitionMatrix), backwardTransitions(backwardTransitions), labels(transitionMatrix.getRowGroupCount(), NO_CANDIDATE), enabledChoiceCounts(transitionMatrix.getRowGroupCount()), localIndices(transitionMatrix.getRowGroupCount()), enabledChoices(transitionMatrix.getRowCount()), nextLabel(1) {
+                    // Intentionally left empty.
+                }
+
+                /*!
+                 * Computes the (sorted) state sets of the MECs of the subsystem. Afterwards, the enabled choices are
+                 * exactly the choices of MEC states that stay within their MEC.
+                 */
+                std::vector<std::vector<uint_fast64_t>> decompose(storm::storage::BitVector const& subsystem) {
+                    std::vector<std::vector<uint_fast64_t>> result;
+                    std::vector<Candidate> candidates;
+                    if (!subsystem.empty()) {
+                        candidates.push_back(Candidate{0, std::vector<uint_fast64_t>(subsystem.begin(), subsystem.end())});
+                        for (auto state : subsystem) {
+                            labels[state] = 0;
+                        }
+                    }
+
+                    while (!candidates.empty()) {
+                        Candidate candidate = std::move(candidates.back());
+                        candidates.pop_back();
+
+                        bool removedStates = removeStatesWithoutEnabledChoice(candidate);
+                        if (candidate.states.empty()) {
+                            continue;
+                        }
+
+                        std::vector<std::vector<uint_fast64_t>> sccs = computeSccs(candidate);
+                        if (!removedStates && sccs.size() == 1) {
+                            result.push_back(std::move(candidate.states));
+                            continue;
+                        }
+
+                        // Only the new candidates need to be treated again, all other candidates are unaffected.
+                        for (auto& scc : sccs) {
+                            uint_fast64_t label = nextLabel++;
+                            for (auto state : scc) {
+                                labels[state] = label;
+                            }
+                            candidates.push_back(Candidate{label, std::move(scc)});
+                        }
+                    }
+
+                    return result;
+                }
+
+                storm::storage::BitVector const& getEnabledChoices() const {
+                    return enabledChoices;
+                }
+
+            private:
+                /*!
+                 * Determines the choices of the candidate states whose successors all belong to the candidate and
+                 * iteratively removes the states without such a choice from the candidate.
+                 *
+                 * @return True iff states were removed.
+                 */
+                bool removeStatesWithoutEnabledChoice(Candidate& candidate) {
+                    std::vector<uint_fast64_t> removedStates;
+                    for (auto state : candidate.states) {
+                        uint_fast64_t enabledChoiceCount = 0;
+                        for (uint_fast64_t choice = transitionMatrix.getRowGroupIndices()[state]; choice < transitionMatrix.getRowGroupIndices()[state + 1]; ++choice) {
+                            bool choiceEnabled = true;
+                            for (auto const& entry : transitionMatrix.getRow(choice)) {
+                                if (!storm::utility::isZero(entry.getValue()) && labels[entry.getColumn()] != candidate.label) {
+                                    choiceEnabled = false;
+                                    break;
+                                }
+                            }
+                            enabledChoices.set(choice, choiceEnabled);
+                            enabledChoiceCount += choiceEnabled ? 1 : 0;
+                        }
+
+                        enabledChoiceCounts[state] = enabledChoiceCount;
+                        if (enabledChoiceCount == 0) {
+                            labels[state] = NO_CANDIDATE;
+                            removedStates.push_back(state);
+                        }
+                    }
+
+                    // Removing a state disables the choices of its predecessors that may lead to it.
+                    for (uint_fast64_t index = 0; index < removedStates.size(); ++index) {
+                        uint_fast64_t removedState = removedStates[index];
+                        for (auto const& predecessorEntry : backwardTransitions.getRow(removedState)) {
+                            uint_fast64_t predecessor = predecessorEntry.getColumn();
+                            if (labels[predecessor] != candidate.label) {
+                                continue;
+                            }
+
+                            for (uint_fast64_t choice = transitionMatrix.getRowGroupIndices()[predecessor]; choice < transitionMatrix.getRowGroupIndices()[predecessor + 1]; ++choice) {
+                                if (!enabledChoices.get(choice)) {
+                                    continue;
+                                }
+                                for (auto const& entry : transitionMatrix.getRow(choice)) {
+                                    if (entry.getColumn() == removedState && !storm::utility::isZero(entry.getValue())) {
+                                        enabledChoices.set(choice, false);
+                                        --enabledChoiceCounts[predecessor];
+                                        break;
+                                    }
+                                }
+                            }
+                            if (enabledChoiceCounts[predecessor] == 0) {
+                                labels[predecessor] = NO_CANDIDATE;
+                                removedStates.push_back(predecessor);
+                            }
+                        }
+                    }
+
+                    if (removedStates.empty()) {
+                        return false;
+                    }
+                    candidate.states.erase(std::remove_if(candidate.states.begin(), candidate.states.end(), [&] (uint_fast64_t state) { return labels[state] != candidate.label; }), candidate.states.end());
+                    return true;
+                }
+
+                /*!
+                 * Computes the (sorted) SCCs of the candidate with respect to the enabled choices using the path-based
+                 * algorithm of Gabow, Cheriyan and Mehlhorn.
+                 */
+                std::vector<std::vector<uint_fast64_t>> computeSccs(Candidate const& candidate) {
+                    std::vector<uint_fast64_t> const& candidateStates = candidate.states;
+                    for (uint_fast64_t localIndex = 0; localIndex < candidateStates.size(); ++localIndex) {
+                        localIndices[candidateStates[localIndex]] = localIndex;
+                    }
+
+                    std::vector<uint_fast64_t> preorderNumbers(candidateStates.size(), NO_PREORDER_NUMBER);
+                    std::vector<bool> hasScc(candidateStates.size(), false);
+                    std::vector<uint_fast64_t> s;
+                    std::vector<uint_fast64_t> p;
+                    uint_fast64_t currentIndex = 0;
+                    std::vector<std::vector<uint_fast64_t>> result;
+
+                    // The search stack holds the states in the current path together with their unexplored transitions.
+                    struct SearchFrame {
+                        uint_fast64_t localIndex;
+                        uint_fast64_t choice;
+                        typename storm::storage::SparseMatrix<ValueType>::const_iterator successorIt;
+                        typename storm::storage::SparseMatrix<ValueType>::const_iterator successorIte;
+                    };
+                    std::vector<SearchFrame> searchStack;
+                    auto visit = [&] (uint_fast64_t localIndex) {
+                        preorderNumbers[localIndex] = currentIndex++;
+                        s.push_back(localIndex);
+                        p.push_back(localIndex);
+                        uint_fast64_t firstChoice = transitionMatrix.getRowGroupIndices()[candidateStates[localIndex]];
+                        auto successors = transitionMatrix.getRow(firstChoice);
+                        searchStack.push_back({localIndex, firstChoice, successors.begin(), successors.end()});
+                    };
+
+                    for (uint_fast64_t startIndex = 0; startIndex < candidateStates.size(); ++startIndex) {
+                        if (preorderNumbers[startIndex] != NO_PREORDER_NUMBER) {
+                            continue;
+                        }
+
+                        visit(startIndex);
+                        while (!searchStack.empty()) {
+                            SearchFrame& frame = searchStack.back();
+                            uint_fast64_t currentLocalIndex = frame.localIndex;
+                            uint_fast64_t endChoice = transitionMatrix.getRowGroupIndices()[candidateStates[currentLocalIndex] + 1];
+                            bool descended = false;
+                            while (frame.choice < endChoice) {
+                                // Only the transitions of enabled choices are considered, which all stay in the candidate.
+                                if (frame.successorIt == frame.successorIte || !enabledChoices.get(frame.choice)) {
+                                    ++frame.choice;
+                                    if (frame.choice < endChoice) {
+                                        auto successors = transitionMatrix.getRow(frame.choice);
+                                        frame.successorIt = successors.begin();
+                                        frame.successorIte = successors.end();
+                                    }
+                                    continue;
+                                }
+
+                                auto const& entry = *frame.successorIt;
+                                ++frame.successorIt;
+                                if (storm::utility::isZero(entry.getValue())) {
+                                    continue;
+                                }
+
+                                uint_fast64_t successorIndex = localIndices[entry.getColumn()];
+                                if (preorderNumbers[successorIndex] == NO_PREORDER_NUMBER) {
+                                    // Visiting the successor invalidates the reference to the frame.
+                                    visit(successorIndex);
+                                    descended = true;
+                                    break;
+                                } else if (!hasScc[successorIndex]) {
+                                    while (preorderNumbers[p.back()] > preorderNumbers[successorIndex]) {
+                                        p.pop_back();
+                                    }
+                                }
+                            }
+                            if (descended) {
+                                continue;
+                            }
+
+                            searchStack.pop_back();
+                            if (p.back() == currentLocalIndex) {
+                                p.pop_back();
+                                std::vector<uint_fast64_t> scc;
+                                uint_fast64_t poppedIndex = 0;
+                                do {
+                                    poppedIndex = s.back();
+                                    s.pop_back();
+                                    scc.push_back(candidateStates[poppedIndex]);
+                                    hasScc[poppedIndex] = true;
+                                } while (poppedIndex != currentLocalIndex);
+                                std::sort(scc.begin(), scc.end());
+                                result.push_back(std::move(scc));
+                            }
+                        }
+                    }
+
+                    return result;
+                }
+
+                storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+                storm::storage::SparseMatrix<ValueType> const& backwardTransitions;
+
+                // The label of the candidate every state currently belongs to.
+                std::vector<uint_fast64_t> labels;
+
+                // The number of enabled choices of every candidate state.
+                std::vector<uint_fast64_t> enabledChoiceCounts;
+
+                // The index of every state within its candidate (used by the SCC search).
+                std::vector<uint_fast64_t> localIndices;
+
+                // The choices of the candidate states whose successors all belong to the candidate.
+                storm::storage::BitVector enabledChoices;
+
+                uint_fast64_t nextLabel;
+            };
+        }
+
+        template <typename ValueType>
+        const uint_fast64_t CompactMaximalEndComponentDecomposition<ValueType>::NO_MEC;
+
+        template <typename ValueType>
+        CompactMaximalEndComponentDecomposition<ValueType>::CompactMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions) {
+            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true));
+        }
+
+        template <typename ValueType>
+        CompactMaximalEndComponentDecomposition<ValueType>::CompactMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& subsystem) {
+            performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, subsystem);
+        }
+
+        template <typename ValueType>
+        uint_fast64_t CompactMaximalEndComponentDecomposition<ValueType>::getNumberOfMecs() const {
+            return mecOffsets.size() - 1;
+        }
+
+        template <typename ValueType>
+        uint_fast64_t CompactMaximalEndComponentDecomposition<ValueType>::getMecIndex(uint_fast64_t state) const {
+            return stateToMec[state];
+        }
+
+        template <typename ValueType>
+        std::vector<uint_fast64_t> const& CompactMaximalEndComponentDecomposition<ValueType>::getStateToMecMapping() const {
+            return stateToMec;
+        }
+
+        template <typename ValueType>
+        std::vector<uint_fast64_t> const& CompactMaximalEndComponentDecomposition<ValueType>::getStatesOrderedByMecs() const {
+            return states;
+        }
+
+        template <typename ValueType>
+        std::vector<uint_fast64_t> const& CompactMaximalEndComponentDecomposition<ValueType>::getMecOffsets() const {
+            return mecOffsets;
+        }
+
+        template <typename ValueType>
+        uint_fast64_t CompactMaximalEndComponentDecomposition<ValueType>::getMecSize(uint_fast64_t mec) const {
+            return mecOffsets[mec + 1] - mecOffsets[mec];
+        }
+
+        template <typename ValueType>
+        typename CompactMaximalEndComponentDecomposition<ValueType>::const_iterator CompactMaximalEndComponentDecomposition<ValueType>::begin(uint_fast64_t mec) const {
+            return states.begin() + mecOffsets[mec];
+        }
+
+        template <typename ValueType>
+        typename CompactMaximalEndComponentDecomposition<ValueType>::const_iterator CompactMaximalEndComponentDecomposition<ValueType>::end(uint_fast64_t mec) const {
+            return states.begin() + mecOffsets[mec + 1];
+        }
+
+        template <typename ValueType>
+        std::vector<uint_fast64_t> const& CompactMaximalEndComponentDecomposition<ValueType>::getChoices() const {
+            return choices;
+        }
+
+        template <typename ValueType>
+        std::vector<uint_fast64_t> const& CompactMaximalEndComponentDecomposition<ValueType>::getChoiceOffsets() const {
+            return choiceOffsets;
+        }
+
+        template <typename ValueType>
+        void CompactMaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& subsystem) {
+            EndComponentRefinement<ValueType> refinement(transitionMatrix, backwardTransitions);
+            std::vector<std::vector<uint_fast64_t>> mecs = refinement.decompose(subsystem);
+            std::sort(mecs.begin(), mecs.end(), [] (std::vector<uint_fast64_t> const& first, std::vector<uint_fast64_t> const& second) { return first.front() < second.front(); });
+
+            storm::storage::BitVector const& enabledChoices = refinement.getEnabledChoices();
+            std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+            stateToMec.assign(transitionMatrix.getRowGroupCount(), NO_MEC);
+            mecOffsets.reserve(mecs.size() + 1);
+            mecOffsets.push_back(0);
+            choiceOffsets.push_back(0);
+            for (uint_fast64_t mec = 0; mec < mecs.size(); ++mec) {
+                for (auto state : mecs[mec]) {
+                    stateToMec[state] = mec;
+                    states.push_back(state);
+                    for (uint_fast64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                        if (enabledChoices.get(choice)) {
+                            choices.push_back(choice);
+                        }
+                    }
+                    choiceOffsets.push_back(choices.size());
+                }
+                mecOffsets.push_back(states.size());
+            }
+        }
+
+        template class CompactMaximalEndComponentDecomposition<double>;
+
+#ifdef STORM_HAVE_CARL
+        template class CompactMaximalEndComponentDecomposition<storm::RationalNumber>;
+#endif
+    }
+}
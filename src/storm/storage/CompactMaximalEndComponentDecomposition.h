@@ -0,0 +1,127 @@
+#ifndef STORM_STORAGE_COMPACTMAXIMALENDCOMPONENTDECOMPOSITION_H_
+#define STORM_STORAGE_COMPACTMAXIMALENDCOMPONENTDECOMPOSITION_H_
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class represents the decomposition of a nondeterministic model into its maximal end components. In
+         * contrast to the MaximalEndComponentDecomposition, the MECs are stored by means of a state-to-MEC mapping and
+         * flat vectors holding the states and the choices of all MECs.
+         *
+         * The decomposition refines candidate sets of states. Whenever a candidate changes, only the SCCs of this
+         * candidate are recomputed, so the work for a candidate is linear in the number of its transitions. The MECs
+         * are ordered by their smallest states and the states of every MEC are sorted.
+         */
+        template <typename ValueType>
+        class CompactMaximalEndComponentDecomposition {
+        public:
+            typedef std::vector<uint_fast64_t>::const_iterator const_iterator;
+
+            // The MEC index of states that do not belong to any MEC.
+            static const uint_fast64_t NO_MEC = std::numeric_limits<uint_fast64_t>::max();
+
+            /*!
+             * Creates an MEC decomposition of the model given by the row-grouped transition matrix. Transitions with
+             * value zero are ignored.
+             *
+             * @param transitionMatrix The transition relation of the model to decompose into MECs.
+             * @param backwardTransitions The reversed transition relation.
+             */
+            CompactMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions);
+
+            /*!
+             * Creates an MEC decomposition of the given subsystem of the model given by the row-grouped transition
+             * matrix. Transitions with value zero are ignored.
+             *
+             * @param transitionMatrix The transition relation of the model to decompose into MECs.
+             * @param backwardTransitions The reversed transition relation.
+             * @param subsystem The subsystem to decompose.
+             */
+            CompactMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& subsystem);
+
+            /*!
+             * Retrieves the number of MECs.
+             */
+            uint_fast64_t getNumberOfMecs() const;
+
+            /*!
+             * Retrieves the index of the MEC of the given state or NO_MEC if the state is not part of an MEC.
+             */
+            uint_fast64_t getMecIndex(uint_fast64_t state) const;
+
+            /*!
+             * Retrieves the MEC index of every state (see getMecIndex).
+             */
+            std::vector<uint_fast64_t> const& getStateToMecMapping() const;
+
+            /*!
+             * Retrieves the states of all MECs. The states of MEC i are stored in the range [offsets[i], offsets[i + 1]),
+             * where the offsets are given by getMecOffsets.
+             */
+            std::vector<uint_fast64_t> const& getStatesOrderedByMecs() const;
+
+            /*!
+             * Retrieves the positions at which the states of the MECs start (plus the number of MEC states at the end).
+             */
+            std::vector<uint_fast64_t> const& getMecOffsets() const;
+
+            /*!
+             * Retrieves the number of states of the given MEC.
+             */
+            uint_fast64_t getMecSize(uint_fast64_t mec) const;
+
+            /*!
+             * Retrieves an iterator to the (smallest) first state of the given MEC.
+             */
+            const_iterator begin(uint_fast64_t mec) const;
+
+            /*!
+             * Retrieves an iterator past the last state of the given MEC.
+             */
+            const_iterator end(uint_fast64_t mec) const;
+
+            /*!
+             * Retrieves the choices that stay within the MEC of their state, i.e. all choices of MEC states whose
+             * successors are all part of the MEC. The choices of the state at position i of getStatesOrderedByMecs are
+             * stored in the range [offsets[i], offsets[i + 1]), where the offsets are given by getChoiceOffsets.
+             */
+            std::vector<uint_fast64_t> const& getChoices() const;
+
+            /*!
+             * Retrieves the positions at which the choices of the MEC states start (plus the number of choices at the end).
+             */
+            std::vector<uint_fast64_t> const& getChoiceOffsets() const;
+
+        private:
+            /*!
+             * Performs the MEC decomposition of the given subsystem and stores the result in the members.
+             */
+            void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& subsystem);
+
+            // The MEC index of every state.
+            std::vector<uint_fast64_t> stateToMec;
+
+            // The states of all MECs, ordered by the MEC index and (within every MEC) ascending.
+            std::vector<uint_fast64_t> states;
+
+            // The position of the first state of every MEC in the states (plus the number of states at the end).
+            std::vector<uint_fast64_t> mecOffsets;
+
+            // The choices of all MEC states that stay within the MEC, ordered like the states.
+            std::vector<uint_fast64_t> choices;
+
+            // The position of the first choice of every MEC state in the choices (plus the number of choices at the end).
+            std::vector<uint_fast64_t> choiceOffsets;
+        };
+    }
+}
+
+#endif /* STORM_STORAGE_COMPACTMAXIMALENDCOMPONENTDECOMPOSITION_H_ */
@@ -0,0 +1,282 @@
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+
+#include "storm/adapters/CarlAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/simd.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace {
+            // The vectorized kernels are only available for double values and 32-bit indices. For all other types, these
+            // functions do nothing and report that the standard implementation has to be used.
+            template<typename ValueType, typename IndexType>
+            bool multiplyWithVectorSimd(uint_fast64_t, uint_fast64_t, IndexType const*, IndexType const*, ValueType const*, ValueType const*, ValueType const*, ValueType*) {
+                return false;
+            }
+
+            bool multiplyWithVectorSimd(uint_fast64_t startRow, uint_fast64_t endRow, uint32_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result) {
+                return storm::utility::simd::multiplyWithVector(startRow, endRow, rowIndications, columns, values, vector, summand, result);
+            }
+
+            template<typename ValueType, typename IndexType>
+            bool dotProductSimd(IndexType const*, ValueType const*, uint_fast64_t, ValueType const*, ValueType&) {
+                return false;
+            }
+
+            bool dotProductSimd(uint32_t const* columns, double const* values, uint_fast64_t count, double const* vector, double& result) {
+                return storm::utility::simd::dotProduct(columns, values, count, vector, result);
+            }
+
+            template<typename ValueType, typename IndexType>
+            bool multiplyAndReduceSimd(uint_fast64_t, uint_fast64_t, bool, IndexType const*, IndexType const*, IndexType const*, ValueType const*, ValueType const*, ValueType const*, ValueType*, uint_fast64_t*) {
+                return false;
+            }
+
+            bool multiplyAndReduceSimd(uint_fast64_t startGroup, uint_fast64_t endGroup, bool minimize, uint32_t const* rowGroupIndices, uint32_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result, uint_fast64_t* choices) {
+                return storm::utility::simd::multiplyAndReduce(startGroup, endGroup, minimize, rowGroupIndices, rowIndications, columns, values, vector, summand, result, choices);
+            }
+        }
+
+        template<typename ValueType, typename IndexType>
+        CompactSparseMatrix<ValueType, IndexType>::CompactSparseMatrix() : columnCount(0), rowIndications(1, 0), rowGroupIndices(1, 0) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType, typename IndexType>
+        template<typename SourceValueType>
+        CompactSparseMatrix<ValueType, IndexType>::CompactSparseMatrix(SparseMatrix<SourceValueType> const& matrix) : columnCount(matrix.getColumnCount()) {
+            STORM_LOG_THROW(isRepresentable(matrix), storm::exceptions::InvalidArgumentException, "The matrix with " << matrix.getRowCount() << " rows, " << matrix.getColumnCount() << " columns and " << matrix.getEntryCount() << " entries can not be represented with " << (8 * sizeof(IndexType)) << "-bit indices.");
+
+            rowIndications.reserve(matrix.getRowCount() + 1);
+            columns.reserve(matrix.getEntryCount());
+            values.reserve(matrix.getEntryCount());
+            rowIndications.push_back(0);
+            for (uint_fast64_t row = 0; row < matrix.getRowCount(); ++row) {
+                for (auto const& entry : matrix.getRow(row)) {
+                    columns.push_back(static_cast<index_type>(entry.getColumn()));
+                    values.push_back(static_cast<value_type>(entry.getValue()));
+                }
+                rowIndications.push_back(static_cast<index_type>(columns.size()));
+            }
+
+            if (matrix.hasTrivialRowGrouping()) {
+                rowGroupIndices.resize(matrix.getRowCount() + 1);
+                std::iota(rowGroupIndices.begin(), rowGroupIndices.end(), 0);
+            } else {
+                rowGroupIndices.reserve(matrix.getRowGroupCount() + 1);
+                for (auto const& index : matrix.getRowGroupIndices()) {
+                    rowGroupIndices.push_back(static_cast<index_type>(index));
+                }
+            }
+        }
+
+        template<typename ValueType, typename IndexType>
+        template<typename SourceValueType>
+        bool CompactSparseMatrix<ValueType, IndexType>::isRepresentable(SparseMatrix<SourceValueType> const& matrix) {
+            uint_fast64_t maximalIndex = std::numeric_limits<index_type>::max();
+            return matrix.getRowCount() <= maximalIndex && matrix.getColumnCount() <= maximalIndex && matrix.getEntryCount() <= maximalIndex;
+        }
+
+        template<typename ValueType, typename IndexType>
+        uint_fast64_t CompactSparseMatrix<ValueType, IndexType>::getRowCount() const {
+            return rowIndications.size() - 1;
+        }
+
+        template<typename ValueType, typename IndexType>
+        uint_fast64_t CompactSparseMatrix<ValueType, IndexType>::getColumnCount() const {
+            return columnCount;
+        }
+
+        template<typename ValueType, typename IndexType>
+        uint_fast64_t CompactSparseMatrix<ValueType, IndexType>::getEntryCount() const {
+            return columns.size();
+        }
+
+        template<typename ValueType, typename IndexType>
+        uint_fast64_t CompactSparseMatrix<ValueType, IndexType>::getRowGroupCount() const {
+            return rowGroupIndices.size() - 1;
+        }
+
+        template<typename ValueType, typename IndexType>
+        std::vector<IndexType> const& CompactSparseMatrix<ValueType, IndexType>::getRowGroupIndices() const {
+            return rowGroupIndices;
+        }
+
+        template<typename ValueType, typename IndexType>
+        void CompactSparseMatrix<ValueType, IndexType>::multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            if (&vector == &result) {
+                STORM_LOG_WARN("Matrix-vector-multiplication invoked but the target vector uses the same memory as the input vector. This requires to allocate auxiliary memory.");
+                std::vector<value_type> tmpVector(this->getRowCount());
+                multiplyWithVector(vector, tmpVector, summand);
+                result = std::move(tmpVector);
+                return;
+            }
+
+            if (std::is_arithmetic<ValueType>::value && storm::utility::parallel::isParallelismEnabled() && this->getEntryCount() > 10000) {
+                // As rows can be treated independently, we can split at arbitrary row group boundaries.
+                std::vector<uint_fast64_t> partition = getEntryBalancedRowGroupPartition(storm::utility::parallel::getNumberOfThreads());
+                storm::utility::parallel::parallelForChunks(partition, [&] (uint_fast64_t startGroup, uint_fast64_t endGroup) {
+                    this->multiplyWithVectorForRowRange(rowGroupIndices[startGroup], rowGroupIndices[endGroup], vector, result, summand);
+                });
+            } else {
+                multiplyWithVectorForRowRange(0, this->getRowCount(), vector, result, summand);
+            }
+        }
+
+        template<typename ValueType, typename IndexType>
+        void CompactSparseMatrix<ValueType, IndexType>::multiplyWithVectorForRowRange(uint_fast64_t startRow, uint_fast64_t endRow, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            if (isSimdApplicable() && multiplyWithVectorSimd(startRow, endRow, rowIndications.data(), columns.data(), values.data(), vector.data(), summand != nullptr ? summand->data() : nullptr, result.data())) {
+                return;
+            }
+            
+            index_type const* columnIt = columns.data() + rowIndications[startRow];
+            value_type const* valueIt = values.data() + rowIndications[startRow];
+            for (uint_fast64_t row = startRow; row < endRow; ++row) {
+                value_type newValue = summand != nullptr ? (*summand)[row] : storm::utility::zero<value_type>();
+                for (value_type const* valueIte = values.data() + rowIndications[row + 1]; valueIt != valueIte; ++valueIt, ++columnIt) {
+                    newValue += *valueIt * vector[*columnIt];
+                }
+                result[row] = newValue;
+            }
+        }
+
+        template<typename ValueType, typename IndexType>
+        ValueType CompactSparseMatrix<ValueType, IndexType>::multiplyRowWithVector(uint_fast64_t row, std::vector<value_type> const& vector) const {
+            uint_fast64_t first = rowIndications[row];
+            uint_fast64_t count = rowIndications[row + 1] - first;
+            value_type result = storm::utility::zero<value_type>();
+            if (isSimdApplicable() && dotProductSimd(columns.data() + first, values.data() + first, count, vector.data(), result)) {
+                return result;
+            }
+            
+            for (uint_fast64_t entry = first; entry < first + count; ++entry) {
+                result += values[entry] * vector[columns[entry]];
+            }
+            return result;
+        }
+
+        template<typename ValueType, typename IndexType>
+        void CompactSparseMatrix<ValueType, IndexType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const {
+            if (&vector == &result) {
+                STORM_LOG_WARN("Matrix-vector-multiplication invoked but the target vector uses the same memory as the input vector. This requires to allocate auxiliary memory.");
+                std::vector<value_type> tmpVector(this->getRowGroupCount());
+                multiplyAndReduce(dir, vector, summand, tmpVector, choices);
+                result = std::move(tmpVector);
+                return;
+            }
+
+            bool minimize = dir == storm::solver::OptimizationDirection::Minimize;
+            if (std::is_arithmetic<ValueType>::value && storm::utility::parallel::isParallelismEnabled() && this->getEntryCount() > 10000) {
+                std::vector<uint_fast64_t> partition = getEntryBalancedRowGroupPartition(storm::utility::parallel::getNumberOfThreads());
+                storm::utility::parallel::parallelForChunks(partition, [&] (uint_fast64_t startGroup, uint_fast64_t endGroup) {
+                    this->multiplyAndReduceForRowGroupRange(startGroup, endGroup, minimize, vector, summand, result, choices);
+                });
+            } else {
+                multiplyAndReduceForRowGroupRange(0, this->getRowGroupCount(), minimize, vector, summand, result, choices);
+            }
+        }
+
+        template<typename ValueType, typename IndexType>
+        void CompactSparseMatrix<ValueType, IndexType>::multiplyAndReduceForRowGroupRange(uint_fast64_t startGroup, uint_fast64_t endGroup, bool minimize, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const {
+            if (isSimdApplicable() && multiplyAndReduceSimd(startGroup, endGroup, minimize, rowGroupIndices.data(), rowIndications.data(), columns.data(), values.data(), vector.data(), summand != nullptr ? summand->data() : nullptr, result.data(), choices != nullptr ? choices->data() : nullptr)) {
+                return;
+            }
+            
+            index_type const* columnIt = columns.data() + rowIndications[rowGroupIndices[startGroup]];
+            value_type const* valueIt = values.data() + rowIndications[rowGroupIndices[startGroup]];
+            for (uint_fast64_t group = startGroup; group < endGroup; ++group) {
+                uint_fast64_t startRow = rowGroupIndices[group];
+                uint_fast64_t endRow = rowGroupIndices[group + 1];
+                value_type currentValue = storm::utility::zero<value_type>();
+                uint_fast64_t choice = 0;
+                for (uint_fast64_t row = startRow; row < endRow; ++row) {
+                    value_type newValue = summand != nullptr ? (*summand)[row] : storm::utility::zero<value_type>();
+                    for (value_type const* valueIte = values.data() + rowIndications[row + 1]; valueIt != valueIte; ++valueIt, ++columnIt) {
+                        newValue += *valueIt * vector[*columnIt];
+                    }
+
+                    // The first row of each group always determines the initial value.
+                    if (row == startRow || (minimize && newValue < currentValue) || (!minimize && newValue > currentValue)) {
+                        currentValue = newValue;
+                        choice = row - startRow;
+                    }
+                }
+                result[group] = currentValue;
+                if (choices != nullptr) {
+                    (*choices)[group] = choice;
+                }
+            }
+        }
+
+        template<typename ValueType, typename IndexType>
+        std::vector<uint_fast64_t> CompactSparseMatrix<ValueType, IndexType>::getEntryBalancedRowGroupPartition(uint_fast64_t numberOfParts) const {
+            STORM_LOG_ASSERT(numberOfParts > 0, "Cannot split matrix into zero parts.");
+            uint_fast64_t groupCount = this->getRowGroupCount();
+            std::vector<uint_fast64_t> result(numberOfParts + 1, groupCount);
+            result.front() = 0;
+
+            uint_fast64_t entries = this->getEntryCount();
+            for (uint_fast64_t part = 1; part < numberOfParts; ++part) {
+                // Find the row in which the desired first entry of the part lies and move the boundary to the beginning
+                // of the row group containing it.
+                uint_fast64_t targetEntry = (entries * part) / numberOfParts;
+                uint_fast64_t row = std::upper_bound(rowIndications.begin(), rowIndications.end() - 1, targetEntry) - rowIndications.begin() - 1;
+                uint_fast64_t group = std::upper_bound(rowGroupIndices.begin(), rowGroupIndices.end() - 1, row) - rowGroupIndices.begin() - 1;
+                result[part] = std::min(std::max(group, result[part - 1]), groupCount);
+            }
+
+            return result;
+        }
+
+        template<typename ValueType, typename IndexType>
+        bool CompactSparseMatrix<ValueType, IndexType>::isSimdApplicable() const {
+            // The gather instructions interpret the column indices as signed integers.
+            return storm::utility::simd::getInstructionSet() != storm::utility::simd::InstructionSet::None && columnCount <= static_cast<uint_fast64_t>(std::numeric_limits<int32_t>::max());
+        }
+
+        template<typename ValueType, typename IndexType>
+        SparseMatrix<ValueType> CompactSparseMatrix<ValueType, IndexType>::toSparseMatrix() const {
+            SparseMatrixBuilder<ValueType> builder(this->getRowCount(), this->getColumnCount(), this->getEntryCount(), true, true, this->getRowGroupCount());
+            for (uint_fast64_t group = 0; group < this->getRowGroupCount(); ++group) {
+                builder.newRowGroup(rowGroupIndices[group]);
+                for (uint_fast64_t row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+                    for (uint_fast64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                        builder.addNextValue(row, columns[entry], values[entry]);
+                    }
+                }
+            }
+            return builder.build();
+        }
+
+        template<typename ValueType, typename IndexType>
+        uint_fast64_t CompactSparseMatrix<ValueType, IndexType>::getSizeInMemory() const {
+            return sizeof(*this) + sizeof(index_type) * (rowIndications.capacity() + columns.capacity() + rowGroupIndices.capacity()) + sizeof(value_type) * values.capacity();
+        }
+
+        template class CompactSparseMatrix<double>;
+        template CompactSparseMatrix<double>::CompactSparseMatrix(SparseMatrix<double> const& matrix);
+        template bool CompactSparseMatrix<double>::isRepresentable(SparseMatrix<double> const& matrix);
+
+        template class CompactSparseMatrix<float>;
+        template CompactSparseMatrix<float>::CompactSparseMatrix(SparseMatrix<double> const& matrix);
+        template CompactSparseMatrix<float>::CompactSparseMatrix(SparseMatrix<float> const& matrix);
+        template bool CompactSparseMatrix<float>::isRepresentable(SparseMatrix<double> const& matrix);
+        template bool CompactSparseMatrix<float>::isRepresentable(SparseMatrix<float> const& matrix);
+
+#ifdef STORM_HAVE_CARL
+        template class CompactSparseMatrix<storm::RationalNumber>;
+        template CompactSparseMatrix<storm::RationalNumber>::CompactSparseMatrix(SparseMatrix<storm::RationalNumber> const& matrix);
+        template bool CompactSparseMatrix<storm::RationalNumber>::isRepresentable(SparseMatrix<storm::RationalNumber> const& matrix);
+#endif
+    }
+}
@@ -0,0 +1,157 @@
+#ifndef STORM_STORAGE_COMPACTSPARSEMATRIX_H_
+#define STORM_STORAGE_COMPACTSPARSEMATRIX_H_
+
+#include <vector>
+#include <cstdint>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/simd.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A read-only, compact copy of a sparse matrix that is meant to be used by iterative solvers. In contrast to
+         * the sparse matrix, all indices (including the row indications and row group indices) are stored using the
+         * given (typically 32-bit) index type and the columns and values of the entries are stored in separate arrays.
+         * This avoids the padding of the matrix entries and thereby reduces the memory that needs to be streamed for a
+         * matrix-vector multiplication. Note that the copy only reduces the overall memory consumption if the original
+         * matrix is released afterwards, as the native Jacobi solver does for its LU matrix and the standard min/max
+         * solver does for the matrices it owns. The columns and values
+         * are aligned to cache lines. If an instruction set is selected via storm::utility::simd,
+         * the multiplications of matrices with double values and 32-bit indices use vectorized kernels.
+         */
+        template<typename ValueType, typename IndexType = uint32_t>
+        class CompactSparseMatrix {
+        public:
+            typedef IndexType index_type;
+            typedef ValueType value_type;
+
+            /*!
+             * Constructs an empty matrix.
+             */
+            CompactSparseMatrix();
+
+            /*!
+             * Constructs a compact copy of the given matrix. If the value type of the given matrix differs from the one
+             * of the compact matrix, the values are converted.
+             *
+             * @param matrix The matrix to copy. It must be representable with the index type (see isRepresentable).
+             */
+            template<typename SourceValueType>
+            explicit CompactSparseMatrix(SparseMatrix<SourceValueType> const& matrix);
+
+            /*!
+             * Checks whether the dimensions and the number of entries of the given matrix can be represented with the
+             * index type of the compact matrix.
+             *
+             * @param matrix The matrix to check.
+             * @return True iff the matrix can be represented.
+             */
+            template<typename SourceValueType>
+            static bool isRepresentable(SparseMatrix<SourceValueType> const& matrix);
+
+            /*!
+             * Retrieves the number of rows of the matrix.
+             */
+            uint_fast64_t getRowCount() const;
+
+            /*!
+             * Retrieves the number of columns of the matrix.
+             */
+            uint_fast64_t getColumnCount() const;
+
+            /*!
+             * Retrieves the number of entries of the matrix.
+             */
+            uint_fast64_t getEntryCount() const;
+
+            /*!
+             * Retrieves the number of row groups of the matrix.
+             */
+            uint_fast64_t getRowGroupCount() const;
+
+            /*!
+             * Retrieves the row group indices of the matrix. For matrices with a trivial row grouping, every row forms
+             * its own group.
+             */
+            std::vector<index_type> const& getRowGroupIndices() const;
+
+            /*!
+             * Multiplies the matrix with the given vector and writes the result to the given result vector.
+             *
+             * @param vector The vector with which to multiply the matrix.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             */
+            void multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies a single row of the matrix with the given vector and returns the result.
+             *
+             * @param row The index of the row with which to multiply.
+             * @param vector The vector with which to multiply the row.
+             * @return The product of the row and the vector.
+             */
+            value_type multiplyRowWithVector(uint_fast64_t row, std::vector<value_type> const& vector) const;
+
+            /*!
+             * Multiplies the matrix with the given vector, adds the summand and reduces the result to the minimum or
+             * maximum of each row group (see SparseMatrix::multiplyAndReduce).
+             *
+             * @param dir The direction of the reduction.
+             * @param vector The vector with which to multiply the matrix.
+             * @param summand If given, this summand (with one entry per row) is added to the result of the multiplication.
+             * @param result The vector (with one entry per row group) that is supposed to hold the result.
+             * @param choices If given, the choices made in the reduction are written to this vector.
+             */
+            void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices = nullptr) const;
+
+            /*!
+             * Converts the matrix back to a sparse matrix. The result always has a (possibly trivial) custom row grouping.
+             *
+             * @return The sparse matrix with the same entries and row groups.
+             */
+            SparseMatrix<value_type> toSparseMatrix() const;
+
+            /*!
+             * Returns the size of the matrix in memory measured in bytes.
+             */
+            uint_fast64_t getSizeInMemory() const;
+
+        private:
+            /*!
+             * Splits the row groups into the given number of consecutive parts that have roughly the same number of
+             * entries.
+             */
+            std::vector<uint_fast64_t> getEntryBalancedRowGroupPartition(uint_fast64_t numberOfParts) const;
+
+            /*!
+             * Checks whether the vectorized kernels (see storm::utility::simd) may be used for this matrix.
+             */
+            bool isSimdApplicable() const;
+
+            void multiplyWithVectorForRowRange(uint_fast64_t startRow, uint_fast64_t endRow, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const;
+            void multiplyAndReduceForRowGroupRange(uint_fast64_t startGroup, uint_fast64_t endGroup, bool minimize, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            // The number of columns of the matrix.
+            uint_fast64_t columnCount;
+
+            // The index of the first entry of each row (plus the total number of entries at the end).
+            std::vector<index_type> rowIndications;
+
+            // The columns of all entries.
+            std::vector<index_type, storm::utility::simd::AlignedAllocator<index_type>> columns;
+
+            // The values of all entries.
+            std::vector<value_type, storm::utility::simd::AlignedAllocator<value_type>> values;
+
+            // The index of the first row of each row group (plus the number of rows at the end).
+            std::vector<index_type> rowGroupIndices;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_COMPACTSPARSEMATRIX_H_ */
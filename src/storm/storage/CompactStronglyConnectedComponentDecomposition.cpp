@@ -0,0 +1,490 @@
+#include "storm/storage/CompactStronglyConnectedComponentDecomposition.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <mutex>
+
+#include "storm/adapters/CarlAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace {
+            // Partitions with fewer states are decomposed by the sequential algorithm instead of being split further.
+            uint_fast64_t const MINIMAL_FORWARD_BACKWARD_SIZE = 1024;
+
+            // After this number of rounds of forward-backward splitting, the remaining partitions are decomposed
+            // sequentially. This bounds the overhead on graphs in which the pivots only split off small parts.
+            uint_fast64_t const MAXIMAL_FORWARD_BACKWARD_ROUNDS = 32;
+
+            // The minimal number of states in a frontier of a search for which the successors are explored in parallel.
+            uint_fast64_t const MINIMAL_PARALLEL_FRONTIER_SIZE = 1024;
+
+            // The label of all states that are not part of the subsystem.
+            uint_fast64_t const NO_PARTITION = std::numeric_limits<uint_fast64_t>::max();
+
+            // The marker for states that have not yet been visited by the sequential algorithm.
+            uint_fast64_t const NO_PREORDER_NUMBER = std::numeric_limits<uint_fast64_t>::max();
+
+            // A set of states that is known to be a union of SCCs. All states of the partition carry its label.
+            struct Partition {
+                uint_fast64_t label;
+                std::vector<uint_fast64_t> states;
+            };
+
+            /*!
+             * Computes a (not yet ordered) SCC decomposition by recursively splitting the subsystem into the SCC of a
+             * pivot state, the states only reachable from the pivot, the states only reaching the pivot and the rest.
+             * As every SCC is contained in one of these parts, the parts can be decomposed independently and thus in
+             * parallel. If no backward transitions are given, the subsystem is decomposed sequentially as a whole.
+             */
+            template <typename ValueType>
+            class ForwardBackwardSccSearch {
+            public:
+                ForwardBackwardSccSearch(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const* backwardTransitions, std::vector<uint_fast64_t>& stateToScc) : transitionMatrix(transitionMatrix), backwardTransitions(backwardTransitions), labels(transitionMatrix.getRowGroupCount()), localIndices(transitionMatrix.getRowGroupCount()), stateToScc(stateToScc), nextLabel(1), sccCount(0) {
+                    for (auto& label : labels) {
+                        label.store(NO_PARTITION, std::memory_order_relaxed);
+                    }
+                }
+
+                uint_fast64_t decompose(storm::storage::BitVector const& subsystem) {
+                    std::vector<Partition> partitions(1);
+                    partitions.front().label = 0;
+                    partitions.front().states.reserve(subsystem.getNumberOfSetBits());
+                    for (auto state : subsystem) {
+                        labels[state].store(0, std::memory_order_relaxed);
+                        partitions.front().states.push_back(state);
+                    }
+
+                    if (backwardTransitions == nullptr) {
+                        decomposeSequentially(partitions.front());
+                        return sccCount.load();
+                    }
+
+                    for (uint_fast64_t round = 0; !partitions.empty(); ++round) {
+                        std::vector<std::vector<Partition>> splitPartitions(partitions.size());
+                        auto processPartition = [&] (uint_fast64_t index) {
+                            if (partitions[index].states.size() < MINIMAL_FORWARD_BACKWARD_SIZE || round >= MAXIMAL_FORWARD_BACKWARD_ROUNDS) {
+                                this->decomposeSequentially(partitions[index]);
+                            } else {
+                                // Only a single partition means that the searches themselves need to be parallelized.
+                                splitPartitions[index] = this->split(partitions[index], partitions.size() == 1);
+                            }
+                        };
+                        if (partitions.size() == 1) {
+                            processPartition(0);
+                        } else {
+                            storm::utility::parallel::getThreadPool().execute(partitions.size(), processPartition);
+                        }
+
+                        partitions.clear();
+                        for (auto& newPartitions : splitPartitions) {
+                            std::move(newPartitions.begin(), newPartitions.end(), std::back_inserter(partitions));
+                        }
+                    }
+
+                    return sccCount.load();
+                }
+
+            private:
+                /*!
+                 * Splits the partition into the SCC of a pivot state and the remaining (nonempty) partitions.
+                 */
+                std::vector<Partition> split(Partition const& partition, bool parallel) {
+                    // Choosing a state with many predecessors and successors makes it likely to hit a large SCC.
+                    uint_fast64_t pivot = partition.states.front();
+                    uint_fast64_t maximalDegree = 0;
+                    for (auto state : partition.states) {
+                        uint_fast64_t degree = (transitionMatrix.getRowGroup(state).getNumberOfEntries() + 1) * (backwardTransitions->getRow(state).getNumberOfEntries() + 1);
+                        if (degree > maximalDegree) {
+                            maximalDegree = degree;
+                            pivot = state;
+                        }
+                    }
+
+                    uint_fast64_t forwardLabel = nextLabel.fetch_add(3);
+                    uint_fast64_t sccLabel = forwardLabel + 1;
+                    uint_fast64_t backwardLabel = forwardLabel + 2;
+                    relabelReachableStates(transitionMatrix, pivot, partition.label, forwardLabel, partition.label, forwardLabel, parallel);
+                    relabelReachableStates(*backwardTransitions, pivot, forwardLabel, sccLabel, partition.label, backwardLabel, parallel);
+
+                    uint_fast64_t pivotScc = sccCount.fetch_add(1);
+                    std::vector<Partition> result(3);
+                    result[0].label = forwardLabel;
+                    result[1].label = backwardLabel;
+                    result[2].label = partition.label;
+                    for (auto state : partition.states) {
+                        uint_fast64_t label = labels[state].load(std::memory_order_relaxed);
+                        if (label == sccLabel) {
+                            stateToScc[state] = pivotScc;
+                        } else if (label == forwardLabel) {
+                            result[0].states.push_back(state);
+                        } else if (label == backwardLabel) {
+                            result[1].states.push_back(state);
+                        } else {
+                            result[2].states.push_back(state);
+                        }
+                    }
+                    result.erase(std::remove_if(result.begin(), result.end(), [] (Partition const& part) { return part.states.empty(); }), result.end());
+                    return result;
+                }
+
+                /*!
+                 * Relabels all states reachable from the initial state (including itself) in the given matrix. States
+                 * carrying the source label receive the target label and states carrying the alternative source label
+                 * receive the alternative target label. All other states are neither relabeled nor explored.
+                 */
+                void relabelReachableStates(storm::storage::SparseMatrix<ValueType> const& matrix, uint_fast64_t initialState, uint_fast64_t sourceLabel, uint_fast64_t targetLabel, uint_fast64_t alternativeSourceLabel, uint_fast64_t alternativeTargetLabel, bool parallel) {
+                    // As the states may be claimed concurrently, only the thread that changes the label explores a state.
+                    auto claim = [&] (uint_fast64_t state) {
+                        uint_fast64_t label = labels[state].load(std::memory_order_relaxed);
+                        if (label == sourceLabel) {
+                            return labels[state].compare_exchange_strong(label, targetLabel, std::memory_order_relaxed);
+                        } else if (label == alternativeSourceLabel) {
+                            return labels[state].compare_exchange_strong(label, alternativeTargetLabel, std::memory_order_relaxed);
+                        }
+                        return false;
+                    };
+
+                    std::vector<uint_fast64_t> frontier;
+                    std::vector<uint_fast64_t> nextFrontier;
+                    std::mutex nextFrontierMutex;
+                    if (claim(initialState)) {
+                        frontier.push_back(initialState);
+                    }
+                    while (!frontier.empty()) {
+                        auto exploreFrontier = [&] (uint_fast64_t begin, uint_fast64_t end) {
+                            std::vector<uint_fast64_t> newStates;
+                            for (uint_fast64_t position = begin; position < end; ++position) {
+                                for (auto const& entry : matrix.getRowGroup(frontier[position])) {
+                                    if (!storm::utility::isZero(entry.getValue()) && claim(entry.getColumn())) {
+                                        newStates.push_back(entry.getColumn());
+                                    }
+                                }
+                            }
+                            std::lock_guard<std::mutex> lock(nextFrontierMutex);
+                            nextFrontier.insert(nextFrontier.end(), newStates.begin(), newStates.end());
+                        };
+
+                        if (parallel && frontier.size() >= MINIMAL_PARALLEL_FRONTIER_SIZE) {
+                            storm::utility::parallel::parallelFor(0, frontier.size(), exploreFrontier, MINIMAL_PARALLEL_FRONTIER_SIZE / 4);
+                        } else {
+                            exploreFrontier(0, frontier.size());
+                        }
+                        frontier.swap(nextFrontier);
+                        nextFrontier.clear();
+                    }
+                }
+
+                /*!
+                 * Decomposes the partition with the path-based algorithm of Gabow, Cheriyan and Mehlhorn.
+                 */
+                void decomposeSequentially(Partition const& partition) {
+                    std::vector<uint_fast64_t> const& partitionStates = partition.states;
+                    for (uint_fast64_t localIndex = 0; localIndex < partitionStates.size(); ++localIndex) {
+                        localIndices[partitionStates[localIndex]] = localIndex;
+                    }
+
+                    std::vector<uint_fast64_t> preorderNumbers(partitionStates.size(), NO_PREORDER_NUMBER);
+                    std::vector<bool> hasScc(partitionStates.size(), false);
+                    std::vector<uint_fast64_t> s;
+                    std::vector<uint_fast64_t> p;
+                    uint_fast64_t currentIndex = 0;
+                    uint_fast64_t localSccCount = 0;
+
+                    // The search stack holds the states in the current path together with their unexplored transitions.
+                    struct SearchFrame {
+                        uint_fast64_t localIndex;
+                        typename storm::storage::SparseMatrix<ValueType>::const_iterator successorIt;
+                        typename storm::storage::SparseMatrix<ValueType>::const_iterator successorIte;
+                    };
+                    std::vector<SearchFrame> searchStack;
+                    auto visit = [&] (uint_fast64_t localIndex) {
+                        preorderNumbers[localIndex] = currentIndex++;
+                        s.push_back(localIndex);
+                        p.push_back(localIndex);
+                        auto successors = transitionMatrix.getRowGroup(partitionStates[localIndex]);
+                        searchStack.push_back({localIndex, successors.begin(), successors.end()});
+                    };
+
+                    for (uint_fast64_t startIndex = 0; startIndex < partitionStates.size(); ++startIndex) {
+                        if (preorderNumbers[startIndex] != NO_PREORDER_NUMBER) {
+                            continue;
+                        }
+
+                        visit(startIndex);
+                        while (!searchStack.empty()) {
+                            SearchFrame& frame = searchStack.back();
+                            uint_fast64_t currentLocalIndex = frame.localIndex;
+                            bool descended = false;
+                            while (frame.successorIt != frame.successorIte) {
+                                auto const& entry = *frame.successorIt;
+                                ++frame.successorIt;
+                                if (storm::utility::isZero(entry.getValue()) || labels[entry.getColumn()].load(std::memory_order_relaxed) != partition.label) {
+                                    continue;
+                                }
+
+                                uint_fast64_t successorIndex = localIndices[entry.getColumn()];
+                                if (preorderNumbers[successorIndex] == NO_PREORDER_NUMBER) {
+                                    // Visiting the successor invalidates the reference to the frame.
+                                    visit(successorIndex);
+                                    descended = true;
+                                    break;
+                                } else if (!hasScc[successorIndex]) {
+                                    while (preorderNumbers[p.back()] > preorderNumbers[successorIndex]) {
+                                        p.pop_back();
+                                    }
+                                }
+                            }
+                            if (descended) {
+                                continue;
+                            }
+
+                            // All successors have been searched, so the state is the root of an SCC if it is on top of p.
+                            searchStack.pop_back();
+                            if (p.back() == currentLocalIndex) {
+                                p.pop_back();
+                                uint_fast64_t poppedIndex = 0;
+                                do {
+                                    poppedIndex = s.back();
+                                    s.pop_back();
+                                    stateToScc[partitionStates[poppedIndex]] = localSccCount;
+                                    hasScc[poppedIndex] = true;
+                                } while (poppedIndex != currentLocalIndex);
+                                ++localSccCount;
+                            }
+                        }
+                    }
+
+                    uint_fast64_t firstScc = sccCount.fetch_add(localSccCount);
+                    for (auto state : partitionStates) {
+                        stateToScc[state] += firstScc;
+                    }
+                }
+
+                storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+                storm::storage::SparseMatrix<ValueType> const* backwardTransitions;
+
+                // The label of the partition every state currently belongs to.
+                std::vector<std::atomic<uint_fast64_t>> labels;
+
+                // The index of every state within its partition (used by the sequential algorithm).
+                std::vector<uint_fast64_t> localIndices;
+
+                std::vector<uint_fast64_t>& stateToScc;
+                std::atomic<uint_fast64_t> nextLabel;
+                std::atomic<uint_fast64_t> sccCount;
+            };
+        }
+
+        template <typename ValueType>
+        const uint_fast64_t CompactStronglyConnectedComponentDecomposition<ValueType>::NO_SCC;
+
+        template <typename ValueType>
+        CompactStronglyConnectedComponentDecomposition<ValueType>::CompactStronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+            performSccDecomposition(transitionMatrix, storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true));
+        }
+
+        template <typename ValueType>
+        CompactStronglyConnectedComponentDecomposition<ValueType>::CompactStronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem) {
+            performSccDecomposition(transitionMatrix, subsystem);
+        }
+
+        template <typename ValueType>
+        uint_fast64_t CompactStronglyConnectedComponentDecomposition<ValueType>::getNumberOfSccs() const {
+            return sccOffsets.size() - 1;
+        }
+
+        template <typename ValueType>
+        uint_fast64_t CompactStronglyConnectedComponentDecomposition<ValueType>::getSccIndex(uint_fast64_t state) const {
+            return stateToScc[state];
+        }
+
+        template <typename ValueType>
+        std::vector<uint_fast64_t> const& CompactStronglyConnectedComponentDecomposition<ValueType>::getStateToSccMapping() const {
+            return stateToScc;
+        }
+
+        template <typename ValueType>
+        std::vector<uint_fast64_t> const& CompactStronglyConnectedComponentDecomposition<ValueType>::getStatesOrderedBySccs() const {
+            return states;
+        }
+
+        template <typename ValueType>
+        std::vector<uint_fast64_t> const& CompactStronglyConnectedComponentDecomposition<ValueType>::getSccOffsets() const {
+            return sccOffsets;
+        }
+
+        template <typename ValueType>
+        uint_fast64_t CompactStronglyConnectedComponentDecomposition<ValueType>::getSccSize(uint_fast64_t scc) const {
+            return sccOffsets[scc + 1] - sccOffsets[scc];
+        }
+
+        template <typename ValueType>
+        typename CompactStronglyConnectedComponentDecomposition<ValueType>::const_iterator CompactStronglyConnectedComponentDecomposition<ValueType>::begin(uint_fast64_t scc) const {
+            return states.begin() + sccOffsets[scc];
+        }
+
+        template <typename ValueType>
+        typename CompactStronglyConnectedComponentDecomposition<ValueType>::const_iterator CompactStronglyConnectedComponentDecomposition<ValueType>::end(uint_fast64_t scc) const {
+            return states.begin() + sccOffsets[scc + 1];
+        }
+
+        template <typename ValueType>
+        bool CompactStronglyConnectedComponentDecomposition<ValueType>::isTrivial(uint_fast64_t scc) const {
+            return trivialSccs.get(scc);
+        }
+
+        template <typename ValueType>
+        bool CompactStronglyConnectedComponentDecomposition<ValueType>::isBottom(uint_fast64_t scc) const {
+            return bottomSccs.get(scc);
+        }
+
+        template <typename ValueType>
+        void CompactStronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem) {
+            std::vector<uint_fast64_t> stateToUnorderedScc(transitionMatrix.getRowGroupCount());
+            uint_fast64_t numberOfSccs = 0;
+            if (storm::utility::parallel::isParallelismEnabled() && subsystem.getNumberOfSetBits() >= MINIMAL_FORWARD_BACKWARD_SIZE) {
+                storm::storage::SparseMatrix<ValueType> backwardTransitions = transitionMatrix.transpose(true);
+                ForwardBackwardSccSearch<ValueType> search(transitionMatrix, &backwardTransitions, stateToUnorderedScc);
+                numberOfSccs = search.decompose(subsystem);
+            } else {
+                ForwardBackwardSccSearch<ValueType> search(transitionMatrix, nullptr, stateToUnorderedScc);
+                numberOfSccs = search.decompose(subsystem);
+            }
+
+            buildCanonicalDecomposition(transitionMatrix, subsystem, stateToUnorderedScc, numberOfSccs);
+        }
+
+        template <typename ValueType>
+        void CompactStronglyConnectedComponentDecomposition<ValueType>::buildCanonicalDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, std::vector<uint_fast64_t> const& stateToUnorderedScc, uint_fast64_t numberOfSccs) {
+            // Group the states by their (unordered) SCC using a counting sort, which keeps the states of every SCC sorted.
+            std::vector<uint_fast64_t> unorderedOffsets(numberOfSccs + 1, 0);
+            for (auto state : subsystem) {
+                ++unorderedOffsets[stateToUnorderedScc[state] + 1];
+            }
+            for (uint_fast64_t scc = 1; scc <= numberOfSccs; ++scc) {
+                unorderedOffsets[scc] += unorderedOffsets[scc - 1];
+            }
+            std::vector<uint_fast64_t> unorderedStates(unorderedOffsets.back());
+            {
+                std::vector<uint_fast64_t> nextPosition(unorderedOffsets.begin(), unorderedOffsets.end() - 1);
+                for (auto state : subsystem) {
+                    unorderedStates[nextPosition[stateToUnorderedScc[state]]++] = state;
+                }
+            }
+
+            // The SCCs are numbered in the order in which a depth-first search on the DAG of SCCs finishes them, which
+            // yields a reverse topological order. The search starts from the SCCs in the order of their smallest states
+            // and explores the transitions in the order of the matrix, so the numbering only depends on the graph.
+            std::vector<uint_fast64_t> order;
+            order.reserve(numberOfSccs);
+            storm::storage::BitVector discovered(numberOfSccs);
+            storm::storage::BitVector unorderedBottomSccs(numberOfSccs, true);
+            storm::storage::BitVector statesWithSelfLoop(transitionMatrix.getRowGroupCount());
+
+            struct SearchFrame {
+                uint_fast64_t scc;
+                uint_fast64_t position;
+                typename storm::storage::SparseMatrix<ValueType>::const_iterator successorIt;
+                typename storm::storage::SparseMatrix<ValueType>::const_iterator successorIte;
+            };
+            std::vector<SearchFrame> searchStack;
+            auto discover = [&] (uint_fast64_t scc) {
+                discovered.set(scc);
+                auto successors = transitionMatrix.getRowGroup(unorderedStates[unorderedOffsets[scc]]);
+                searchStack.push_back({scc, unorderedOffsets[scc], successors.begin(), successors.end()});
+            };
+
+            for (auto startState : subsystem) {
+                if (discovered.get(stateToUnorderedScc[startState])) {
+                    continue;
+                }
+
+                discover(stateToUnorderedScc[startState]);
+                while (!searchStack.empty()) {
+                    SearchFrame& frame = searchStack.back();
+                    uint_fast64_t currentScc = frame.scc;
+                    bool descended = false;
+                    while (true) {
+                        if (frame.successorIt == frame.successorIte) {
+                            // Continue with the transitions of the next state of the SCC (if any).
+                            ++frame.position;
+                            if (frame.position == unorderedOffsets[currentScc + 1]) {
+                                break;
+                            }
+                            auto successors = transitionMatrix.getRowGroup(unorderedStates[frame.position]);
+                            frame.successorIt = successors.begin();
+                            frame.successorIte = successors.end();
+                            continue;
+                        }
+
+                        auto const& entry = *frame.successorIt;
+                        ++frame.successorIt;
+                        if (!subsystem.get(entry.getColumn()) || storm::utility::isZero(entry.getValue())) {
+                            continue;
+                        }
+
+                        uint_fast64_t successorScc = stateToUnorderedScc[entry.getColumn()];
+                        if (successorScc == currentScc) {
+                            if (entry.getColumn() == unorderedStates[frame.position]) {
+                                statesWithSelfLoop.set(entry.getColumn());
+                            }
+                            continue;
+                        }
+
+                        unorderedBottomSccs.set(currentScc, false);
+                        if (!discovered.get(successorScc)) {
+                            // Discovering the successor invalidates the reference to the frame.
+                            discover(successorScc);
+                            descended = true;
+                            break;
+                        }
+                    }
+                    if (!descended) {
+                        searchStack.pop_back();
+                        order.push_back(currentScc);
+                    }
+                }
+            }
+
+            // Finally, build the members according to the computed order.
+            stateToScc.assign(transitionMatrix.getRowGroupCount(), NO_SCC);
+            states.clear();
+            states.reserve(unorderedStates.size());
+            sccOffsets.clear();
+            sccOffsets.reserve(numberOfSccs + 1);
+            sccOffsets.push_back(0);
+            trivialSccs = storm::storage::BitVector(numberOfSccs);
+            bottomSccs = storm::storage::BitVector(numberOfSccs);
+            for (uint_fast64_t scc = 0; scc < numberOfSccs; ++scc) {
+                uint_fast64_t unorderedScc = order[scc];
+                for (uint_fast64_t position = unorderedOffsets[unorderedScc]; position < unorderedOffsets[unorderedScc + 1]; ++position) {
+                    stateToScc[unorderedStates[position]] = scc;
+                    states.push_back(unorderedStates[position]);
+                }
+                sccOffsets.push_back(states.size());
+
+                if (getSccSize(scc) == 1 && !statesWithSelfLoop.get(states.back())) {
+                    trivialSccs.set(scc);
+                }
+                if (unorderedBottomSccs.get(unorderedScc)) {
+                    bottomSccs.set(scc);
+                }
+            }
+        }
+
+        template class CompactStronglyConnectedComponentDecomposition<double>;
+        template class CompactStronglyConnectedComponentDecomposition<float>;
+
+#ifdef STORM_HAVE_CARL
+        template class CompactStronglyConnectedComponentDecomposition<storm::RationalNumber>;
+        template class CompactStronglyConnectedComponentDecomposition<storm::RationalFunction>;
+#endif
+    }
+}
@@ -0,0 +1,129 @@
+#ifndef STORM_STORAGE_COMPACTSTRONGLYCONNECTEDCOMPONENTDECOMPOSITION_H_
+#define STORM_STORAGE_COMPACTSTRONGLYCONNECTEDCOMPONENTDECOMPOSITION_H_
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class represents the decomposition of a graph-like structure into its strongly connected components.
+         * In contrast to the StronglyConnectedComponentDecomposition, the SCCs are not stored as individual blocks, but
+         * by means of a state-to-SCC mapping and the states of all SCCs stored consecutively in one vector.
+         *
+         * The SCCs are numbered in reverse topological order, i.e. every SCC that is reachable from an SCC has a smaller
+         * index, and the states of every SCC are sorted. The numbering only depends on the structure of the graph, so it
+         * is the same for every number of threads (see storm::utility::parallel). If parallelism is enabled, large
+         * parts of the graph are split by forward-backward searches from pivot states before the remaining parts are
+         * decomposed by the sequential path-based algorithm in parallel.
+         */
+        template <typename ValueType>
+        class CompactStronglyConnectedComponentDecomposition {
+        public:
+            typedef std::vector<uint_fast64_t>::const_iterator const_iterator;
+
+            // The SCC index of states that do not belong to the decomposed subsystem.
+            static const uint_fast64_t NO_SCC = std::numeric_limits<uint_fast64_t>::max();
+
+            /*!
+             * Creates an SCC decomposition of the system given by the transition matrix. Transitions with value zero
+             * are ignored.
+             *
+             * @param transitionMatrix The transition matrix of the system to decompose.
+             */
+            CompactStronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+            /*!
+             * Creates an SCC decomposition of the given subsystem in the system given by the transition matrix.
+             * Transitions with value zero are ignored.
+             *
+             * @param transitionMatrix The transition matrix of the system to decompose.
+             * @param subsystem A bit vector indicating which subsystem to consider for the decomposition into SCCs.
+             */
+            CompactStronglyConnectedComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem);
+
+            /*!
+             * Retrieves the number of SCCs.
+             */
+            uint_fast64_t getNumberOfSccs() const;
+
+            /*!
+             * Retrieves the index of the SCC of the given state or NO_SCC if the state is not part of the subsystem.
+             */
+            uint_fast64_t getSccIndex(uint_fast64_t state) const;
+
+            /*!
+             * Retrieves the SCC index of every state (see getSccIndex).
+             */
+            std::vector<uint_fast64_t> const& getStateToSccMapping() const;
+
+            /*!
+             * Retrieves the states of all SCCs. The states of SCC i are stored in the range [offsets[i], offsets[i + 1]),
+             * where the offsets are given by getSccOffsets.
+             */
+            std::vector<uint_fast64_t> const& getStatesOrderedBySccs() const;
+
+            /*!
+             * Retrieves the positions at which the states of the SCCs start (plus the number of states at the end).
+             */
+            std::vector<uint_fast64_t> const& getSccOffsets() const;
+
+            /*!
+             * Retrieves the number of states of the given SCC.
+             */
+            uint_fast64_t getSccSize(uint_fast64_t scc) const;
+
+            /*!
+             * Retrieves an iterator to the (smallest) first state of the given SCC.
+             */
+            const_iterator begin(uint_fast64_t scc) const;
+
+            /*!
+             * Retrieves an iterator past the last state of the given SCC.
+             */
+            const_iterator end(uint_fast64_t scc) const;
+
+            /*!
+             * Retrieves whether the given SCC is trivial, i.e. consists of a single state without a self-loop.
+             */
+            bool isTrivial(uint_fast64_t scc) const;
+
+            /*!
+             * Retrieves whether the given SCC is a bottom SCC, i.e. no other state of the subsystem can be reached from it.
+             */
+            bool isBottom(uint_fast64_t scc) const;
+
+        private:
+            /*!
+             * Performs the SCC decomposition of the given subsystem and stores the result in the members.
+             */
+            void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem);
+
+            /*!
+             * Numbers the SCCs of the given (arbitrary) state-to-SCC mapping in reverse topological order and builds the
+             * members from it.
+             */
+            void buildCanonicalDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem, std::vector<uint_fast64_t> const& stateToUnorderedScc, uint_fast64_t numberOfSccs);
+
+            // The SCC index of every state.
+            std::vector<uint_fast64_t> stateToScc;
+
+            // The states of all SCCs, ordered by the SCC index and (within every SCC) ascending.
+            std::vector<uint_fast64_t> states;
+
+            // The position of the first state of every SCC in the states (plus the number of states at the end).
+            std::vector<uint_fast64_t> sccOffsets;
+
+            // The SCCs that are trivial and the bottom SCCs, respectively.
+            storm::storage::BitVector trivialSccs;
+            storm::storage::BitVector bottomSccs;
+        };
+    }
+}
+
+#endif /* STORM_STORAGE_COMPACTSTRONGLYCONNECTEDCOMPONENTDECOMPOSITION_H_ */
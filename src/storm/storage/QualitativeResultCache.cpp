@@ -0,0 +1,136 @@
+#include "storm/storage/QualitativeResultCache.h"
+
+#include <boost/functional/hash.hpp>
+
+namespace storm {
+    namespace storage {
+
+        const uint_fast64_t QualitativeResultCache::DEFAULT_MEMORY_BUDGET;
+
+        QualitativeResultCache::QualitativeResultCache(uint_fast64_t memoryBudget) : memoryBudget(memoryBudget), sizeInBytes(0) {
+            // Intentionally left empty.
+        }
+
+        QualitativeResultCache::QualitativeResultCache(QualitativeResultCache const& other) {
+            std::lock_guard<std::mutex> lock(other.mutex);
+            memoryBudget = other.memoryBudget;
+            sizeInBytes = other.sizeInBytes;
+            entries = other.entries;
+        }
+
+        QualitativeResultCache& QualitativeResultCache::operator=(QualitativeResultCache const& other) {
+            if (this != &other) {
+                std::lock(mutex, other.mutex);
+                std::lock_guard<std::mutex> lock(mutex, std::adopt_lock);
+                std::lock_guard<std::mutex> otherLock(other.mutex, std::adopt_lock);
+                memoryBudget = other.memoryBudget;
+                sizeInBytes = other.sizeInBytes;
+                entries = other.entries;
+            }
+            return *this;
+        }
+
+        QualitativeResultCache::QualitativeResultCache(QualitativeResultCache&& other) {
+            std::lock_guard<std::mutex> lock(other.mutex);
+            memoryBudget = other.memoryBudget;
+            sizeInBytes = other.sizeInBytes;
+            entries = std::move(other.entries);
+            other.entries.clear();
+            other.sizeInBytes = 0;
+        }
+
+        QualitativeResultCache& QualitativeResultCache::operator=(QualitativeResultCache&& other) {
+            if (this != &other) {
+                std::lock(mutex, other.mutex);
+                std::lock_guard<std::mutex> lock(mutex, std::adopt_lock);
+                std::lock_guard<std::mutex> otherLock(other.mutex, std::adopt_lock);
+                memoryBudget = other.memoryBudget;
+                sizeInBytes = other.sizeInBytes;
+                entries = std::move(other.entries);
+                other.entries.clear();
+                other.sizeInBytes = 0;
+            }
+            return *this;
+        }
+
+        QualitativeResultCache::ResultType QualitativeResultCache::getOrCompute(QueryType queryType, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::function<ResultType ()> const& computeResult) {
+            std::size_t hash = computeHash(queryType, phiStates, psiStates);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                auto entryIt = find(queryType, hash, phiStates, psiStates);
+                if (entryIt != entries.end()) {
+                    // Move the entry to the front, as it was used most recently.
+                    entries.splice(entries.begin(), entries, entryIt);
+                    return entries.front().result;
+                }
+            }
+
+            ResultType result = computeResult();
+            uint_fast64_t entrySizeInBytes = sizeof(Entry) + phiStates.getSizeInBytes() + psiStates.getSizeInBytes() + result.first.getSizeInBytes() + result.second.getSizeInBytes();
+
+            std::lock_guard<std::mutex> lock(mutex);
+            // Another thread may have stored the result of the same query in the meantime.
+            if (entrySizeInBytes <= memoryBudget && find(queryType, hash, phiStates, psiStates) == entries.end()) {
+                entries.push_front(Entry{queryType, hash, phiStates, psiStates, result, entrySizeInBytes});
+                sizeInBytes += entrySizeInBytes;
+                enforceMemoryBudget();
+            }
+            return result;
+        }
+
+        bool QualitativeResultCache::contains(QueryType queryType, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return find(queryType, computeHash(queryType, phiStates, psiStates), phiStates, psiStates) != entries.end();
+        }
+
+        uint_fast64_t QualitativeResultCache::getNumberOfEntries() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return entries.size();
+        }
+
+        uint_fast64_t QualitativeResultCache::getSizeInBytes() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return sizeInBytes;
+        }
+
+        uint_fast64_t QualitativeResultCache::getMemoryBudget() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return memoryBudget;
+        }
+
+        void QualitativeResultCache::setMemoryBudget(uint_fast64_t memoryBudget) {
+            std::lock_guard<std::mutex> lock(mutex);
+            this->memoryBudget = memoryBudget;
+            enforceMemoryBudget();
+        }
+
+        void QualitativeResultCache::clear() {
+            std::lock_guard<std::mutex> lock(mutex);
+            entries.clear();
+            sizeInBytes = 0;
+        }
+
+        std::size_t QualitativeResultCache::computeHash(QueryType queryType, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+            std::size_t seed = static_cast<std::size_t>(queryType);
+            boost::hash_combine(seed, std::hash<storm::storage::BitVector>()(phiStates));
+            boost::hash_combine(seed, std::hash<storm::storage::BitVector>()(psiStates));
+            return seed;
+        }
+
+        std::list<QualitativeResultCache::Entry>::const_iterator QualitativeResultCache::find(QueryType queryType, std::size_t hash, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) const {
+            for (auto entryIt = entries.begin(), entryIte = entries.end(); entryIt != entryIte; ++entryIt) {
+                if (entryIt->hash == hash && entryIt->queryType == queryType && entryIt->phiStates == phiStates && entryIt->psiStates == psiStates) {
+                    return entryIt;
+                }
+            }
+            return entries.end();
+        }
+
+        void QualitativeResultCache::enforceMemoryBudget() {
+            while (sizeInBytes > memoryBudget) {
+                sizeInBytes -= entries.back().sizeInBytes;
+                entries.pop_back();
+            }
+        }
+    }
+}
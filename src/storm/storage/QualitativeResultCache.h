@@ -0,0 +1,128 @@
+#ifndef STORM_STORAGE_QUALITATIVERESULTCACHE_H_
+#define STORM_STORAGE_QUALITATIVERESULTCACHE_H_
+
+#include <list>
+#include <mutex>
+#include <cstdint>
+#include <functional>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class stores the results of qualitative graph analyses (like prob0/prob1 precomputations) for one fixed
+         * model, such that repeated queries with the same phi and psi states can reuse the previous results. Since
+         * the results are only identified by the kind of query and the phi and psi states, the cache must not be
+         * shared between different models. If the results exceed the memory budget of the cache, the least recently
+         * used results are dropped. All operations may be called concurrently.
+         */
+        class QualitativeResultCache {
+        public:
+            // The kinds of queries whose results can be stored.
+            enum class QueryType { Prob01, Prob01Max, Prob01Min };
+
+            typedef std::pair<storm::storage::BitVector, storm::storage::BitVector> ResultType;
+
+            // The memory budget of caches for which no other budget is given (in bytes).
+            static const uint_fast64_t DEFAULT_MEMORY_BUDGET = 64 * 1024 * 1024;
+
+            /*!
+             * Creates an empty cache.
+             *
+             * @param memoryBudget The maximal number of bytes occupied by the stored queries and results.
+             */
+            QualitativeResultCache(uint_fast64_t memoryBudget = DEFAULT_MEMORY_BUDGET);
+
+            QualitativeResultCache(QualitativeResultCache const& other);
+            QualitativeResultCache& operator=(QualitativeResultCache const& other);
+            QualitativeResultCache(QualitativeResultCache&& other);
+            QualitativeResultCache& operator=(QualitativeResultCache&& other);
+
+            /*!
+             * Retrieves the result of the given query. If it is not yet stored, it is computed by the given function
+             * and inserted into the cache (unless it exceeds the memory budget on its own). The computation is
+             * performed without holding the lock of the cache, so concurrent queries are not blocked by it.
+             *
+             * @param queryType The kind of the query.
+             * @param phiStates The phi states of the query.
+             * @param psiStates The psi states of the query.
+             * @param computeResult The function that computes the result of the query.
+             * @return The result of the query.
+             */
+            ResultType getOrCompute(QueryType queryType, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::function<ResultType ()> const& computeResult);
+
+            /*!
+             * Retrieves whether the result of the given query is stored.
+             */
+            bool contains(QueryType queryType, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) const;
+
+            /*!
+             * Retrieves the number of stored results.
+             */
+            uint_fast64_t getNumberOfEntries() const;
+
+            /*!
+             * Retrieves the number of bytes occupied by the stored queries and results.
+             */
+            uint_fast64_t getSizeInBytes() const;
+
+            /*!
+             * Retrieves the maximal number of bytes occupied by the stored queries and results.
+             */
+            uint_fast64_t getMemoryBudget() const;
+
+            /*!
+             * Sets the maximal number of bytes occupied by the stored queries and results. If necessary, the least
+             * recently used results are dropped.
+             */
+            void setMemoryBudget(uint_fast64_t memoryBudget);
+
+            /*!
+             * Removes all stored results.
+             */
+            void clear();
+
+        private:
+            struct Entry {
+                QueryType queryType;
+                std::size_t hash;
+                storm::storage::BitVector phiStates;
+                storm::storage::BitVector psiStates;
+                ResultType result;
+                uint_fast64_t sizeInBytes;
+            };
+
+            /*!
+             * Computes the hash that identifies the given query.
+             */
+            static std::size_t computeHash(QueryType queryType, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+            /*!
+             * Retrieves the entry of the given query or the end of the entries if there is none.
+             */
+            std::list<Entry>::const_iterator find(QueryType queryType, std::size_t hash, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) const;
+
+            /*!
+             * Drops the least recently used results until the stored results do not exceed the memory budget. The
+             * caller has to hold the lock of the cache.
+             */
+            void enforceMemoryBudget();
+
+            // The maximal number of bytes occupied by the stored queries and results.
+            uint_fast64_t memoryBudget;
+
+            // The number of bytes occupied by the stored queries and results.
+            uint_fast64_t sizeInBytes;
+
+            // The stored results, the most recently used one first.
+            std::list<Entry> entries;
+
+            // Guards all members above.
+            mutable std::mutex mutex;
+        };
+    }
+}
+
+#endif /* STORM_STORAGE_QUALITATIVERESULTCACHE_H_ */
@@ -14,6 +14,7 @@
 #include "storm/storage/BitVector.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -23,6 +24,7 @@
 #include "storm/utility/macros.h"
 
 #include <iterator>
+#include <type_traits>
 
 namespace storm {
     namespace storage {
@@ -953,6 +955,119 @@ namespace storm {
             return matrixBuilder.build();
         }
         
+        template<typename ValueType>
+        std::vector<MatrixEntry<typename SparseMatrix<ValueType>::index_type, ValueType>> SparseMatrix<ValueType>::getRowWithDiagonalAndPadding(index_type row, index_type diagonalColumn, index_type numberOfEntries) const {
+            ValueType zero = storm::utility::zero<ValueType>();
+            
+            // Copy the entries of the row and insert a zero element on the diagonal if there is no entry yet.
+            std::vector<MatrixEntry<index_type, ValueType>> entries;
+            entries.reserve(numberOfEntries);
+            bool insertedDiagonalElement = false;
+            for (auto const& entry : this->getRow(row)) {
+                if (entry.getColumn() == diagonalColumn) {
+                    insertedDiagonalElement = true;
+                } else if (!insertedDiagonalElement && entry.getColumn() > diagonalColumn) {
+                    entries.emplace_back(diagonalColumn, zero);
+                    insertedDiagonalElement = true;
+                }
+                entries.push_back(entry);
+            }
+            if (!insertedDiagonalElement) {
+                entries.emplace_back(diagonalColumn, zero);
+            }
+            
+            // Fill the remaining space with zero elements in the smallest columns that are not used by the row.
+            if (entries.size() < numberOfEntries) {
+                std::vector<MatrixEntry<index_type, ValueType>> paddedEntries;
+                paddedEntries.reserve(numberOfEntries);
+                index_type missingEntries = numberOfEntries - entries.size();
+                index_type column = 0;
+                auto entryIt = entries.begin();
+                while (entryIt != entries.end() || missingEntries > 0) {
+                    if (missingEntries > 0 && (entryIt == entries.end() || column < entryIt->getColumn())) {
+                        paddedEntries.emplace_back(column, zero);
+                        --missingEntries;
+                        ++column;
+                    } else {
+                        paddedEntries.push_back(*entryIt);
+                        column = entryIt->getColumn() + 1;
+                        ++entryIt;
+                    }
+                }
+                entries = std::move(paddedEntries);
+            }
+            return entries;
+        }
+        
+        template<typename ValueType>
+        SparseMatrix<ValueType> SparseMatrix<ValueType>::selectRowsFromRowGroupsWithSlack(std::vector<index_type> const& rowGroupToRowIndexMapping) const {
+            // Every row is given the space of the largest row of its group (including the diagonal entry).
+            std::vector<index_type> capacities(rowGroupToRowIndexMapping.size());
+            index_type subEntries = 0;
+            for (index_type rowGroupIndex = 0, rowGroupIndexEnd = rowGroupToRowIndexMapping.size(); rowGroupIndex < rowGroupIndexEnd; ++rowGroupIndex) {
+                for (index_type row = this->getRowGroupIndices()[rowGroupIndex]; row < this->getRowGroupIndices()[rowGroupIndex + 1]; ++row) {
+                    bool foundDiagonalElement = false;
+                    for (auto const& entry : this->getRow(row)) {
+                        if (entry.getColumn() == rowGroupIndex) {
+                            foundDiagonalElement = true;
+                        }
+                    }
+                    capacities[rowGroupIndex] = std::max(capacities[rowGroupIndex], this->getRow(row).getNumberOfEntries() + (foundDiagonalElement ? 0 : 1));
+                }
+                subEntries += capacities[rowGroupIndex];
+            }
+            
+            SparseMatrixBuilder<ValueType> matrixBuilder(rowGroupIndices.get().size() - 1, columnCount, subEntries);
+            for (index_type rowGroupIndex = 0, rowGroupIndexEnd = rowGroupToRowIndexMapping.size(); rowGroupIndex < rowGroupIndexEnd; ++rowGroupIndex) {
+                index_type rowToCopy = this->getRowGroupIndices()[rowGroupIndex] + rowGroupToRowIndexMapping[rowGroupIndex];
+                for (auto const& entry : getRowWithDiagonalAndPadding(rowToCopy, rowGroupIndex, capacities[rowGroupIndex])) {
+                    matrixBuilder.addNextValue(rowGroupIndex, entry.getColumn(), entry.getValue());
+                }
+            }
+            return matrixBuilder.build();
+        }
+        
+        template<typename ValueType>
+        bool SparseMatrix<ValueType>::replaceRowsFromRowGroups(SparseMatrix const& source, std::vector<index_type> const& rowGroupToRowIndexMapping, std::vector<index_type> const& rowsToReplace, bool convertToEquationSystem) {
+            // First, check whether all new rows fit into the space of the rows they replace.
+            for (auto row : rowsToReplace) {
+                index_type rowToCopy = source.getRowGroupIndices()[row] + rowGroupToRowIndexMapping[row];
+                bool foundDiagonalElement = false;
+                for (auto const& entry : source.getRow(rowToCopy)) {
+                    if (entry.getColumn() == row) {
+                        foundDiagonalElement = true;
+                    }
+                }
+                index_type requiredEntries = source.getRow(rowToCopy).getNumberOfEntries() + (foundDiagonalElement ? 0 : 1);
+                if (requiredEntries > this->getRow(row).getNumberOfEntries()) {
+                    return false;
+                }
+            }
+            
+            ValueType one = storm::utility::one<ValueType>();
+            for (auto row : rowsToReplace) {
+                index_type rowToCopy = source.getRowGroupIndices()[row] + rowGroupToRowIndexMapping[row];
+                
+                for (auto const& entry : this->getRow(row)) {
+                    if (!storm::utility::isZero(entry.getValue())) {
+                        --this->nonzeroEntryCount;
+                    }
+                }
+                
+                // Copy the entries of the selected row (plus the diagonal and the zero elements filling the row).
+                iterator targetIt = this->begin(row);
+                for (auto const& entry : source.getRowWithDiagonalAndPadding(rowToCopy, row, this->getRow(row).getNumberOfEntries())) {
+                    targetIt->setColumn(entry.getColumn());
+                    targetIt->setValue(convertToEquationSystem ? (entry.getColumn() == row ? one - entry.getValue() : -entry.getValue()) : entry.getValue());
+                    if (!storm::utility::isZero(targetIt->getValue())) {
+                        ++this->nonzeroEntryCount;
+                    }
+                    ++targetIt;
+                }
+            }
+            return true;
+        }
+        
         template<typename ValueType>
         SparseMatrix<ValueType> SparseMatrix<ValueType>::selectRowsFromRowIndexSequence(std::vector<index_type> const& rowIndexSequence, bool insertDiagonalEntries) const{
             // First, we need to count how many non-zero entries the resulting matrix will have and reserve space for
@@ -1167,73 +1282,186 @@ namespace storm {
         }
 
         template<typename ValueType>
-        void SparseMatrix<ValueType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const {
+        void SparseMatrix<ValueType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
 #ifdef STORM_HAVE_INTELTBB
             if (this->getNonzeroEntryCount() > 10000) {
-                return this->multiplyWithVectorParallel(vector, result);
+                return this->multiplyWithVectorParallel(vector, result, summand);
             } else {
-                return this->multiplyWithVectorSequential(vector, result);
+                return this->multiplyWithVectorSequential(vector, result, summand);
             }
 #else
-            return multiplyWithVectorSequential(vector, result);
+            // Only plain arithmetic types are multiplied in parallel, because the arithmetic of other types (e.g.
+            // rational functions) may use shared caches that are not thread-safe.
+            if (std::is_arithmetic<ValueType>::value && storm::utility::parallel::isParallelismEnabled() && this->getNonzeroEntryCount() > 10000) {
+                return this->multiplyWithVectorParallel(vector, result, summand);
+            } else {
+                return multiplyWithVectorSequential(vector, result, summand);
+            }
 #endif
         }
 
         template<typename ValueType>
-        void SparseMatrix<ValueType>::multiplyWithVectorSequential(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const {
+        void SparseMatrix<ValueType>::multiplyWithVectorSequential(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
             if (&vector == &result) {
                 STORM_LOG_WARN("Matrix-vector-multiplication invoked but the target vector uses the same memory as the input vector. This requires to allocate auxiliary memory.");
                 std::vector<ValueType> tmpVector(this->getRowCount());
-                multiplyWithVectorSequential(vector, tmpVector);
+                multiplyWithVectorSequential(vector, tmpVector, summand);
                 result = std::move(tmpVector);
             } else {
-                const_iterator it = this->begin();
-                const_iterator ite;
-                std::vector<index_type>::const_iterator rowIterator = rowIndications.begin();
-                typename std::vector<ValueType>::iterator resultIterator = result.begin();
-                typename std::vector<ValueType>::iterator resultIteratorEnd = result.end();
-
-                for (; resultIterator != resultIteratorEnd; ++rowIterator, ++resultIterator) {
-                    *resultIterator = storm::utility::zero<ValueType>();
-
-                    for (ite = this->begin() + *(rowIterator + 1); it != ite; ++it) {
-                        *resultIterator += it->getValue() * vector[it->getColumn()];
-                    }
-                }
+                multiplyWithVectorForRowRange(0, this->getRowCount(), vector, result, summand);
             }
         }
 
-#ifdef STORM_HAVE_INTELTBB
         template<typename ValueType>
-        void SparseMatrix<ValueType>::multiplyWithVectorParallel(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const {
+        void SparseMatrix<ValueType>::multiplyWithVectorParallel(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
             if (&vector == &result) {
                 STORM_LOG_WARN("Matrix-vector-multiplication invoked but the target vector uses the same memory as the input vector. This requires to allocate auxiliary memory.");
                 std::vector<ValueType> tmpVector(this->getRowCount());
-                multiplyWithVectorParallel(vector, tmpVector);
+                multiplyWithVectorParallel(vector, tmpVector, summand);
                 result = std::move(tmpVector);
             } else {
+#ifdef STORM_HAVE_INTELTBB
                 tbb::parallel_for(tbb::blocked_range<index_type>(0, result.size(), 10),
                                   [&] (tbb::blocked_range<index_type> const& range) {
-                                      index_type startRow = range.begin();
-                                      index_type endRow = range.end();
-                                      const_iterator it = this->begin(startRow);
-                                      const_iterator ite;
-                                      std::vector<index_type>::const_iterator rowIterator = this->rowIndications.begin() + startRow;
-                                      std::vector<index_type>::const_iterator rowIteratorEnd = this->rowIndications.begin() + endRow;
-                                      typename std::vector<ValueType>::iterator resultIterator = result.begin() + startRow;
-                                      typename std::vector<ValueType>::iterator resultIteratorEnd = result.begin() + endRow;
-
-                                      for (; resultIterator != resultIteratorEnd; ++rowIterator, ++resultIterator) {
-                                          *resultIterator = storm::utility::zero<ValueType>();
-
-                                          for (ite = this->begin() + *(rowIterator + 1); it != ite; ++it) {
-                                              *resultIterator += it->getValue() * vector[it->getColumn()];
-                                          }
-                                      }
+                                      this->multiplyWithVectorForRowRange(range.begin(), range.end(), vector, result, summand);
                                   });
+#else
+                std::vector<index_type> partition = this->getEntryBalancedRowPartition(storm::utility::parallel::getNumberOfThreads());
+                storm::utility::parallel::parallelForChunks(partition, [&] (index_type startRow, index_type endRow) {
+                    this->multiplyWithVectorForRowRange(startRow, endRow, vector, result, summand);
+                });
+#endif
             }
         }
-#endif
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyWithVectorForRowRange(index_type startRow, index_type endRow, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            const_iterator it = this->begin(startRow);
+            const_iterator ite;
+            std::vector<index_type>::const_iterator rowIterator = rowIndications.begin() + startRow;
+            typename std::vector<ValueType>::iterator resultIterator = result.begin() + startRow;
+            typename std::vector<ValueType>::iterator resultIteratorEnd = result.begin() + endRow;
+            typename std::vector<ValueType>::const_iterator summandIterator;
+            if (summand != nullptr) {
+                summandIterator = summand->begin() + startRow;
+            }
+            
+            for (; resultIterator != resultIteratorEnd; ++rowIterator, ++resultIterator) {
+                if (summand != nullptr) {
+                    *resultIterator = *summandIterator;
+                    ++summandIterator;
+                } else {
+                    *resultIterator = storm::utility::zero<ValueType>();
+                }
+                
+                for (ite = this->begin() + *(rowIterator + 1); it != ite; ++it) {
+                    *resultIterator += it->getValue() * vector[it->getColumn()];
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<index_type> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<index_type>* choices) const {
+            if (&vector == &result) {
+                STORM_LOG_WARN("Matrix-vector-multiplication invoked but the target vector uses the same memory as the input vector. This requires to allocate auxiliary memory.");
+                std::vector<ValueType> tmpVector(rowGroupIndices.size() - 1);
+                multiplyAndReduce(dir, rowGroupIndices, vector, summand, tmpVector, choices);
+                result = std::move(tmpVector);
+                return;
+            }
+            
+            index_type groupCount = rowGroupIndices.size() - 1;
+            if (std::is_arithmetic<ValueType>::value && storm::utility::parallel::isParallelismEnabled() && this->getNonzeroEntryCount() > 10000) {
+                // Split the row groups such that all parts have roughly the same number of entries.
+                index_type numberOfParts = storm::utility::parallel::getNumberOfThreads();
+                std::vector<index_type> partition(numberOfParts + 1, groupCount);
+                partition.front() = 0;
+                index_type entries = rowIndications[rowGroupIndices.back()] - rowIndications[rowGroupIndices.front()];
+                for (index_type part = 1; part < numberOfParts; ++part) {
+                    index_type targetEntry = rowIndications[rowGroupIndices.front()] + (entries * part) / numberOfParts;
+                    index_type row = std::upper_bound(rowIndications.begin(), rowIndications.begin() + this->getRowCount() + 1, targetEntry) - rowIndications.begin() - 1;
+                    index_type group = std::upper_bound(rowGroupIndices.begin(), rowGroupIndices.end(), row) - rowGroupIndices.begin() - 1;
+                    partition[part] = std::min(std::max(group, partition[part - 1]), groupCount);
+                }
+                storm::utility::parallel::parallelForChunks(partition, [&] (index_type startGroup, index_type endGroup) {
+                    this->multiplyAndReduceForRowGroupRange(startGroup, endGroup, dir, rowGroupIndices, vector, summand, result, choices);
+                });
+            } else {
+                multiplyAndReduceForRowGroupRange(0, groupCount, dir, rowGroupIndices, vector, summand, result, choices);
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduceForRowGroupRange(index_type startGroup, index_type endGroup, storm::solver::OptimizationDirection const& dir, std::vector<index_type> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<index_type>* choices) const {
+            bool minimize = dir == storm::solver::OptimizationDirection::Minimize;
+            index_type choice = 0;
+            for (index_type group = startGroup; group < endGroup; ++group) {
+                result[group] = multiplyAndReduceRowGroup(rowGroupIndices[group], rowGroupIndices[group + 1], minimize, vector, summand, choice);
+                if (choices != nullptr) {
+                    (*choices)[group] = choice;
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduceGaussSeidel(storm::solver::OptimizationDirection const& dir, std::vector<index_type> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* summand, std::vector<index_type>* choices, std::vector<index_type> const* rowGroupOrder) const {
+            STORM_LOG_ASSERT(x.size() == rowGroupIndices.size() - 1, "Gauss-Seidel sweep requires one vector entry per row group.");
+            bool minimize = dir == storm::solver::OptimizationDirection::Minimize;
+            index_type choice = 0;
+            index_type groupCount = rowGroupIndices.size() - 1;
+            for (index_type index = 0; index < groupCount; ++index) {
+                index_type group = rowGroupOrder != nullptr ? (*rowGroupOrder)[index] : index;
+                x[group] = multiplyAndReduceRowGroup(rowGroupIndices[group], rowGroupIndices[group + 1], minimize, x, summand, choice);
+                if (choices != nullptr) {
+                    (*choices)[group] = choice;
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        ValueType SparseMatrix<ValueType>::multiplyAndReduceRowGroup(index_type startRow, index_type endRow, bool minimize, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, index_type& choice) const {
+            ValueType currentValue = storm::utility::zero<ValueType>();
+            choice = 0;
+            
+            const_iterator it = this->begin(startRow);
+            const_iterator ite;
+            for (index_type row = startRow; row < endRow; ++row) {
+                ValueType newValue = summand != nullptr ? (*summand)[row] : storm::utility::zero<ValueType>();
+                for (ite = this->end(row); it != ite; ++it) {
+                    newValue += it->getValue() * vector[it->getColumn()];
+                }
+                
+                // The first row of each group always determines the initial value.
+                if (row == startRow || (minimize && newValue < currentValue) || (!minimize && newValue > currentValue)) {
+                    currentValue = std::move(newValue);
+                    choice = row - startRow;
+                }
+            }
+            return currentValue;
+        }
+        
+        template<typename ValueType>
+        std::vector<typename SparseMatrix<ValueType>::index_type> SparseMatrix<ValueType>::getEntryBalancedRowPartition(index_type numberOfParts) const {
+            STORM_LOG_ASSERT(numberOfParts > 0, "Cannot split matrix into zero parts.");
+            std::vector<index_type> result(numberOfParts + 1, this->getRowCount());
+            result.front() = 0;
+            
+            index_type entries = rowIndications[this->getRowCount()];
+            for (index_type part = 1; part < numberOfParts; ++part) {
+                // Find the row in which the desired first entry of the part lies.
+                index_type targetEntry = (entries * part) / numberOfParts;
+                index_type row = std::upper_bound(rowIndications.begin(), rowIndications.begin() + this->getRowCount() + 1, targetEntry) - rowIndications.begin() - 1;
+                
+                // Move the boundary to the beginning of the row group that contains the row.
+                if (!this->hasTrivialRowGrouping()) {
+                    std::vector<index_type> const& groups = this->getRowGroupIndices();
+                    row = *(std::upper_bound(groups.begin(), groups.end(), row) - 1);
+                }
+                result[part] = std::max(row, result[part - 1]);
+            }
+            
+            return result;
+        }
         
         template<typename ValueType>
         ValueType SparseMatrix<ValueType>::multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const {
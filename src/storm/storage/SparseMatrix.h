@@ -13,6 +13,7 @@
 #include "storm/utility/OsDetection.h"
 #include "storm/utility/macros.h"
 #include "storm/adapters/CarlAdapter.h"
+#include "storm/solver/OptimizationDirection.h"
 
 // Forward declaration for adapter classes.
 namespace storm {
@@ -680,6 +681,33 @@ namespace storm {
              */
             SparseMatrix selectRowsFromRowGroups(std::vector<index_type> const& rowGroupToRowIndexMapping, bool insertDiagonalEntries = true) const;
             
+            /*!
+             * Selects exactly one row from each row group of this matrix like selectRowsFromRowGroups (with diagonal
+             * entries), but fills every selected row with zero elements such that any row of its row group fits into
+             * it. This way, the rows can always be replaced in place by replaceRowsFromRowGroups.
+             *
+             * @param rowGroupToRowIndexMapping A mapping from each row group index to a selected row in this group.
+             * @return A submatrix of the current matrix by selecting one row out of each row group.
+             */
+            SparseMatrix selectRowsFromRowGroupsWithSlack(std::vector<index_type> const& rowGroupToRowIndexMapping) const;
+            
+            /*!
+             * Replaces the given rows of this matrix by the rows of the source matrix that are selected by the mapping,
+             * i.e. row i of this matrix is replaced by the selected row of row group i of the source. This matrix is
+             * assumed to have been obtained via selectRowsFromRowGroups with diagonal entries (or via
+             * selectRowsFromRowGroupsWithSlack). The rows are replaced in place, which is only possible if the new rows
+             * have at most as many entries as the rows they replace. The remaining space is filled with zero elements.
+             * If one of the rows does not fit, the matrix is left unchanged.
+             *
+             * @param source The matrix from whose row groups the rows are to be taken.
+             * @param rowGroupToRowIndexMapping A mapping from each row group index to a selected row in this group.
+             * @param rowsToReplace The rows of this matrix that are to be replaced.
+             * @param convertToEquationSystem If set, the replaced rows are brought to the form of the equation system
+             * (I - A)x = b as done by convertToEquationSystem.
+             * @return True iff the rows could be replaced.
+             */
+            bool replaceRowsFromRowGroups(SparseMatrix const& source, std::vector<index_type> const& rowGroupToRowIndexMapping, std::vector<index_type> const& rowsToReplace, bool convertToEquationSystem);
+            
             /*!
              * Selects the rows that are given by the sequence of row indices, allowing to select rows arbitrarily often and with an arbitrary order
              * The resulting matrix will have a trivial row grouping
@@ -749,9 +777,43 @@ namespace storm {
              *
              * @param vector The vector with which to multiply the matrix.
              * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand is added to the result of the multiplication.
              * @return The product of the matrix and the given vector as the content of the given result vector.
              */
-            void multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result) const;
+            void multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+            
+            /*!
+             * Multiplies the matrix with the given vector, adds the given summand and reduces the result by taking the
+             * minimum/maximum over each of the given row groups. This is done in a single pass over the matrix, i.e.
+             * no intermediate vector with one entry per row is needed. If it is considered worthwhile and parallelism
+             * is enabled, the computation is carried out in parallel.
+             *
+             * @param dir The direction of the reduction.
+             * @param rowGroupIndices The row groups over which to reduce.
+             * @param vector The vector with which to multiply the matrix.
+             * @param summand If given, this summand is added to the result of the multiplication before reducing.
+             * @param result The vector that is supposed to hold the result (one entry per row group) after the operation.
+             * @param choices If given, the index of the optimal row of each group (relative to the first row of the
+             * group) is written to this vector.
+             */
+            void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<index_type> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<index_type>* choices = nullptr) const;
+            
+            /*!
+             * Performs one Gauss-Seidel style sweep of the fused multiply-and-reduce operation, i.e. the row groups are
+             * processed one after another and the result of each group is written to the given vector immediately, so
+             * later groups already see the updated values. This requires the matrix to have as many columns as there
+             * are row groups.
+             *
+             * @param dir The direction of the reduction.
+             * @param rowGroupIndices The row groups over which to reduce.
+             * @param x The vector with which to multiply the matrix. It is updated in place.
+             * @param summand If given, this summand is added to the result of the multiplication before reducing.
+             * @param choices If given, the index of the optimal row of each group (relative to the first row of the
+             * group) is written to this vector.
+             * @param rowGroupOrder If given, the row groups are processed in this order. Otherwise, they are processed
+             * in ascending order.
+             */
+            void multiplyAndReduceGaussSeidel(storm::solver::OptimizationDirection const& dir, std::vector<index_type> const& rowGroupIndices, std::vector<value_type>& x, std::vector<value_type> const* summand, std::vector<index_type>* choices = nullptr, std::vector<index_type> const* rowGroupOrder = nullptr) const;
             
             /*!
              * Multiplies a single row of the matrix with the given vector and returns the result
@@ -788,21 +850,34 @@ namespace storm {
              *
              * @param vector The vector with which to multiply the matrix.
              * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand is added to the result of the multiplication.
              * @return The product of the matrix and the given vector as the content of the given result vector.
              */
-            void multiplyWithVectorSequential(std::vector<value_type> const& vector, std::vector<value_type>& result) const;
+            void multiplyWithVectorSequential(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
 
-#ifdef STORM_HAVE_INTELTBB
             /*!
-             * Multiplies the matrix with the given vector in a parallel fashion using Intel's TBB and writes the result
-             * to the given result vector.
+             * Multiplies the matrix with the given vector in a parallel fashion and writes the result to the given
+             * result vector. If Intel's TBB is available, it is used. Otherwise, the rows are split into ranges with
+             * roughly the same number of entries (respecting the row groups) that are processed by storm's built-in
+             * thread pool.
              *
              * @param vector The vector with which to multiply the matrix.
              * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand is added to the result of the multiplication.
              * @return The product of the matrix and the given vector as the content of the given result vector.
              */
-            void multiplyWithVectorParallel(std::vector<value_type> const& vector, std::vector<value_type>& result) const;
-#endif
+            void multiplyWithVectorParallel(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+            
+            /*!
+             * Splits the rows of the matrix into the given number of consecutive ranges such that each range contains
+             * roughly the same number of entries. Row groups are never split, i.e. every boundary is the first row of
+             * a row group.
+             *
+             * @param numberOfParts The desired number of ranges.
+             * @return A sorted vector of numberOfParts + 1 row indices such that range i is given by the rows
+             * [result[i], result[i + 1]). Some ranges may be empty.
+             */
+            std::vector<index_type> getEntryBalancedRowPartition(index_type numberOfParts) const;
             
             /*!
              * Computes the sum of the entries in a given row.
@@ -1006,6 +1081,50 @@ namespace storm {
              */
             SparseMatrix getSubmatrix(storm::storage::BitVector const& rowGroupConstraint, storm::storage::BitVector const& columnConstraint, std::vector<index_type> const& rowGroupIndices, bool insertDiagonalEntries = false) const;
             
+            /*!
+             * Retrieves the entries of the given row together with a zero entry in the given diagonal column (if there
+             * is no entry yet) and zero entries in otherwise unused columns such that there are the given number of
+             * entries.
+             *
+             * @param row The row whose entries to retrieve.
+             * @param diagonalColumn The column of the diagonal entry.
+             * @param numberOfEntries The number of entries that is to be reached by inserting zero entries.
+             * @return The entries ordered by column.
+             */
+            std::vector<MatrixEntry<index_type, value_type>> getRowWithDiagonalAndPadding(index_type row, index_type diagonalColumn, index_type numberOfEntries) const;
+            
+            /*!
+             * Multiplies the given range of rows of the matrix with the given vector and writes the result to the
+             * corresponding positions of the result vector.
+             *
+             * @param startRow The first row to multiply.
+             * @param endRow The row past the last row to multiply.
+             * @param vector The vector with which to multiply the matrix.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand is added to the result of the multiplication.
+             */
+            void multiplyWithVectorForRowRange(index_type startRow, index_type endRow, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const;
+            
+            /*!
+             * Performs the fused multiply-and-reduce operation for the given range of row groups.
+             *
+             * @param startGroup The first row group to process.
+             * @param endGroup The row group past the last row group to process.
+             * @see multiplyAndReduce
+             */
+            void multiplyAndReduceForRowGroupRange(index_type startGroup, index_type endGroup, storm::solver::OptimizationDirection const& dir, std::vector<index_type> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<index_type>* choices) const;
+            
+            /*!
+             * Computes the minimum/maximum over the given rows of the product of the matrix and the given vector plus
+             * the summand (if given).
+             *
+             * @param startRow The first row of the group.
+             * @param endRow The row past the last row of the group.
+             * @param choice This is set to the index of the optimal row relative to the first row.
+             * @return The optimal value.
+             */
+            value_type multiplyAndReduceRowGroup(index_type startRow, index_type endRow, bool minimize, std::vector<value_type> const& vector, std::vector<value_type> const* summand, index_type& choice) const;
+            
             // The number of rows of the matrix.
             index_type rowCount;
             
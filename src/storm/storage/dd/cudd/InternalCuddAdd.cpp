@@ -1,5 +1,7 @@
 #include "storm/storage/dd/cudd/InternalCuddAdd.h"
 
+#include <type_traits>
+
 #include "storm/storage/dd/cudd/InternalCuddDdManager.h"
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
 #include "storm/storage/dd/cudd/CuddAddIterator.h"
@@ -9,6 +11,7 @@
 
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/NotImplementedException.h"
 
 namespace storm {
@@ -505,7 +508,79 @@ namespace storm {
         
         template<typename ValueType>
         void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-            return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+            
+            // Large matrices are translated concurrently. For this, the DD is split at the top-most row variables and
+            // the parts covering disjoint rows are translated by different threads. Since the rows have disjoint
+            // slices of the entry vector, the threads do not interfere.
+            uint_fast64_t splitLevel = 0;
+            if (std::is_arithmetic<ValueType>::value && storm::utility::parallel::isParallelismEnabled() && columnsAndValues.size() > 100000) {
+                while (splitLevel < ddRowVariableIndices.size() && (1ull << splitLevel) < 8 * storm::utility::parallel::getNumberOfThreads()) {
+                    ++splitLevel;
+                }
+            }
+            
+            if (splitLevel == 0) {
+                toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            } else {
+                std::vector<std::vector<MatrixComponentsTask>> tasks(1ull << splitLevel);
+                collectMatrixComponentsTasksRec(this->getCuddDdNode(), rowOdd, columnOdd, 0, splitLevel, 0, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                storm::utility::parallel::getThreadPool().execute(tasks.size(), [&] (uint_fast64_t partition) {
+                    for (auto const& task : tasks[partition]) {
+                        toMatrixComponentsRec(task.dd, rowGroupIndices, rowIndications, columnsAndValues, *task.rowOdd, *task.columnOdd, task.currentLevel, task.currentLevel, maxLevel, task.currentRowOffset, task.currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                    }
+                });
+            }
+        }
+        
+        template<typename ValueType>
+        void InternalAdd<DdType::CUDD, ValueType>::getMatrixSuccessors(DdNode const* dd, uint_fast64_t currentLevel, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, DdNode const* (&successors)[4]) {
+            if (ddColumnVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
+                successors[0] = successors[1] = successors[2] = successors[3] = dd;
+            } else if (ddRowVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
+                successors[0] = successors[2] = Cudd_E_const(dd);
+                successors[1] = successors[3] = Cudd_T_const(dd);
+            } else {
+                DdNode const* elseNode = Cudd_E_const(dd);
+                if (ddColumnVariableIndices[currentLevel] < Cudd_NodeReadIndex(elseNode)) {
+                    successors[0] = successors[1] = elseNode;
+                } else {
+                    successors[0] = Cudd_E_const(elseNode);
+                    successors[1] = Cudd_T_const(elseNode);
+                }
+                
+                DdNode const* thenNode = Cudd_T_const(dd);
+                if (ddColumnVariableIndices[currentLevel] < Cudd_NodeReadIndex(thenNode)) {
+                    successors[2] = successors[3] = thenNode;
+                } else {
+                    successors[2] = Cudd_E_const(thenNode);
+                    successors[3] = Cudd_T_const(thenNode);
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void InternalAdd<DdType::CUDD, ValueType>::collectMatrixComponentsTasksRec(DdNode const* dd, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentPartition, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, std::vector<std::vector<MatrixComponentsTask>>& tasks) const {
+            // For the empty DD, we do not need to add any entries.
+            if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
+                return;
+            }
+            
+            if (currentLevel == splitLevel) {
+                tasks[currentPartition].push_back(MatrixComponentsTask{dd, &rowOdd, &columnOdd, currentLevel, currentRowOffset, currentColumnOffset});
+            } else {
+                DdNode const* successors[4];
+                getMatrixSuccessors(dd, currentLevel, ddRowVariableIndices, ddColumnVariableIndices, successors);
+                
+                // The partitions are extended by the value of the row variable, so the rows of the then-successors end
+                // up in different partitions than the ones of the else-successors.
+                uint_fast64_t elsePartition = currentPartition << 1;
+                uint_fast64_t thenPartition = elsePartition | 1;
+                collectMatrixComponentsTasksRec(successors[0], rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, elsePartition, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                collectMatrixComponentsTasksRec(successors[1], rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, elsePartition, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                collectMatrixComponentsTasksRec(successors[2], rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, thenPartition, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                collectMatrixComponentsTasksRec(successors[3], rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, thenPartition, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, tasks);
+            }
         }
 
         template<typename ValueType>
@@ -522,42 +597,17 @@ namespace storm {
                 }
                 ++rowIndications[rowGroupOffsets[currentRowOffset]];
             } else {
-                DdNode const* elseElse;
-                DdNode const* elseThen;
-                DdNode const* thenElse;
-                DdNode const* thenThen;
-                
-                if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(dd)) {
-                    elseElse = elseThen = thenElse = thenThen = dd;
-                } else if (ddRowVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(dd)) {
-                    elseElse = thenElse = Cudd_E_const(dd);
-                    elseThen = thenThen = Cudd_T_const(dd);
-                } else {
-                    DdNode const* elseNode = Cudd_E_const(dd);
-                    if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(elseNode)) {
-                        elseElse = elseThen = elseNode;
-                    } else {
-                        elseElse = Cudd_E_const(elseNode);
-                        elseThen = Cudd_T_const(elseNode);
-                    }
-                    
-                    DdNode const* thenNode = Cudd_T_const(dd);
-                    if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(thenNode)) {
-                        thenElse = thenThen = thenNode;
-                    } else {
-                        thenElse = Cudd_E_const(thenNode);
-                        thenThen = Cudd_T_const(thenNode);
-                    }
-                }
+                DdNode const* successors[4];
+                getMatrixSuccessors(dd, currentColumnLevel, ddRowVariableIndices, ddColumnVariableIndices, successors);
                 
                 // Visit else-else.
-                toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(successors[0], rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
                 // Visit else-then.
-                toMatrixComponentsRec(elseThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(successors[1], rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
                 // Visit then-else.
-                toMatrixComponentsRec(thenElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(successors[2], rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
                 // Visit then-then.
-                toMatrixComponentsRec(thenThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(successors[3], rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
             }
         }
         
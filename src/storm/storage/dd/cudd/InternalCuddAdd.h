@@ -654,6 +654,49 @@ namespace storm {
              */
             void toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
             
+            /*!
+             * Retrieves the four successors of the given node that correspond to the valuations of the row and column
+             * variable at the given level.
+             *
+             * @param dd The DD whose successors to retrieve.
+             * @param currentLevel The currently considered (row and column) level in the DD.
+             * @param ddRowVariableIndices The (sorted) indices of all DD row variables that need to be considered.
+             * @param ddColumnVariableIndices The (sorted) indices of all DD column variables that need to be considered.
+             * @param successors The array that is to be filled with the else-else, else-then, then-else and then-then
+             * successor (in this order).
+             */
+            static void getMatrixSuccessors(DdNode const* dd, uint_fast64_t currentLevel, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, DdNode const* (&successors)[4]);
+            
+            // The part of the translation into matrix components that starts at a certain node of the DD.
+            struct MatrixComponentsTask {
+                DdNode const* dd;
+                Odd const* rowOdd;
+                Odd const* columnOdd;
+                uint_fast64_t currentLevel;
+                uint_fast64_t currentRowOffset;
+                uint_fast64_t currentColumnOffset;
+            };
+            
+            /*!
+             * Descends into the DD until the given split level and collects the sub-DDs found there as tasks. The tasks
+             * are partitioned by the valuation of the row variables above the split level, so that tasks of different
+             * partitions write to disjoint rows. Within a partition, the tasks are ordered as they would be visited
+             * by the recursive translation.
+             *
+             * @param dd The DD to descend into.
+             * @param rowOdd The ODD used for the row translation.
+             * @param columnOdd The ODD used for the column translation.
+             * @param currentLevel The currently considered (row and column) level in the DD.
+             * @param splitLevel The level at which to create the tasks.
+             * @param currentPartition The partition identified by the valuation of the row variables so far.
+             * @param currentRowOffset The current row offset.
+             * @param currentColumnOffset The current column offset.
+             * @param ddRowVariableIndices The (sorted) indices of all DD row variables that need to be considered.
+             * @param ddColumnVariableIndices The (sorted) indices of all DD column variables that need to be considered.
+             * @param tasks The tasks of each partition.
+             */
+            void collectMatrixComponentsTasksRec(DdNode const* dd, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentPartition, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, std::vector<std::vector<MatrixComponentsTask>>& tasks) const;
+            
             /*!
              * Builds an ADD representing the given vector.
              *
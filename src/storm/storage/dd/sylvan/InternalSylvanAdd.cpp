@@ -1,5 +1,7 @@
 #include "storm/storage/dd/sylvan/InternalSylvanAdd.h"
 
+#include <type_traits>
+
 #include "storm/storage/dd/sylvan/SylvanAddIterator.h"
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/storage/dd/DdManager.h"
@@ -8,6 +10,7 @@
 
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/NotImplementedException.h"
 
 #include "storm-config.h"
@@ -734,7 +737,80 @@ namespace storm {
         
         template<typename ValueType>
         void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-            return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+            MTBDD dd = this->getSylvanMtbdd().GetMTBDD();
+            
+            // Large matrices are translated concurrently. For this, the DD is split at the top-most row variables and
+            // the parts covering disjoint rows are translated by different threads. Since the rows have disjoint
+            // slices of the entry vector, the threads do not interfere.
+            uint_fast64_t splitLevel = 0;
+            if (std::is_arithmetic<ValueType>::value && storm::utility::parallel::isParallelismEnabled() && columnsAndValues.size() > 100000) {
+                while (splitLevel < ddRowVariableIndices.size() && (1ull << splitLevel) < 8 * storm::utility::parallel::getNumberOfThreads()) {
+                    ++splitLevel;
+                }
+            }
+            
+            if (splitLevel == 0) {
+                toMatrixComponentsRec(mtbdd_regular(dd), mtbdd_hascomp(dd), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            } else {
+                std::vector<std::vector<MatrixComponentsTask>> tasks(1ull << splitLevel);
+                collectMatrixComponentsTasksRec(mtbdd_regular(dd), mtbdd_hascomp(dd), rowOdd, columnOdd, 0, splitLevel, 0, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                storm::utility::parallel::getThreadPool().execute(tasks.size(), [&] (uint_fast64_t partition) {
+                    for (auto const& task : tasks[partition]) {
+                        toMatrixComponentsRec(task.dd, task.negated, rowGroupIndices, rowIndications, columnsAndValues, *task.rowOdd, *task.columnOdd, task.currentLevel, task.currentLevel, maxLevel, task.currentRowOffset, task.currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                    }
+                });
+            }
+        }
+        
+        template<typename ValueType>
+        void InternalAdd<DdType::Sylvan, ValueType>::getMatrixSuccessors(MTBDD dd, uint_fast64_t currentLevel, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, MTBDD (&successors)[4]) {
+            if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+                successors[0] = successors[1] = successors[2] = successors[3] = dd;
+            } else if (ddRowVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+                successors[0] = successors[2] = mtbdd_getlow(dd);
+                successors[1] = successors[3] = mtbdd_gethigh(dd);
+            } else {
+                MTBDD elseNode = mtbdd_getlow(dd);
+                if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(elseNode)) {
+                    successors[0] = successors[1] = elseNode;
+                } else {
+                    successors[0] = mtbdd_getlow(elseNode);
+                    successors[1] = mtbdd_gethigh(elseNode);
+                }
+                
+                MTBDD thenNode = mtbdd_gethigh(dd);
+                if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(thenNode)) {
+                    successors[2] = successors[3] = thenNode;
+                } else {
+                    successors[2] = mtbdd_getlow(thenNode);
+                    successors[3] = mtbdd_gethigh(thenNode);
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void InternalAdd<DdType::Sylvan, ValueType>::collectMatrixComponentsTasksRec(MTBDD dd, bool negated, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentPartition, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, std::vector<std::vector<MatrixComponentsTask>>& tasks) const {
+            // For the empty DD, we do not need to add any entries.
+            if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
+                return;
+            }
+            
+            if (currentLevel == splitLevel) {
+                tasks[currentPartition].push_back(MatrixComponentsTask{dd, negated, &rowOdd, &columnOdd, currentLevel, currentRowOffset, currentColumnOffset});
+            } else {
+                MTBDD successors[4];
+                getMatrixSuccessors(dd, currentLevel, ddRowVariableIndices, ddColumnVariableIndices, successors);
+                
+                // The partitions are extended by the value of the row variable, so the rows of the then-successors end
+                // up in different partitions than the ones of the else-successors.
+                uint_fast64_t elsePartition = currentPartition << 1;
+                uint_fast64_t thenPartition = elsePartition | 1;
+                collectMatrixComponentsTasksRec(mtbdd_regular(successors[0]), mtbdd_hascomp(successors[0]) ^ negated, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, elsePartition, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                collectMatrixComponentsTasksRec(mtbdd_regular(successors[1]), mtbdd_hascomp(successors[1]) ^ negated, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, elsePartition, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                collectMatrixComponentsTasksRec(mtbdd_regular(successors[2]), mtbdd_hascomp(successors[2]) ^ negated, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, thenPartition, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                collectMatrixComponentsTasksRec(mtbdd_regular(successors[3]), mtbdd_hascomp(successors[3]) ^ negated, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, thenPartition, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, tasks);
+            }
         }
         
         template<typename ValueType>
@@ -751,42 +827,17 @@ namespace storm {
                 }
                 ++rowIndications[rowGroupOffsets[currentRowOffset]];
             } else {
-                MTBDD elseElse;
-                MTBDD elseThen;
-                MTBDD thenElse;
-                MTBDD thenThen;
-                
-                if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-                    elseElse = elseThen = thenElse = thenThen = dd;
-                } else if (ddRowVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-                    elseElse = thenElse = mtbdd_getlow(dd);
-                    elseThen = thenThen = mtbdd_gethigh(dd);
-                } else {
-                    MTBDD elseNode = mtbdd_getlow(dd);
-                    if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(elseNode)) {
-                        elseElse = elseThen = elseNode;
-                    } else {
-                        elseElse = mtbdd_getlow(elseNode);
-                        elseThen = mtbdd_gethigh(elseNode);
-                    }
-                    
-                    MTBDD thenNode = mtbdd_gethigh(dd);
-                    if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(thenNode)) {
-                        thenElse = thenThen = thenNode;
-                    } else {
-                        thenElse = mtbdd_getlow(thenNode);
-                        thenThen = mtbdd_gethigh(thenNode);
-                    }
-                }
+                MTBDD successors[4];
+                getMatrixSuccessors(dd, currentColumnLevel, ddRowVariableIndices, ddColumnVariableIndices, successors);
                 
                 // Visit else-else.
-                toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(mtbdd_regular(successors[0]), mtbdd_hascomp(successors[0]) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
                 // Visit else-then.
-                toMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(mtbdd_regular(successors[1]), mtbdd_hascomp(successors[1]) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
                 // Visit then-else.
-                toMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(mtbdd_regular(successors[2]), mtbdd_hascomp(successors[2]) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
                 // Visit then-then.
-                toMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                toMatrixComponentsRec(mtbdd_regular(successors[3]), mtbdd_hascomp(successors[3]) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
             }
         }
         
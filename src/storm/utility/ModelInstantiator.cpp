@@ -133,10 +133,11 @@ namespace storm {
             
             template<typename ParametricSparseModelType, typename ConstantSparseModelType>
             ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(std::map<VariableType, CoefficientType>const& valuation){
-                //Write results into the placeholders
+                //Write results into the placeholders. Many functions share their numerator or denominator, so we evaluate each of them only once.
+                std::unordered_map<typename storm::utility::parametric::PolynomialType<ParametricType>::type, CoefficientType> polynomialValues;
                 for(auto& functionResult : this->functions){
                     functionResult.second=storm::utility::convertNumber<ConstantType>(
-                            storm::utility::parametric::evaluate(functionResult.first, valuation));
+                            storm::utility::parametric::evaluate(functionResult.first, valuation, polynomialValues));
                 }
                 
                 //Write the instantiated values to the matrices and vectors according to the stored mappings
@@ -147,6 +148,9 @@ namespace storm {
                     *(entryValuePair.first)=*(entryValuePair.second);
                 }
                 
+                // The backward transitions and qualitative results of the previous instantiation are no longer valid.
+                this->instantiatedModel->invalidateCaches();
+                
                 return *this->instantiatedModel;
             }
         
@@ -0,0 +1,93 @@
+#include "storm/utility/OperationCache.h"
+
+#include <algorithm>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/utility/constants.h"
+
+namespace storm {
+    namespace utility {
+
+        template<typename ValueType>
+        ValueType OperationCache<ValueType>::multiply(ValueType const& first, ValueType const& second) {
+            return storm::utility::simplify((ValueType) (first * second));
+        }
+
+        template<typename ValueType>
+        ValueType OperationCache<ValueType>::add(ValueType const& first, ValueType const& second) {
+            return storm::utility::simplify((ValueType) (first + second));
+        }
+
+        template<typename ValueType>
+        ValueType OperationCache<ValueType>::inverseOfOneMinus(ValueType const& value) {
+            return storm::utility::simplify((ValueType) (storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - value)));
+        }
+
+#ifdef STORM_HAVE_CARL
+        const uint_fast64_t OperationCache<storm::RationalFunction>::DEFAULT_NUMBER_OF_SLOTS;
+
+        OperationCache<storm::RationalFunction>::OperationCache(uint_fast64_t numberOfSlots) : numberOfLookups(0), numberOfHits(0) {
+            uint_fast64_t roundedNumberOfSlots = 1;
+            while (roundedNumberOfSlots < numberOfSlots) {
+                roundedNumberOfSlots <<= 1;
+            }
+            slotMask = roundedNumberOfSlots - 1;
+        }
+
+        template<typename ComputeFunction>
+        storm::RationalFunction const& OperationCache<storm::RationalFunction>::lookup(OperationType operation, storm::RationalFunction const& first, storm::RationalFunction const& second, ComputeFunction const& computeResult) {
+            ++numberOfLookups;
+            if (slots.empty()) {
+                slots.resize(slotMask + 1);
+            }
+
+            // Both supported binary operations are commutative, so we identify them independently of the order of
+            // their operands.
+            boost::hash<storm::RationalFunction> hasher;
+            std::size_t firstHash = hasher(first);
+            std::size_t secondHash = hasher(second);
+            std::size_t hash = static_cast<std::size_t>(operation);
+            boost::hash_combine(hash, std::min(firstHash, secondHash));
+            boost::hash_combine(hash, std::max(firstHash, secondHash));
+
+            boost::optional<Entry>& slot = slots[hash & slotMask];
+            if (slot && slot->hash == hash && slot->operation == operation && ((slot->first == first && slot->second == second) || (slot->first == second && slot->second == first))) {
+                ++numberOfHits;
+                return slot->result;
+            }
+
+            slot = Entry{operation, hash, first, second, computeResult()};
+            return slot->result;
+        }
+
+        storm::RationalFunction OperationCache<storm::RationalFunction>::multiply(storm::RationalFunction const& first, storm::RationalFunction const& second) {
+            return lookup(OperationType::Multiply, first, second, [&first, &second] () { return storm::utility::simplify((storm::RationalFunction) (first * second)); });
+        }
+
+        storm::RationalFunction OperationCache<storm::RationalFunction>::add(storm::RationalFunction const& first, storm::RationalFunction const& second) {
+            return lookup(OperationType::Add, first, second, [&first, &second] () { return storm::utility::simplify((storm::RationalFunction) (first + second)); });
+        }
+
+        storm::RationalFunction OperationCache<storm::RationalFunction>::inverseOfOneMinus(storm::RationalFunction const& value) {
+            return lookup(OperationType::InverseOfOneMinus, value, value, [&value] () { return storm::utility::simplify((storm::RationalFunction) (storm::utility::one<storm::RationalFunction>() / (storm::utility::one<storm::RationalFunction>() - value))); });
+        }
+
+        uint_fast64_t OperationCache<storm::RationalFunction>::getNumberOfLookups() const {
+            return numberOfLookups;
+        }
+
+        uint_fast64_t OperationCache<storm::RationalFunction>::getNumberOfHits() const {
+            return numberOfHits;
+        }
+
+        void OperationCache<storm::RationalFunction>::clear() {
+            std::vector<boost::optional<Entry>>().swap(slots);
+        }
+
+        template class OperationCache<storm::RationalNumber>;
+#endif
+
+        template class OperationCache<double>;
+    }
+}
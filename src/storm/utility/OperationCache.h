@@ -0,0 +1,111 @@
+#ifndef STORM_UTILITY_OPERATIONCACHE_H_
+#define STORM_UTILITY_OPERATIONCACHE_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/adapters/CarlAdapter.h"
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * Performs the (simplifying) arithmetic operations of elimination-based procedures. In general, the results
+         * are simply computed, but for value types whose arithmetic is expensive, the class is specialized to reuse
+         * the results of previous operations.
+         */
+        template<typename ValueType>
+        class OperationCache {
+        public:
+            // This needs to be in here, otherwise the template specializations are not used properly.
+            OperationCache() = default;
+
+            /*!
+             * Retrieves the simplified product of the given values.
+             */
+            ValueType multiply(ValueType const& first, ValueType const& second);
+
+            /*!
+             * Retrieves the simplified sum of the given values.
+             */
+            ValueType add(ValueType const& first, ValueType const& second);
+
+            /*!
+             * Retrieves the simplified value of 1 / (1 - value).
+             */
+            ValueType inverseOfOneMinus(ValueType const& value);
+        };
+
+#ifdef STORM_HAVE_CARL
+        // For rational functions, every operation involves expensive polynomial arithmetic and gcd computations. Since
+        // elimination tends to combine the same functions over and over again, we store the results of recent
+        // operations in a direct-mapped cache of bounded size.
+        template<>
+        class OperationCache<storm::RationalFunction> {
+        public:
+            // The number of results stored by caches for which no other number is given.
+            static const uint_fast64_t DEFAULT_NUMBER_OF_SLOTS = 4096;
+
+            /*!
+             * Creates an empty cache.
+             *
+             * @param numberOfSlots The maximal number of results that are stored. Is rounded up to a power of two.
+             */
+            OperationCache(uint_fast64_t numberOfSlots = DEFAULT_NUMBER_OF_SLOTS);
+
+            storm::RationalFunction multiply(storm::RationalFunction const& first, storm::RationalFunction const& second);
+
+            storm::RationalFunction add(storm::RationalFunction const& first, storm::RationalFunction const& second);
+
+            storm::RationalFunction inverseOfOneMinus(storm::RationalFunction const& value);
+
+            /*!
+             * Retrieves the number of operations that were requested from the cache.
+             */
+            uint_fast64_t getNumberOfLookups() const;
+
+            /*!
+             * Retrieves the number of operations whose result was already stored.
+             */
+            uint_fast64_t getNumberOfHits() const;
+
+            /*!
+             * Removes all stored results.
+             */
+            void clear();
+
+        private:
+            enum class OperationType { Multiply, Add, InverseOfOneMinus };
+
+            struct Entry {
+                OperationType operation;
+                std::size_t hash;
+                storm::RationalFunction first;
+                storm::RationalFunction second;
+                storm::RationalFunction result;
+            };
+
+            /*!
+             * Retrieves the slot in which the result of the given operation is to be stored. If it does not hold the
+             * result of the given operation, it is overwritten with the result computed by the given function.
+             */
+            template<typename ComputeFunction>
+            storm::RationalFunction const& lookup(OperationType operation, storm::RationalFunction const& first, storm::RationalFunction const& second, ComputeFunction const& computeResult);
+
+            // A mask that maps hash values to slot indices.
+            uint_fast64_t slotMask;
+
+            // The stored results. The slots are only allocated upon the first lookup.
+            std::vector<boost::optional<Entry>> slots;
+
+            // Statistics about the usage of the cache.
+            uint_fast64_t numberOfLookups;
+            uint_fast64_t numberOfHits;
+        };
+#endif
+    }
+}
+
+#endif /* STORM_UTILITY_OPERATIONCACHE_H_ */
@@ -9,7 +9,7 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/DdManager.h"
 
-#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/CompactStronglyConnectedComponentDecomposition.h"
 
 #include "storm/models/symbolic/DeterministicModel.h"
 #include "storm/models/symbolic/NondeterministicModel.h"
@@ -21,14 +21,89 @@
 
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
+#include <algorithm>
+#include <atomic>
 #include <queue>
+#include <mutex>
 
 namespace storm {
     namespace utility {
         namespace graph {
             
+            namespace {
+                // The minimal number of states in a frontier for which the predecessors are explored in parallel.
+                std::atomic<uint_fast64_t> minimalParallelFrontierSize(1024);
+                
+                /*!
+                 * Performs a breadth-first search along the given backward transitions that starts from the reached
+                 * states. A predecessor of a frontier state is put into the next frontier if it is a constraint state
+                 * that was not yet reached and satisfies the given condition. As all candidates of a frontier are only
+                 * added to the reached states after the whole frontier was explored, the condition is evaluated w.r.t.
+                 * the states reached in at most as many steps as the frontier states. This way, the condition may be
+                 * evaluated concurrently and the frontier reached after n steps holds exactly the states that need n
+                 * steps.
+                 *
+                 * @param backwardTransitions The reversed transition relation of the graph structure to search.
+                 * @param constraintStates The states that may be added to the reached states.
+                 * @param reachedStates The states from which to start the search. Is extended by all states reached.
+                 * @param condition A function that decides whether a constraint state that is a predecessor of a
+                 * frontier state is to be reached. It may only depend on the states reached so far.
+                 * @param maximalSteps If given, the maximal number of steps to perform.
+                 */
+                template <typename T, typename ConditionType>
+                void performBackwardBreadthFirstSearch(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& constraintStates, storm::storage::BitVector& reachedStates, ConditionType const& condition, boost::optional<uint_fast64_t> const& maximalSteps = boost::none) {
+                    std::vector<uint_fast64_t> frontier(reachedStates.begin(), reachedStates.end());
+                    std::vector<uint_fast64_t> candidates;
+                    std::mutex candidatesMutex;
+                    bool parallel = storm::utility::parallel::isParallelismEnabled();
+                    uint_fast64_t minimalFrontierSize = minimalParallelFrontierSize.load();
+                    
+                    for (uint_fast64_t step = 0; !frontier.empty() && (!maximalSteps || step < maximalSteps.get()); ++step) {
+                        auto exploreFrontier = [&] (uint_fast64_t begin, uint_fast64_t end) {
+                            std::vector<uint_fast64_t> newCandidates;
+                            for (uint_fast64_t position = begin; position < end; ++position) {
+                                for (auto const& entry : backwardTransitions.getRow(frontier[position])) {
+                                    uint_fast64_t predecessor = entry.getColumn();
+                                    if (constraintStates.get(predecessor) && !reachedStates.get(predecessor) && condition(predecessor)) {
+                                        newCandidates.push_back(predecessor);
+                                    }
+                                }
+                            }
+                            std::lock_guard<std::mutex> lock(candidatesMutex);
+                            candidates.insert(candidates.end(), newCandidates.begin(), newCandidates.end());
+                        };
+                        
+                        if (parallel && frontier.size() >= minimalFrontierSize) {
+                            storm::utility::parallel::parallelFor(0, frontier.size(), exploreFrontier, std::max<uint_fast64_t>(1, minimalFrontierSize / 4));
+                        } else {
+                            exploreFrontier(0, frontier.size());
+                        }
+                        
+                        // A state may have been found from several frontier states, so we only keep its first occurrence.
+                        frontier.clear();
+                        for (auto candidate : candidates) {
+                            if (!reachedStates.get(candidate)) {
+                                reachedStates.set(candidate);
+                                frontier.push_back(candidate);
+                            }
+                        }
+                        candidates.clear();
+                    }
+                }
+            }
+            
+            void setMinimalParallelFrontierSize(uint_fast64_t size) {
+                STORM_LOG_THROW(size > 0, storm::exceptions::InvalidArgumentException, "The minimal size of frontiers that are explored in parallel must be positive.");
+                minimalParallelFrontierSize.store(size);
+            }
+            
+            uint_fast64_t getMinimalParallelFrontierSize() {
+                return minimalParallelFrontierSize.load();
+            }
+            
             template<typename T>
             storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps) {
                 storm::storage::BitVector reachableStates(initialStates);
@@ -92,11 +167,13 @@ namespace storm {
             template<typename T>
             storm::storage::BitVector getBsccCover(storm::storage::SparseMatrix<T> const& transitionMatrix) {
                 storm::storage::BitVector result(transitionMatrix.getRowGroupCount());
-                storm::storage::StronglyConnectedComponentDecomposition<T> decomposition(transitionMatrix, false, true);
+                storm::storage::CompactStronglyConnectedComponentDecomposition<T> decomposition(transitionMatrix);
                 
                 // Take the first state out of each BSCC.
-                for (auto const& scc : decomposition) {
-                    result.set(*scc.begin());
+                for (uint_fast64_t scc = 0; scc < decomposition.getNumberOfSccs(); ++scc) {
+                    if (decomposition.isBottom(scc)) {
+                        result.set(*decomposition.begin(scc));
+                    }
                 }
                 
                 return result;
@@ -137,58 +214,9 @@ namespace storm {
             
             template <typename T>
             storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
-                // Prepare the resulting bit vector.
-                uint_fast64_t numberOfStates = phiStates.size();
-                storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
-                
-                // Add all psi states as they already satisfy the condition.
-                statesWithProbabilityGreater0 |= psiStates;
-                
-                // Initialize the stack used for the DFS with the states.
-                std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
-                
-                // Initialize the stack for the step bound, if the number of steps is bounded.
-                std::vector<uint_fast64_t> stepStack;
-                std::vector<uint_fast64_t> remainingSteps;
-                if (useStepBound) {
-                    stepStack.reserve(numberOfStates);
-                    stepStack.insert(stepStack.begin(), psiStates.getNumberOfSetBits(), maximalSteps);
-                    remainingSteps.resize(numberOfStates);
-                    for (auto state : psiStates) {
-                        remainingSteps[state] = maximalSteps;
-                    }
-                }
-                
-                // Perform the actual DFS.
-                uint_fast64_t currentState, currentStepBound;
-                while (!stack.empty()) {
-                    currentState = stack.back();
-                    stack.pop_back();
-                    
-                    if (useStepBound) {
-                        currentStepBound = stepStack.back();
-                        stepStack.pop_back();
-                    }
-                    
-                    for (typename storm::storage::SparseMatrix<T>::const_iterator entryIt = backwardTransitions.begin(currentState), entryIte = backwardTransitions.end(currentState); entryIt != entryIte; ++entryIt) {
-                        if (phiStates[entryIt->getColumn()] && (!statesWithProbabilityGreater0.get(entryIt->getColumn()) && (!useStepBound || remainingSteps[entryIt->getColumn()] < currentStepBound))) {
-                            statesWithProbabilityGreater0.set(entryIt->getColumn(), true);
-
-                            // If we don't have a bound on the number of steps to take, just add the state to the stack.
-                            if (useStepBound) {
-                                // If there is at least one more step to go, we need to push the state and the new number of steps.
-                                remainingSteps[entryIt->getColumn()] = currentStepBound - 1;
-                                stepStack.push_back(currentStepBound - 1);
-                                if (currentStepBound == 0) {
-                                    continue;
-                                }
-                            }
-                            stack.push_back(entryIt->getColumn());
-                        }
-                    }
-                }
-                
-                // Return result.
+                // All psi states already satisfy the condition and every phi state that can reach one of them does so, too.
+                storm::storage::BitVector statesWithProbabilityGreater0(psiStates);
+                performBackwardBreadthFirstSearch(backwardTransitions, phiStates, statesWithProbabilityGreater0, [] (uint_fast64_t) { return true; }, useStepBound ? boost::make_optional(maximalSteps) : boost::none);
                 return statesWithProbabilityGreater0;
             }
             
@@ -209,12 +237,7 @@ namespace storm {
             
             template <typename T>
             std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::models::sparse::DeterministicModel<T> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
-                std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
-                storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
-                result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
-                result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
-                result.first.complement();
-                return result;
+                return model.getQualitativeResultCache().getOrCompute(storm::storage::QualitativeResultCache::QueryType::Prob01, phiStates, psiStates, [&] () { return performProb01(model.getBackwardTransitions(), phiStates, psiStates); });
             }
             
             template <typename T>
@@ -426,58 +449,9 @@ namespace storm {
             
             template <typename T>
             storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
-                size_t numberOfStates = phiStates.size();
-                
-                // Prepare resulting bit vector.
-                storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
-                
-                // Add all psi states as the already satisfy the condition.
-                statesWithProbabilityGreater0 |= psiStates;
-                
-                // Initialize the stack used for the DFS with the states
-                std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
-                
-                // Initialize the stack for the step bound, if the number of steps is bounded.
-                std::vector<uint_fast64_t> stepStack;
-                std::vector<uint_fast64_t> remainingSteps;
-                if (useStepBound) {
-                    stepStack.reserve(numberOfStates);
-                    stepStack.insert(stepStack.begin(), psiStates.getNumberOfSetBits(), maximalSteps);
-                    remainingSteps.resize(numberOfStates);
-                    for (auto state : psiStates) {
-                        remainingSteps[state] = maximalSteps;
-                    }
-                }
-                
-                // Perform the actual DFS.
-                uint_fast64_t currentState, currentStepBound;
-                while (!stack.empty()) {
-                    currentState = stack.back();
-                    stack.pop_back();
-                    
-                    if (useStepBound) {
-                        currentStepBound = stepStack.back();
-                        stepStack.pop_back();
-                    }
-                    
-                    for (typename storm::storage::SparseMatrix<T>::const_iterator entryIt = backwardTransitions.begin(currentState), entryIte = backwardTransitions.end(currentState); entryIt != entryIte; ++entryIt) {
-                        if (phiStates.get(entryIt->getColumn()) && (!statesWithProbabilityGreater0.get(entryIt->getColumn()) && (!useStepBound || remainingSteps[entryIt->getColumn()] < currentStepBound))) {
-                            // If we don't have a bound on the number of steps to take, just add the state to the stack.
-                            if (useStepBound) {
-                                // If there is at least one more step to go, we need to push the state and the new number of steps.
-                                remainingSteps[entryIt->getColumn()] = currentStepBound - 1;
-                                stepStack.push_back(currentStepBound - 1);
-                                
-                                if (currentStepBound == 0) {
-                                    continue;
-                                }
-                            }
-                            statesWithProbabilityGreater0.set(entryIt->getColumn(), true);
-                            stack.push_back(entryIt->getColumn());
-                        }
-                    }
-                }
-                
+                // As it suffices that one of the choices reaches a psi state, this is a plain backward search.
+                storm::storage::BitVector statesWithProbabilityGreater0(psiStates);
+                performBackwardBreadthFirstSearch(backwardTransitions, phiStates, statesWithProbabilityGreater0, [] (uint_fast64_t) { return true; }, useStepBound ? boost::make_optional(maximalSteps) : boost::none);
                 return statesWithProbabilityGreater0;
             }
             
@@ -494,49 +468,35 @@ namespace storm {
                 
                 // Initialize the environment for the iterative algorithm.
                 storm::storage::BitVector currentStates(numberOfStates, true);
-                std::vector<uint_fast64_t> stack;
-                stack.reserve(numberOfStates);
-                
-                // Perform the loop as long as the set of states gets larger.
-                bool done = false;
-                uint_fast64_t currentState;
-                while (!done) {
-                    stack.clear();
-                    storm::storage::BitVector nextStates(psiStates);
-                    stack.insert(stack.end(), psiStates.begin(), psiStates.end());
-                    
-                    while (!stack.empty()) {
-                        currentState = stack.back();
-                        stack.pop_back();
-                        
-                        for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-                            if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
-                                // Check whether the predecessor has only successors in the current state set for one of the
-                                // nondeterminstic choices.
-                                for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()]; row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
-                                    bool allSuccessorsInCurrentStates = true;
-                                    bool hasNextStateSuccessor = false;
-                                    for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                                        if (!currentStates.get(successorEntryIt->getColumn())) {
-                                            allSuccessorsInCurrentStates = false;
-                                            break;
-                                        } else if (nextStates.get(successorEntryIt->getColumn())) {
-                                            hasNextStateSuccessor = true;
-                                        }
-                                    }
-                                    
-                                    // If all successors for a given nondeterministic choice are in the current state set, we
-                                    // add it to the set of states for the next iteration and perform a backward search from
-                                    // that state.
-                                    if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
-                                        nextStates.set(predecessorEntryIt->getColumn(), true);
-                                        stack.push_back(predecessorEntryIt->getColumn());
-                                        break;
-                                    }
-                                }
+                storm::storage::BitVector nextStates;
+                
+                // Checks whether the state has a nondeterministic choice whose successors are all in the current state
+                // set and that has a successor in the next state set.
+                auto hasChoiceToNextStates = [&] (uint_fast64_t state) {
+                    for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                        bool allSuccessorsInCurrentStates = true;
+                        bool hasNextStateSuccessor = false;
+                        for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                            if (!currentStates.get(successorEntry.getColumn())) {
+                                allSuccessorsInCurrentStates = false;
+                                break;
+                            } else if (nextStates.get(successorEntry.getColumn())) {
+                                hasNextStateSuccessor = true;
                             }
                         }
+                        
+                        if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
+                            return true;
+                        }
                     }
+                    return false;
+                };
+                
+                // Perform the loop as long as the set of states gets smaller.
+                bool done = false;
+                while (!done) {
+                    nextStates = psiStates;
+                    performBackwardBreadthFirstSearch(backwardTransitions, phiStates, nextStates, hasChoiceToNextStates);
                     
                     // Check whether we need to perform an additional iteration.
                     if (currentStates == nextStates) {
@@ -565,84 +525,34 @@ namespace storm {
             
             template <typename T, typename RM>
             std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
-                return performProb01Max(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitions(), phiStates, psiStates);
+                return model.getQualitativeResultCache().getOrCompute(storm::storage::QualitativeResultCache::QueryType::Prob01Max, phiStates, psiStates, [&] () { return performProb01Max(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitions(), phiStates, psiStates); });
             }
             
             template <typename T>
             storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
-                size_t numberOfStates = phiStates.size();
-                
-                // Prepare resulting bit vector.
-                storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
-                
-                // Add all psi states as the already satisfy the condition.
-                statesWithProbabilityGreater0 |= psiStates;
-                
-                // Initialize the stack used for the DFS with the states
-                std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
-                
-                // Initialize the stack for the step bound, if the number of steps is bounded.
-                std::vector<uint_fast64_t> stepStack;
-                std::vector<uint_fast64_t> remainingSteps;
-                if (useStepBound) {
-                    stepStack.reserve(numberOfStates);
-                    stepStack.insert(stepStack.begin(), psiStates.getNumberOfSetBits(), maximalSteps);
-                    remainingSteps.resize(numberOfStates);
-                    for (auto state : psiStates) {
-                        remainingSteps[state] = maximalSteps;
-                    }
-                }
-                
-                // Perform the actual DFS.
-                uint_fast64_t currentState, currentStepBound;
-                while(!stack.empty()) {
-                    currentState = stack.back();
-                    stack.pop_back();
-                    
-                    if (useStepBound) {
-                        currentStepBound = stepStack.back();
-                        stepStack.pop_back();
-                    }
-                    
-                    for(typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-                        if (phiStates.get(predecessorEntryIt->getColumn()) && (!statesWithProbabilityGreater0.get(predecessorEntryIt->getColumn()) && (!useStepBound || remainingSteps[predecessorEntryIt->getColumn()] < currentStepBound))) {
-                            // Check whether the predecessor has at least one successor in the current state set for every
-                            // nondeterministic choice.
-                            bool addToStatesWithProbabilityGreater0 = true;
-                            for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()]; row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
-                                bool hasAtLeastOneSuccessorWithProbabilityGreater0 = false;
-                                for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                                    if (statesWithProbabilityGreater0.get(successorEntryIt->getColumn())) {
-                                        hasAtLeastOneSuccessorWithProbabilityGreater0 = true;
-                                        break;
-                                    }
-                                }
-                                
-                                if (!hasAtLeastOneSuccessorWithProbabilityGreater0) {
-                                    addToStatesWithProbabilityGreater0 = false;
-                                    break;
-                                }
-                            }
-                            
-                            // If we need to add the state, then actually add it and perform further search from the state.
-                            if (addToStatesWithProbabilityGreater0) {
-                                // If we don't have a bound on the number of steps to take, just add the state to the stack.
-                                if (useStepBound) {
-                                    // If there is at least one more step to go, we need to push the state and the new number of steps.
-                                    remainingSteps[predecessorEntryIt->getColumn()] = currentStepBound - 1;
-                                    stepStack.push_back(currentStepBound - 1);
-                                    
-                                    if (currentStepBound == 0) {
-                                        continue;
-                                    }
-                                }
-                                statesWithProbabilityGreater0.set(predecessorEntryIt->getColumn(), true);
-                                stack.push_back(predecessorEntryIt->getColumn());
+                // Add all psi states as they already satisfy the condition.
+                storm::storage::BitVector statesWithProbabilityGreater0(psiStates);
+                
+                // Checks whether the state has at least one successor in the current state set for every
+                // nondeterministic choice.
+                auto allChoicesHaveSuccessorWithProbabilityGreater0 = [&] (uint_fast64_t state) {
+                    for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                        bool hasAtLeastOneSuccessorWithProbabilityGreater0 = false;
+                        for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                            if (statesWithProbabilityGreater0.get(successorEntry.getColumn())) {
+                                hasAtLeastOneSuccessorWithProbabilityGreater0 = true;
+                                break;
                             }
                         }
+                        
+                        if (!hasAtLeastOneSuccessorWithProbabilityGreater0) {
+                            return false;
+                        }
                     }
-                }
+                    return true;
+                };
                 
+                performBackwardBreadthFirstSearch(backwardTransitions, phiStates, statesWithProbabilityGreater0, allChoicesHaveSuccessorWithProbabilityGreater0, useStepBound ? boost::make_optional(maximalSteps) : boost::none);
                 return statesWithProbabilityGreater0;
             }
             
@@ -671,56 +581,34 @@ namespace storm {
                 
                 // Initialize the environment for the iterative algorithm.
                 storm::storage::BitVector currentStates(numberOfStates, true);
-                std::vector<uint_fast64_t> stack;
-                stack.reserve(numberOfStates);
+                storm::storage::BitVector nextStates;
+                
+                // Checks whether the state has only successors in the current state set for all of the nondeterministic
+                // choices and that for each choice there exists a successor that is already in the next states.
+                auto allChoicesLeadToNextStates = [&] (uint_fast64_t state) {
+                    for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                        bool hasAtLeastOneSuccessorWithProbability1 = false;
+                        for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                            if (!currentStates.get(successorEntry.getColumn())) {
+                                return false;
+                            }
+                            if (nextStates.get(successorEntry.getColumn())) {
+                                hasAtLeastOneSuccessorWithProbability1 = true;
+                            }
+                        }
+                        
+                        if (!hasAtLeastOneSuccessorWithProbability1) {
+                            return false;
+                        }
+                    }
+                    return true;
+                };
                 
                 // Perform the loop as long as the set of states gets smaller.
                 bool done = false;
-                uint_fast64_t currentState;
                 while (!done) {
-                    stack.clear();
-                    storm::storage::BitVector nextStates(psiStates);
-                    stack.insert(stack.end(), psiStates.begin(), psiStates.end());
-                    
-                    while (!stack.empty()) {
-                        currentState = stack.back();
-                        stack.pop_back();
-                        
-                        for(typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-                            if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
-                                // Check whether the predecessor has only successors in the current state set for all of the
-                                // nondeterminstic choices and that for each choice there exists a successor that is already
-                                // in the next states.
-                                bool addToStatesWithProbability1 = true;
-                                for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()]; row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
-                                    bool hasAtLeastOneSuccessorWithProbability1 = false;
-                                    for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                                        if (!currentStates.get(successorEntryIt->getColumn())) {
-                                            addToStatesWithProbability1 = false;
-                                            goto afterCheckLoop;
-                                        }
-                                        if (nextStates.get(successorEntryIt->getColumn())) {
-                                            hasAtLeastOneSuccessorWithProbability1 = true;
-                                        }
-                                    }
-                                    
-                                    if (!hasAtLeastOneSuccessorWithProbability1) {
-                                        addToStatesWithProbability1 = false;
-                                        break;
-                                    }
-                                }
-                                
-                            afterCheckLoop:
-                                // If all successors for all nondeterministic choices are in the current state set, we
-                                // add it to the set of states for the next iteration and perform a backward search from
-                                // that state.
-                                if (addToStatesWithProbability1) {
-                                    nextStates.set(predecessorEntryIt->getColumn(), true);
-                                    stack.push_back(predecessorEntryIt->getColumn());
-                                }
-                            }
-                        }
-                    }
+                    nextStates = psiStates;
+                    performBackwardBreadthFirstSearch(backwardTransitions, phiStates, nextStates, allChoicesLeadToNextStates);
                     
                     // Check whether we need to perform an additional iteration.
                     if (currentStates == nextStates) {
@@ -742,7 +630,7 @@ namespace storm {
             
             template <typename T, typename RM>
             std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::models::sparse::NondeterministicModel<T, RM> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
-                return performProb01Min(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitions(), phiStates, psiStates);
+                return model.getQualitativeResultCache().getOrCompute(storm::storage::QualitativeResultCache::QueryType::Prob01Min, phiStates, psiStates, [&] () { return performProb01Min(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitions(), phiStates, psiStates); });
             }
             
             template <storm::dd::DdType Type, typename ValueType>
@@ -51,6 +51,19 @@ namespace storm {
     namespace utility {
         namespace graph {
             
+            /*!
+             * Sets the minimal number of states in a frontier of the backward searches of the qualitative analyses for
+             * which the predecessors are explored in parallel (if parallelism is enabled).
+             *
+             * @param size The minimal size of frontiers that are explored in parallel. Must be positive.
+             */
+            void setMinimalParallelFrontierSize(uint_fast64_t size);
+            
+            /*!
+             * Retrieves the minimal number of states in a frontier that is explored in parallel.
+             */
+            uint_fast64_t getMinimalParallelFrontierSize();
+            
             /*!
              * Performs a forward depth-first search through the underlying graph structure to identify the states that
              * are reachable from the given set only passing through a constrained set of states until some target
@@ -0,0 +1,193 @@
+#include "storm/utility/parallel.h"
+
+#include <memory>
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            namespace {
+                // A flag that is set for every thread that currently executes a task of a pool. This is used to avoid
+                // deadlocks when parallel kernels are nested.
+                thread_local bool insideParallelRegion = false;
+
+                // The configured number of threads. This is atomic, because it is read without holding the mutex below.
+                std::atomic<uint_fast64_t> configuredNumberOfThreads(1);
+
+                // The global pool and a mutex protecting its (re)creation.
+                std::unique_ptr<ThreadPool> globalThreadPool;
+                std::mutex globalThreadPoolMutex;
+            }
+
+            ThreadPool::ThreadPool(uint_fast64_t numberOfThreads) : currentTask(nullptr), currentNumberOfTasks(0), nextTaskIndex(0), round(0), busyWorkers(0), shutdown(false) {
+                STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "A thread pool needs at least one thread.");
+                for (uint_fast64_t i = 1; i < numberOfThreads; ++i) {
+                    workers.emplace_back(&ThreadPool::workerLoop, this);
+                }
+            }
+
+            ThreadPool::~ThreadPool() {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    shutdown = true;
+                }
+                workAvailable.notify_all();
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+            }
+
+            uint_fast64_t ThreadPool::getNumberOfThreads() const {
+                return workers.size() + 1;
+            }
+
+            void ThreadPool::execute(uint_fast64_t numberOfTasks, std::function<void (uint_fast64_t)> const& task) {
+                if (numberOfTasks == 0) {
+                    return;
+                }
+
+                // Nested invocations and pools without workers are executed by the calling thread.
+                if (insideParallelRegion || workers.empty() || numberOfTasks == 1) {
+                    for (uint_fast64_t index = 0; index < numberOfTasks; ++index) {
+                        task(index);
+                    }
+                    return;
+                }
+
+                std::unique_lock<std::mutex> executionLock(executionMutex);
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    currentTask = &task;
+                    currentNumberOfTasks = numberOfTasks;
+                    nextTaskIndex = 0;
+                    firstException = nullptr;
+                    busyWorkers = workers.size();
+                    ++round;
+                }
+                workAvailable.notify_all();
+
+                // The calling thread participates in the execution.
+                processTasks();
+
+                std::exception_ptr exception;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    workFinished.wait(lock, [this] { return busyWorkers == 0; });
+                    currentTask = nullptr;
+                    exception = firstException;
+                    firstException = nullptr;
+                }
+
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+
+            void ThreadPool::workerLoop() {
+                uint_fast64_t lastRound = 0;
+                while (true) {
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        workAvailable.wait(lock, [this, lastRound] { return shutdown || round != lastRound; });
+                        if (shutdown) {
+                            return;
+                        }
+                        lastRound = round;
+                    }
+
+                    processTasks();
+
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        --busyWorkers;
+                        if (busyWorkers == 0) {
+                            workFinished.notify_one();
+                        }
+                    }
+                }
+            }
+
+            void ThreadPool::processTasks() {
+                insideParallelRegion = true;
+                uint_fast64_t index = nextTaskIndex.fetch_add(1);
+                while (index < currentNumberOfTasks) {
+                    try {
+                        (*currentTask)(index);
+                    } catch (...) {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        if (!firstException) {
+                            firstException = std::current_exception();
+                        }
+                        // Prevent further tasks from being started.
+                        nextTaskIndex = currentNumberOfTasks;
+                    }
+                    index = nextTaskIndex.fetch_add(1);
+                }
+                insideParallelRegion = false;
+            }
+
+            void setNumberOfThreads(uint_fast64_t numberOfThreads) {
+                if (numberOfThreads == 0) {
+                    numberOfThreads = std::max<uint_fast64_t>(std::thread::hardware_concurrency(), 1);
+                }
+
+                std::unique_lock<std::mutex> lock(globalThreadPoolMutex);
+                if (numberOfThreads != configuredNumberOfThreads.load()) {
+                    configuredNumberOfThreads.store(numberOfThreads);
+                    globalThreadPool.reset();
+                }
+            }
+
+            uint_fast64_t getNumberOfThreads() {
+                return configuredNumberOfThreads.load();
+            }
+
+            bool isParallelismEnabled() {
+                return configuredNumberOfThreads.load() > 1;
+            }
+
+            ThreadPool& getThreadPool() {
+                std::unique_lock<std::mutex> lock(globalThreadPoolMutex);
+                if (!globalThreadPool) {
+                    globalThreadPool = std::make_unique<ThreadPool>(configuredNumberOfThreads.load());
+                }
+                return *globalThreadPool;
+            }
+
+            void parallelFor(uint_fast64_t begin, uint_fast64_t end, std::function<void (uint_fast64_t, uint_fast64_t)> const& body, uint_fast64_t minimalChunkSize) {
+                if (begin >= end) {
+                    return;
+                }
+
+                uint_fast64_t size = end - begin;
+                uint_fast64_t numberOfChunks = std::min(getNumberOfThreads(), std::max<uint_fast64_t>(size / std::max<uint_fast64_t>(minimalChunkSize, 1), 1));
+                if (numberOfChunks <= 1 || insideParallelRegion) {
+                    body(begin, end);
+                    return;
+                }
+
+                std::vector<uint_fast64_t> boundaries(numberOfChunks + 1);
+                for (uint_fast64_t chunk = 0; chunk <= numberOfChunks; ++chunk) {
+                    boundaries[chunk] = begin + (size * chunk) / numberOfChunks;
+                }
+                parallelForChunks(boundaries, body);
+            }
+
+            void parallelForChunks(std::vector<uint_fast64_t> const& boundaries, std::function<void (uint_fast64_t, uint_fast64_t)> const& body) {
+                if (boundaries.size() < 2) {
+                    return;
+                }
+                getThreadPool().execute(boundaries.size() - 1, [&] (uint_fast64_t chunk) {
+                    if (boundaries[chunk] < boundaries[chunk + 1]) {
+                        body(boundaries[chunk], boundaries[chunk + 1]);
+                    }
+                });
+            }
+
+        }
+    }
+}
@@ -0,0 +1,143 @@
+#ifndef STORM_UTILITY_PARALLEL_H_
+#define STORM_UTILITY_PARALLEL_H_
+
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            /*!
+             * A simple pool of worker threads that does not depend on any external library. The thread that submits
+             * work participates in its execution, so a pool for n threads only spawns n - 1 workers.
+             */
+            class ThreadPool {
+            public:
+                /*!
+                 * Creates a pool that executes work with the given number of threads (including the calling thread).
+                 *
+                 * @param numberOfThreads The number of threads to use. Must be at least one.
+                 */
+                ThreadPool(uint_fast64_t numberOfThreads);
+
+                ThreadPool(ThreadPool const& other) = delete;
+                ThreadPool& operator=(ThreadPool const& other) = delete;
+
+                ~ThreadPool();
+
+                /*!
+                 * Retrieves the number of threads that participate in the execution of submitted work.
+                 */
+                uint_fast64_t getNumberOfThreads() const;
+
+                /*!
+                 * Executes the given task for all indices in [0, numberOfTasks) and blocks until all of them are
+                 * finished. Tasks are handed out dynamically, so it is safe to submit more tasks than there are
+                 * threads. If this is called from within a task that is currently executed by the pool, all tasks are
+                 * executed sequentially by the calling thread. If a task throws, the first exception is rethrown after
+                 * all running tasks have finished.
+                 *
+                 * @param numberOfTasks The number of tasks.
+                 * @param task The task to execute for each index.
+                 */
+                void execute(uint_fast64_t numberOfTasks, std::function<void (uint_fast64_t)> const& task);
+
+            private:
+                /*!
+                 * The loop run by each worker thread.
+                 */
+                void workerLoop();
+
+                /*!
+                 * Executes tasks of the current round until there are no more tasks left.
+                 */
+                void processTasks();
+
+                // The worker threads.
+                std::vector<std::thread> workers;
+
+                // A mutex that serializes concurrent calls to execute.
+                std::mutex executionMutex;
+
+                // The mutex and condition variables used to synchronize the workers with the submitting thread.
+                std::mutex mutex;
+                std::condition_variable workAvailable;
+                std::condition_variable workFinished;
+
+                // The task of the current round and the number of its indices.
+                std::function<void (uint_fast64_t)> const* currentTask;
+                uint_fast64_t currentNumberOfTasks;
+
+                // The next index to hand out in the current round.
+                std::atomic<uint_fast64_t> nextTaskIndex;
+
+                // A counter that identifies the current round, so workers can detect new work.
+                uint_fast64_t round;
+
+                // The number of workers that have not yet finished the current round.
+                uint_fast64_t busyWorkers;
+
+                // The first exception that was raised by a task in the current round (if any).
+                std::exception_ptr firstException;
+
+                // A flag indicating that the workers are to terminate.
+                bool shutdown;
+            };
+
+            /*!
+             * Sets the number of threads that storm's built-in parallel kernels may use. A value of zero selects the
+             * number of hardware threads.
+             *
+             * @param numberOfThreads The number of threads to use.
+             */
+            void setNumberOfThreads(uint_fast64_t numberOfThreads);
+
+            /*!
+             * Retrieves the number of threads that storm's built-in parallel kernels may use.
+             */
+            uint_fast64_t getNumberOfThreads();
+
+            /*!
+             * Retrieves whether the built-in parallel kernels are enabled, i.e. whether more than one thread is to be
+             * used.
+             */
+            bool isParallelismEnabled();
+
+            /*!
+             * Retrieves the globally shared thread pool whose size matches the configured number of threads.
+             */
+            ThreadPool& getThreadPool();
+
+            /*!
+             * Splits the range [begin, end) into consecutive chunks and processes them concurrently on the global
+             * thread pool. If parallelism is disabled or the range is smaller than the given minimal chunk size, the
+             * whole range is processed by the calling thread.
+             *
+             * @param begin The first index of the range.
+             * @param end The index past the last index of the range.
+             * @param body The function to call for each chunk with its first and past-the-end index.
+             * @param minimalChunkSize The minimal number of indices a chunk needs to have.
+             */
+            void parallelFor(uint_fast64_t begin, uint_fast64_t end, std::function<void (uint_fast64_t, uint_fast64_t)> const& body, uint_fast64_t minimalChunkSize = 1024);
+
+            /*!
+             * Processes the chunks described by the given boundaries concurrently on the global thread pool, i.e.
+             * chunk i is [boundaries[i], boundaries[i + 1]).
+             *
+             * @param boundaries The boundaries of the chunks. Must be sorted.
+             * @param body The function to call for each chunk with its first and past-the-end index.
+             */
+            void parallelForChunks(std::vector<uint_fast64_t> const& boundaries, std::function<void (uint_fast64_t, uint_fast64_t)> const& body);
+
+        }
+    }
+}
+
+#endif /* STORM_UTILITY_PARALLEL_H_ */
@@ -29,6 +29,21 @@ namespace storm {
                 return function.evaluate(valuation);
             }
             
+            template<>
+            typename CoefficientType<storm::RationalFunction>::type evaluate<storm::RationalFunction>(storm::RationalFunction const& function, std::map<typename VariableType<storm::RationalFunction>::type, typename CoefficientType<storm::RationalFunction>::type> const& valuation, std::unordered_map<typename PolynomialType<storm::RationalFunction>::type, typename CoefficientType<storm::RationalFunction>::type>& polynomialValues) {
+                if (function.isConstant()) {
+                    return function.constantPart();
+                }
+                auto evaluatePolynomial = [&] (typename PolynomialType<storm::RationalFunction>::type const& polynomial) {
+                    auto polynomialValueIt = polynomialValues.find(polynomial);
+                    if (polynomialValueIt == polynomialValues.end()) {
+                        polynomialValueIt = polynomialValues.emplace(polynomial, storm::RationalFunction(polynomial).evaluate(valuation)).first;
+                    }
+                    return polynomialValueIt->second;
+                };
+                return evaluatePolynomial(function.nominator()) / evaluatePolynomial(function.denominator());
+            }
+            
             template<>
             typename CoefficientType<storm::RationalFunction>::type getConstantPart<storm::RationalFunction>(storm::RationalFunction const& function){
                 return function.constantPart();
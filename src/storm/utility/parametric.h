@@ -11,6 +11,7 @@
 #include "storm/adapters/CarlAdapter.h"
 
 #include <map>
+#include <unordered_map>
 
 namespace storm {
     namespace utility {
@@ -27,11 +28,19 @@ namespace storm {
             template<typename FunctionType>
             struct CoefficientType { typedef void type; };
             
+            /*!
+             * Acess the type of the numerators and denominators of a given function type
+             */
+            template<typename FunctionType>
+            struct PolynomialType { typedef void type; };
+            
 #ifdef STORM_HAVE_CARL
             template<>
             struct VariableType<storm::RationalFunction> { typedef storm::RationalFunctionVariable type; };
             template<>
             struct CoefficientType<storm::RationalFunction> { typedef storm::RationalNumber type; };
+            template<>
+            struct PolynomialType<storm::RationalFunction> { typedef storm::RationalFunction::PolyType type; };
 #endif
             
             /*!
@@ -40,6 +49,14 @@ namespace storm {
             template<typename FunctionType>
             typename CoefficientType<FunctionType>::type evaluate(FunctionType const& function, std::map<typename VariableType<FunctionType>::type, typename CoefficientType<FunctionType>::type> const& valuation);
             
+            /*!
+             * Evaluates the given function wrt. the given valuation. The values of its numerator and denominator are
+             * taken from the given map if they are contained and inserted otherwise, such that functions sharing a
+             * numerator or denominator only need to evaluate it once.
+             */
+            template<typename FunctionType>
+            typename CoefficientType<FunctionType>::type evaluate(FunctionType const& function, std::map<typename VariableType<FunctionType>::type, typename CoefficientType<FunctionType>::type> const& valuation, std::unordered_map<typename PolynomialType<FunctionType>::type, typename CoefficientType<FunctionType>::type>& polynomialValues);
+            
             /*!
              * Retrieves the constant part of the given function.
              */
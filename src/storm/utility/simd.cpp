@@ -0,0 +1,189 @@
+#include "storm/utility/simd.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_HAVE_X86_SIMD_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace storm {
+    namespace utility {
+        namespace simd {
+
+            namespace {
+                // The instruction set used by the kernels. By default, the vectorized kernels are disabled.
+                InstructionSet configuredInstructionSet = InstructionSet::None;
+
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+                // The kernels are compiled for the respective instruction set via target attributes, so the remaining
+                // code does not need to be compiled with these instruction sets enabled. Note that a function with a
+                // target attribute can only be inlined into functions with the same attribute, which is why every
+                // kernel comes with its own loop over the rows.
+
+                __attribute__((target("avx2,fma")))
+                inline double dotProductAvx2(uint32_t const* columns, double const* values, uint_fast64_t count, double const* vector) {
+                    __m256d sum = _mm256_setzero_pd();
+                    uint_fast64_t index = 0;
+                    for (; index + 4 <= count; index += 4) {
+                        __m128i columnIndices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + index));
+                        __m256d vectorValues = _mm256_i32gather_pd(vector, columnIndices, 8);
+                        sum = _mm256_fmadd_pd(_mm256_loadu_pd(values + index), vectorValues, sum);
+                    }
+                    __m128d halfSum = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+                    double result = _mm_cvtsd_f64(halfSum) + _mm_cvtsd_f64(_mm_unpackhi_pd(halfSum, halfSum));
+                    for (; index < count; ++index) {
+                        result += values[index] * vector[columns[index]];
+                    }
+                    return result;
+                }
+
+                __attribute__((target("avx512f")))
+                inline double dotProductAvx512(uint32_t const* columns, double const* values, uint_fast64_t count, double const* vector) {
+                    __m512d sum = _mm512_setzero_pd();
+                    uint_fast64_t index = 0;
+                    for (; index + 8 <= count; index += 8) {
+                        __m256i columnIndices = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + index));
+                        __m512d vectorValues = _mm512_i32gather_pd(columnIndices, vector, 8);
+                        sum = _mm512_fmadd_pd(_mm512_loadu_pd(values + index), vectorValues, sum);
+                    }
+                    double result = _mm512_reduce_add_pd(sum);
+                    for (; index < count; ++index) {
+                        result += values[index] * vector[columns[index]];
+                    }
+                    return result;
+                }
+
+                __attribute__((target("avx2,fma")))
+                void multiplyWithVectorAvx2(uint_fast64_t startRow, uint_fast64_t endRow, uint32_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result) {
+                    for (uint_fast64_t row = startRow; row < endRow; ++row) {
+                        uint_fast64_t first = rowIndications[row];
+                        double product = dotProductAvx2(columns + first, values + first, rowIndications[row + 1] - first, vector);
+                        result[row] = summand != nullptr ? summand[row] + product : product;
+                    }
+                }
+
+                __attribute__((target("avx512f")))
+                void multiplyWithVectorAvx512(uint_fast64_t startRow, uint_fast64_t endRow, uint32_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result) {
+                    for (uint_fast64_t row = startRow; row < endRow; ++row) {
+                        uint_fast64_t first = rowIndications[row];
+                        double product = dotProductAvx512(columns + first, values + first, rowIndications[row + 1] - first, vector);
+                        result[row] = summand != nullptr ? summand[row] + product : product;
+                    }
+                }
+
+                __attribute__((target("avx2,fma")))
+                void multiplyAndReduceAvx2(uint_fast64_t startGroup, uint_fast64_t endGroup, bool minimize, uint32_t const* rowGroupIndices, uint32_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result, uint_fast64_t* choices) {
+                    for (uint_fast64_t group = startGroup; group < endGroup; ++group) {
+                        double currentValue = 0;
+                        uint_fast64_t choice = 0;
+                        for (uint_fast64_t row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+                            uint_fast64_t first = rowIndications[row];
+                            double newValue = dotProductAvx2(columns + first, values + first, rowIndications[row + 1] - first, vector);
+                            if (summand != nullptr) {
+                                newValue += summand[row];
+                            }
+                            if (row == rowGroupIndices[group] || (minimize && newValue < currentValue) || (!minimize && newValue > currentValue)) {
+                                currentValue = newValue;
+                                choice = row - rowGroupIndices[group];
+                            }
+                        }
+                        result[group] = currentValue;
+                        if (choices != nullptr) {
+                            choices[group] = choice;
+                        }
+                    }
+                }
+
+                __attribute__((target("avx512f")))
+                void multiplyAndReduceAvx512(uint_fast64_t startGroup, uint_fast64_t endGroup, bool minimize, uint32_t const* rowGroupIndices, uint32_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result, uint_fast64_t* choices) {
+                    for (uint_fast64_t group = startGroup; group < endGroup; ++group) {
+                        double currentValue = 0;
+                        uint_fast64_t choice = 0;
+                        for (uint_fast64_t row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+                            uint_fast64_t first = rowIndications[row];
+                            double newValue = dotProductAvx512(columns + first, values + first, rowIndications[row + 1] - first, vector);
+                            if (summand != nullptr) {
+                                newValue += summand[row];
+                            }
+                            if (row == rowGroupIndices[group] || (minimize && newValue < currentValue) || (!minimize && newValue > currentValue)) {
+                                currentValue = newValue;
+                                choice = row - rowGroupIndices[group];
+                            }
+                        }
+                        result[group] = currentValue;
+                        if (choices != nullptr) {
+                            choices[group] = choice;
+                        }
+                    }
+                }
+#endif
+            }
+
+            std::string toString(InstructionSet const& instructionSet) {
+                switch (instructionSet) {
+                    case InstructionSet::None: return "none";
+                    case InstructionSet::Avx2: return "avx2";
+                    case InstructionSet::Avx512: return "avx512";
+                }
+                return "invalid";
+            }
+
+            InstructionSet getSupportedInstructionSet() {
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx512f")) {
+                    return InstructionSet::Avx512;
+                }
+                if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+                    return InstructionSet::Avx2;
+                }
+#endif
+                return InstructionSet::None;
+            }
+
+            void setInstructionSet(InstructionSet const& instructionSet) {
+                InstructionSet supportedInstructionSet = getSupportedInstructionSet();
+                bool supported = instructionSet == InstructionSet::None || instructionSet == supportedInstructionSet || (instructionSet == InstructionSet::Avx2 && supportedInstructionSet == InstructionSet::Avx512);
+                STORM_LOG_THROW(supported, storm::exceptions::NotSupportedException, "The instruction set '" << toString(instructionSet) << "' is not supported on this machine.");
+                configuredInstructionSet = instructionSet;
+            }
+
+            InstructionSet getInstructionSet() {
+                return configuredInstructionSet;
+            }
+
+            bool dotProduct(uint32_t const* columns, double const* values, uint_fast64_t count, double const* vector, double& result) {
+                switch (configuredInstructionSet) {
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+                    case InstructionSet::Avx2: result = dotProductAvx2(columns, values, count, vector); return true;
+                    case InstructionSet::Avx512: result = dotProductAvx512(columns, values, count, vector); return true;
+#endif
+                    default: return false;
+                }
+            }
+
+            bool multiplyWithVector(uint_fast64_t startRow, uint_fast64_t endRow, uint32_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result) {
+                switch (configuredInstructionSet) {
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+                    case InstructionSet::Avx2: multiplyWithVectorAvx2(startRow, endRow, rowIndications, columns, values, vector, summand, result); return true;
+                    case InstructionSet::Avx512: multiplyWithVectorAvx512(startRow, endRow, rowIndications, columns, values, vector, summand, result); return true;
+#endif
+                    default: return false;
+                }
+            }
+
+            bool multiplyAndReduce(uint_fast64_t startGroup, uint_fast64_t endGroup, bool minimize, uint32_t const* rowGroupIndices, uint32_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result, uint_fast64_t* choices) {
+                switch (configuredInstructionSet) {
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+                    case InstructionSet::Avx2: multiplyAndReduceAvx2(startGroup, endGroup, minimize, rowGroupIndices, rowIndications, columns, values, vector, summand, result, choices); return true;
+                    case InstructionSet::Avx512: multiplyAndReduceAvx512(startGroup, endGroup, minimize, rowGroupIndices, rowIndications, columns, values, vector, summand, result, choices); return true;
+#endif
+                    default: return false;
+                }
+            }
+
+        }
+    }
+}
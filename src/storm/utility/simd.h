@@ -0,0 +1,115 @@
+#ifndef STORM_UTILITY_SIMD_H_
+#define STORM_UTILITY_SIMD_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+
+namespace storm {
+    namespace utility {
+        namespace simd {
+
+            /*!
+             * The vector instruction sets for which storm provides numerical kernels.
+             */
+            enum class InstructionSet {
+                None, Avx2, Avx512
+            };
+
+            std::string toString(InstructionSet const& instructionSet);
+
+            /*!
+             * Retrieves the most powerful instruction set that is supported by both the processor and this build.
+             */
+            InstructionSet getSupportedInstructionSet();
+
+            /*!
+             * Sets the instruction set that the vectorized kernels are to use. Setting it to None disables the
+             * vectorized kernels.
+             *
+             * @param instructionSet The instruction set to use. It must be supported (see getSupportedInstructionSet).
+             */
+            void setInstructionSet(InstructionSet const& instructionSet);
+
+            /*!
+             * Retrieves the instruction set that the vectorized kernels use.
+             */
+            InstructionSet getInstructionSet();
+
+            /*!
+             * An allocator that aligns the storage to the given number of bytes (a power of two), so that arrays
+             * processed by the vectorized kernels start at the boundary of a cache line.
+             */
+            template<typename T, std::size_t Alignment = 64>
+            class AlignedAllocator {
+            public:
+                typedef T value_type;
+
+                template<typename U>
+                struct rebind {
+                    typedef AlignedAllocator<U, Alignment> other;
+                };
+
+                AlignedAllocator() = default;
+
+                template<typename U>
+                AlignedAllocator(AlignedAllocator<U, Alignment> const&) {
+                    // Intentionally left empty.
+                }
+
+                T* allocate(std::size_t n) {
+                    // We allocate enough memory to move the pointer to the next aligned address and store the pointer
+                    // to the allocated memory right in front of it.
+                    void* memory = ::operator new(n * sizeof(T) + Alignment + sizeof(void*));
+                    std::uintptr_t alignedAddress = (reinterpret_cast<std::uintptr_t>(memory) + sizeof(void*) + Alignment - 1) & ~static_cast<std::uintptr_t>(Alignment - 1);
+                    reinterpret_cast<void**>(alignedAddress)[-1] = memory;
+                    return reinterpret_cast<T*>(alignedAddress);
+                }
+
+                void deallocate(T* pointer, std::size_t) {
+                    ::operator delete(reinterpret_cast<void**>(pointer)[-1]);
+                }
+            };
+
+            template<typename T, typename U, std::size_t Alignment>
+            bool operator==(AlignedAllocator<T, Alignment> const&, AlignedAllocator<U, Alignment> const&) {
+                return true;
+            }
+
+            template<typename T, typename U, std::size_t Alignment>
+            bool operator!=(AlignedAllocator<T, Alignment> const&, AlignedAllocator<U, Alignment> const&) {
+                return false;
+            }
+
+            /*!
+             * Computes sum_j values[j] * vector[columns[j]] for the given number of entries and writes it to result.
+             * All columns must be smaller than 2^31.
+             *
+             * @return True iff the kernel was applied, i.e. false if no instruction set is selected.
+             */
+            bool dotProduct(uint32_t const* columns, double const* values, uint_fast64_t count, double const* vector, double& result);
+
+            /*!
+             * Computes result[row] = summand[row] + sum_j values[j] * vector[columns[j]] for all rows in the given
+             * range, where the entries of a row are given by the row indications. All columns must be smaller than
+             * 2^31.
+             *
+             * @return True iff the kernel was applied, i.e. false if no instruction set is selected.
+             */
+            bool multiplyWithVector(uint_fast64_t startRow, uint_fast64_t endRow, uint32_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result);
+
+            /*!
+             * Computes the minimum or maximum of the products of the rows of each row group in the given range with
+             * the vector (see multiplyWithVector) and writes it to result[group]. If given, the index of the optimal row
+             * within its group is written to choices[group]. All columns must be smaller than 2^31.
+             *
+             * @return True iff the kernel was applied, i.e. false if no instruction set is selected.
+             */
+            bool multiplyAndReduce(uint_fast64_t startGroup, uint_fast64_t endGroup, bool minimize, uint32_t const* rowGroupIndices, uint32_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result, uint_fast64_t* choices);
+
+        }
+    }
+}
+
+#endif /* STORM_UTILITY_SIMD_H_ */
@@ -1,6 +1,7 @@
 #include "storm/utility/stateelimination.h"
 
 #include <random>
+#include <set>
 
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
 #include "storm/solver/stateelimination/StaticStatePriorityQueue.h"
@@ -45,7 +46,7 @@ namespace storm {
             }
             
             bool eliminationOrderIsStatic(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
-                return eliminationOrderNeedsDistances(order) || order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty;
+                return eliminationOrderNeedsDistances(order) || order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty || order == storm::settings::modules::EliminationSettings::EliminationOrder::MinimumDegree || order == storm::settings::modules::EliminationSettings::EliminationOrder::Random;
             }
             
             template<typename ValueType>
@@ -95,6 +96,105 @@ namespace storm {
                 return backwardTransitions.getRow(state).size() * transitionMatrix.getRow(state).size();
             }
             
+            namespace {
+                // Computes the cost of eliminating a state in the simulated elimination, i.e. the maximal number of
+                // transitions it can introduce.
+                uint_fast64_t computeMinimumDegreeCost(std::vector<storm::storage::sparse::state_type> const& predecessors, std::vector<storm::storage::sparse::state_type> const& successors) {
+                    return predecessors.size() * successors.size();
+                }
+                
+                // Removes the given state from the sorted neighbours and adds the (sorted) new neighbours except for the
+                // excluded state.
+                void updateNeighbours(std::vector<storm::storage::sparse::state_type>& neighbours, storm::storage::sparse::state_type const& removedState, std::vector<storm::storage::sparse::state_type> const& newNeighbours, storm::storage::sparse::state_type const& excludedState) {
+                    std::vector<storm::storage::sparse::state_type> result;
+                    result.reserve(neighbours.size() + newNeighbours.size());
+                    auto first1 = neighbours.begin(), last1 = neighbours.end();
+                    auto first2 = newNeighbours.begin(), last2 = newNeighbours.end();
+                    while (first1 != last1 || first2 != last2) {
+                        storm::storage::sparse::state_type next;
+                        if (first2 == last2 || (first1 != last1 && *first1 < *first2)) {
+                            next = *first1++;
+                        } else if (first1 == last1 || *first2 < *first1) {
+                            next = *first2++;
+                        } else {
+                            next = *first1++;
+                            ++first2;
+                        }
+                        if (next != removedState && next != excludedState) {
+                            result.push_back(next);
+                        }
+                    }
+                    neighbours = std::move(result);
+                }
+            }
+            
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> computeMinimumDegreeOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states) {
+                // Extract the structure of the matrix without the self-loops, because they do not cause any fill-in.
+                uint_fast64_t numberOfStates = transitionMatrix.getRowCount();
+                std::vector<std::vector<storm::storage::sparse::state_type>> successors(numberOfStates);
+                std::vector<std::vector<storm::storage::sparse::state_type>> predecessors(numberOfStates);
+                for (storm::storage::sparse::state_type state = 0; state < numberOfStates; ++state) {
+                    for (auto const& entry : transitionMatrix.getRow(state)) {
+                        if (entry.getColumn() != state) {
+                            successors[state].push_back(entry.getColumn());
+                        }
+                    }
+                    for (auto const& entry : backwardTransitions.getRow(state)) {
+                        if (entry.getColumn() != state) {
+                            predecessors[state].push_back(entry.getColumn());
+                        }
+                    }
+                }
+                
+                std::vector<uint_fast64_t> costs(numberOfStates);
+                std::set<std::pair<uint_fast64_t, storm::storage::sparse::state_type>> queue;
+                for (auto state : states) {
+                    costs[state] = computeMinimumDegreeCost(predecessors[state], successors[state]);
+                    queue.emplace(costs[state], state);
+                }
+                
+                std::vector<storm::storage::sparse::state_type> order;
+                order.reserve(queue.size());
+                storm::storage::BitVector remainingStates = states;
+                while (!queue.empty()) {
+                    storm::storage::sparse::state_type state = queue.begin()->second;
+                    queue.erase(queue.begin());
+                    remainingStates.set(state, false);
+                    order.push_back(state);
+                    
+                    // Simulate the elimination: all predecessors become predecessors of all successors.
+                    for (auto const& predecessor : predecessors[state]) {
+                        updateNeighbours(successors[predecessor], state, successors[state], predecessor);
+                    }
+                    for (auto const& successor : successors[state]) {
+                        updateNeighbours(predecessors[successor], state, predecessors[state], successor);
+                    }
+                    
+                    // Update the costs of the neighbours that still need to be eliminated.
+                    auto updateCost = [&] (storm::storage::sparse::state_type const& neighbour) {
+                        if (remainingStates.get(neighbour)) {
+                            uint_fast64_t newCost = computeMinimumDegreeCost(predecessors[neighbour], successors[neighbour]);
+                            if (newCost != costs[neighbour]) {
+                                queue.erase(std::make_pair(costs[neighbour], neighbour));
+                                costs[neighbour] = newCost;
+                                queue.emplace(newCost, neighbour);
+                            }
+                        }
+                    };
+                    for (auto const& predecessor : predecessors[state]) {
+                        updateCost(predecessor);
+                    }
+                    for (auto const& successor : successors[state]) {
+                        updateCost(successor);
+                    }
+                    
+                    std::vector<storm::storage::sparse::state_type>().swap(predecessors[state]);
+                    std::vector<storm::storage::sparse::state_type>().swap(successors[state]);
+                }
+                return order;
+            }
+            
             template<typename ValueType>
             std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, storm::storage::BitVector const& states) {
                 
@@ -110,6 +210,8 @@ namespace storm {
                     std::mt19937 generator(randomDevice());
                     std::shuffle(sortedStates.begin(), sortedStates.end(), generator);
                     return std::make_unique<StaticStatePriorityQueue>(sortedStates);
+                } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::MinimumDegree) {
+                    return std::make_unique<StaticStatePriorityQueue>(computeMinimumDegreeOrder(transitionMatrix, backwardTransitions, states));
                 } else {
                     if (eliminationOrderNeedsDistances(order)) {
                         STORM_LOG_THROW(static_cast<bool>(distanceBasedStatePriorities), storm::exceptions::InvalidStateException, "Unable to build state priority queue without distance-based priorities.");
@@ -196,6 +298,7 @@ namespace storm {
             }
             
             template uint_fast64_t estimateComplexity(double const& value);
+            template std::vector<storm::storage::sparse::state_type> computeMinimumDegreeOrder(storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& states);
             template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities, storm::storage::BitVector const& states);
             template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities);
             template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities);
@@ -204,6 +307,7 @@ namespace storm {
             
 #ifdef STORM_HAVE_CARL
             template uint_fast64_t estimateComplexity(storm::RationalNumber const& value);
+            template std::vector<storm::storage::sparse::state_type> computeMinimumDegreeOrder(storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& states);
             template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities, storm::storage::BitVector const& states);
             template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities);
             template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities);
@@ -211,6 +315,7 @@ namespace storm {
             template std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrixTransposed, storm::storage::BitVector const& initialStates, std::vector<storm::RationalNumber> const& oneStepProbabilities, bool forward);
 
             template uint_fast64_t estimateComplexity(storm::RationalFunction const& value);
+            template std::vector<storm::storage::sparse::state_type> computeMinimumDegreeOrder(storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& states);
             template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities, storm::storage::BitVector const& states);
             template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities);
             template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities);
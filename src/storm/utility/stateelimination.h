@@ -53,6 +53,20 @@ namespace storm {
             template<typename ValueType>
             uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities);
             
+            /*!
+             * Computes an order in which to eliminate the given states that tries to keep the fill-in low. For this,
+             * the elimination is simulated on the structure of the matrix only and each step picks the state with the
+             * smallest product of (remaining) predecessors and successors, i.e. the maximal number of transitions the
+             * elimination of the state can introduce.
+             *
+             * @param transitionMatrix The transition matrix.
+             * @param backwardTransitions The backward transitions (i.e. the transpose of the transition matrix).
+             * @param states The states to order.
+             * @return The states in the order in which they are to be eliminated.
+             */
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> computeMinimumDegreeOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states);
+            
             template<typename ValueType>
             std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& stateDistances, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, storm::storage::BitVector const& states);
             
@@ -137,6 +137,27 @@ namespace storm {
         }
 
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isJitSet()) {
+            if (model.isPrismProgram()) {
+                // The JIT-based model builder operates on JANI models, so we translate the program. As this may rename
+                // labels, we build the model for the accordingly renamed formulas and restore the original labels.
+                STORM_LOG_INFO("Translating the PRISM program to JANI for the JIT-based model builder.");
+                auto modelAndRenaming = model.toJaniWithLabelRenaming(true);
+                std::map<std::string, std::string> const& labelRenaming = modelAndRenaming.second;
+                
+                std::vector<std::shared_ptr<storm::logic::Formula const>> janiFormulas;
+                for (auto const& formula : formulas) {
+                    janiFormulas.push_back(labelRenaming.empty() ? formula : formula->substitute(labelRenaming));
+                }
+                
+                std::shared_ptr<storm::models::sparse::Model<ValueType>> result = buildSparseModel<ValueType>(modelAndRenaming.first, janiFormulas);
+                for (auto const& labelPair : labelRenaming) {
+                    if (result->hasLabel(labelPair.second) && !result->hasLabel(labelPair.first)) {
+                        storm::storage::BitVector states = result->getStates(labelPair.second);
+                        result->getStateLabeling().addLabel(labelPair.first, std::move(states));
+                    }
+                }
+                return result;
+            }
             STORM_LOG_THROW(model.isJaniModel(), storm::exceptions::NotSupportedException, "Cannot use JIT-based model builder for non-JANI model.");
 
             storm::builder::jit::ExplicitJitJaniModelBuilder<ValueType> builder(model.asJaniModel(), options);
@@ -368,6 +389,25 @@ namespace storm {
         return result;
     }
 
+    /*!
+     * Checks whether the given formula asks for the probabilities of reaching some states within an upper time bound.
+     */
+    inline bool isQuantitativeTimeBoundedReachabilityFormula(storm::logic::Formula const& formula) {
+        if (!formula.isProbabilityOperatorFormula() || formula.asProbabilityOperatorFormula().hasBound()) {
+            return false;
+        }
+        storm::logic::Formula const& subformula = formula.asProbabilityOperatorFormula().getSubformula();
+        return subformula.isBoundedUntilFormula() && !subformula.asBoundedUntilFormula().hasLowerBound() && !subformula.asBoundedUntilFormula().isStepBounded();
+    }
+
+    template<typename ValueType>
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifySparseCtmcForTimeBounds(std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ctmc, std::shared_ptr<storm::logic::Formula const> const& formula, std::vector<double> const& upperBounds, bool onlyInitialStatesRelevant = false) {
+        STORM_LOG_THROW(isQuantitativeTimeBoundedReachabilityFormula(*formula), storm::exceptions::NotSupportedException, "Checking the property " << *formula << " for multiple time bounds is not supported.");
+        storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> task(*formula, onlyInitialStatesRelevant);
+        storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(*ctmc);
+        return modelchecker.computeBoundedUntilProbabilitiesForTimeBounds(task.substituteFormula(formula->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula()), upperBounds);
+    }
+
     template<typename ValueType>
     std::unique_ptr<storm::modelchecker::CheckResult> verifySparseMdp(std::shared_ptr<storm::models::sparse::Mdp<ValueType>> mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
         std::unique_ptr<storm::modelchecker::CheckResult> result;
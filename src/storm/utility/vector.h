@@ -10,6 +10,8 @@
 #include <algorithm>
 #include <functional>
 #include <numeric>
+#include <limits>
+#include <type_traits>
 #include <storm/adapters/CarlAdapter.h>
 
 #include <boost/optional.hpp>
@@ -17,6 +19,7 @@
 #include "storm/storage/BitVector.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/solver/OptimizationDirection.h"
 
 namespace storm {
@@ -278,6 +281,16 @@ namespace storm {
                 }
             }
             
+            /*!
+             * Retrieves the minimal number of elements per chunk when operations on vectors with the given value type
+             * are carried out by the built-in thread pool. For value types whose arithmetic is not known to be
+             * thread-safe, the operations are always carried out sequentially.
+             */
+            template<typename ValueType>
+            uint_fast64_t getParallelChunkSize() {
+                return std::is_arithmetic<ValueType>::value ? 10000 : std::numeric_limits<uint_fast64_t>::max();
+            }
+            
             /*!
              * Applies the given operation pointwise on the two given vectors and writes the result to the third vector.
              * To obtain an in-place operation, the third vector may be equal to any of the other two vectors.
@@ -303,16 +316,18 @@ namespace storm {
                                       }
                                   });
 #else
-                auto firstIt = firstOperand.begin();
-                auto firstIte = firstOperand.end();
-                auto secondIt = secondOperand.begin();
-                auto targetIt = target.begin();
-                while (firstIt != firstIte) {
-                    *targetIt = function(*firstIt, *secondIt, *targetIt);
-                    ++targetIt;
-                    ++firstIt;
-                    ++secondIt;
-                }
+                storm::utility::parallel::parallelFor(0, target.size(), [&] (uint_fast64_t startIndex, uint_fast64_t endIndex) {
+                    auto firstIt = firstOperand.begin() + startIndex;
+                    auto firstIte = firstOperand.begin() + endIndex;
+                    auto secondIt = secondOperand.begin() + startIndex;
+                    auto targetIt = target.begin() + startIndex;
+                    while (firstIt != firstIte) {
+                        *targetIt = function(*firstIt, *secondIt, *targetIt);
+                        ++targetIt;
+                        ++firstIt;
+                        ++secondIt;
+                    }
+                }, getParallelChunkSize<OutValueType>());
 #endif
             }
             
@@ -332,7 +347,9 @@ namespace storm {
                                       std::transform(firstOperand.begin() + range.begin(), firstOperand.begin() + range.end(), secondOperand.begin() + range.begin(), target.begin() + range.begin(), function);
                                   });
 #else
-                std::transform(firstOperand.begin(), firstOperand.end(), secondOperand.begin(), target.begin(), function);
+                storm::utility::parallel::parallelFor(0, target.size(), [&] (uint_fast64_t startIndex, uint_fast64_t endIndex) {
+                    std::transform(firstOperand.begin() + startIndex, firstOperand.begin() + endIndex, secondOperand.begin() + startIndex, target.begin() + startIndex, function);
+                }, getParallelChunkSize<OutValueType>());
 #endif
             }
             
@@ -351,7 +368,9 @@ namespace storm {
                                       std::transform(operand.begin() + range.begin(), operand.begin() + range.end(), target.begin() + range.begin(), function);
                                   });
 #else
-                std::transform(operand.begin(), operand.end(), target.begin(), function);
+                storm::utility::parallel::parallelFor(0, target.size(), [&] (uint_fast64_t startIndex, uint_fast64_t endIndex) {
+                    std::transform(operand.begin() + startIndex, operand.begin() + endIndex, target.begin() + startIndex, function);
+                }, getParallelChunkSize<OutValueType>());
 #endif
             }
             
@@ -589,36 +608,38 @@ namespace storm {
                                       }
                                   });
 #else
-                typename std::vector<T>::iterator targetIt = target.begin();
-                typename std::vector<T>::iterator targetIte = target.end();
-                typename std::vector<uint_fast64_t>::const_iterator rowGroupingIt = rowGrouping.begin();
-                typename std::vector<T>::const_iterator sourceIt = source.begin();
-                typename std::vector<T>::const_iterator sourceIte;
-                typename std::vector<uint_fast64_t>::iterator choiceIt;
-                uint_fast64_t localChoice;
-                if (choices != nullptr) {
-                    choiceIt = choices->begin();
-                }
-                
-                for (; targetIt != targetIte; ++targetIt, ++rowGroupingIt) {
-                    *targetIt = *sourceIt;
-                    ++sourceIt;
-                    localChoice = 1;
+                storm::utility::parallel::parallelFor(0, target.size(), [&] (uint_fast64_t startRow, uint_fast64_t endRow) {
+                    typename std::vector<T>::iterator targetIt = target.begin() + startRow;
+                    typename std::vector<T>::iterator targetIte = target.begin() + endRow;
+                    typename std::vector<uint_fast64_t>::const_iterator rowGroupingIt = rowGrouping.begin() + startRow;
+                    typename std::vector<T>::const_iterator sourceIt = source.begin() + *rowGroupingIt;
+                    typename std::vector<T>::const_iterator sourceIte;
+                    typename std::vector<uint_fast64_t>::iterator choiceIt;
+                    uint_fast64_t localChoice;
                     if (choices != nullptr) {
-                        *choiceIt = 0;
+                        choiceIt = choices->begin() + startRow;
                     }
-                    for (sourceIte = source.begin() + *(rowGroupingIt + 1); sourceIt != sourceIte; ++sourceIt, ++localChoice) {
-                        if (filter(*sourceIt, *targetIt)) {
-                            *targetIt = *sourceIt;
-                            if (choices != nullptr) {
-                                *choiceIt = localChoice;
+                    
+                    for (; targetIt != targetIte; ++targetIt, ++rowGroupingIt) {
+                        *targetIt = *sourceIt;
+                        ++sourceIt;
+                        localChoice = 1;
+                        if (choices != nullptr) {
+                            *choiceIt = 0;
+                        }
+                        for (sourceIte = source.begin() + *(rowGroupingIt + 1); sourceIt != sourceIte; ++sourceIt, ++localChoice) {
+                            if (filter(*sourceIt, *targetIt)) {
+                                *targetIt = *sourceIt;
+                                if (choices != nullptr) {
+                                    *choiceIt = localChoice;
+                                }
                             }
                         }
+                        if (choices != nullptr) {
+                            ++choiceIt;
+                        }
                     }
-                    if (choices != nullptr) {
-                        ++choiceIt;
-                    }
-                }
+                }, getParallelChunkSize<T>());
 #endif
             }
                         
@@ -0,0 +1,185 @@
+#include "gtest/gtest.h"
+#include "test/storm-test-helper.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_MSAT
+
+#include "storm/parser/PrismParser.h"
+
+#include "storm/abstraction/MenuGameRefiner.h"
+#include "storm/abstraction/jani/JaniMenuGameAbstractor.h"
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/jani/Model.h"
+
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+
+#include "storm/models/symbolic/StandardRewardModel.h"
+
+#include "storm/utility/solver.h"
+
+#include "storm/adapters/CarlAdapter.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/AbstractionSettings.h"
+
+TEST(JaniMenuGame, WlanParallelEnumerationTest_Cudd) {
+    storm::settings::mutableAbstractionSettings().setAddAllGuards(false);
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/wlan0-2-4.nm");
+    program = program.substituteConstants();
+    program = program.flattenModules(std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>());
+    storm::jani::Model model = program.toJani();
+    
+    std::vector<storm::expressions::Expression> initialPredicates;
+    storm::expressions::ExpressionManager& manager = model.getManager();
+    
+    initialPredicates.push_back(manager.getVariableExpression("s1") < manager.integer(5));
+    initialPredicates.push_back(manager.getVariableExpression("bc1") == manager.integer(0));
+    initialPredicates.push_back(manager.getVariableExpression("c1") == manager.getVariableExpression("c2"));
+    
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+    
+    // The enumeration on several threads must yield the same game as the sequential one.
+    std::vector<std::vector<uint64_t>> results;
+    for (uint_fast64_t threads : {1, 4}) {
+        storm::test::ThreadCountGuard threadCountGuard(threads);
+        
+        storm::abstraction::jani::JaniMenuGameAbstractor<storm::dd::DdType::CUDD, double> abstractor(model, smtSolverFactory);
+        storm::abstraction::MenuGameRefiner<storm::dd::DdType::CUDD, double> refiner(abstractor, smtSolverFactory->create(manager));
+        refiner.refine(initialPredicates);
+        
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff1") < manager.integer(7)}));
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff2") < manager.integer(7)}));
+        
+        storm::abstraction::MenuGame<storm::dd::DdType::CUDD, double> game = abstractor.abstract();
+        results.push_back({game.getNumberOfTransitions(), game.getNumberOfStates(), game.getBottomStates().getNonZeroCount(), game.getQualitativeTransitionMatrix().getNodeCount()});
+    }
+    
+    EXPECT_EQ(results.front(), results.back());
+    
+    storm::settings::mutableAbstractionSettings().restoreDefaults();
+}
+
+TEST(JaniMenuGame, WlanParallelEnumerationTest_Sylvan) {
+    storm::settings::mutableAbstractionSettings().setAddAllGuards(false);
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/wlan0-2-4.nm");
+    program = program.substituteConstants();
+    program = program.flattenModules(std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>());
+    storm::jani::Model model = program.toJani();
+    
+    std::vector<storm::expressions::Expression> initialPredicates;
+    storm::expressions::ExpressionManager& manager = model.getManager();
+    
+    initialPredicates.push_back(manager.getVariableExpression("s1") < manager.integer(5));
+    initialPredicates.push_back(manager.getVariableExpression("bc1") == manager.integer(0));
+    initialPredicates.push_back(manager.getVariableExpression("c1") == manager.getVariableExpression("c2"));
+    
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+    
+    // The enumeration on several threads must yield the same game as the sequential one.
+    std::vector<std::vector<uint64_t>> results;
+    for (uint_fast64_t threads : {1, 4}) {
+        storm::test::ThreadCountGuard threadCountGuard(threads);
+        
+        storm::abstraction::jani::JaniMenuGameAbstractor<storm::dd::DdType::Sylvan, double> abstractor(model, smtSolverFactory);
+        storm::abstraction::MenuGameRefiner<storm::dd::DdType::Sylvan, double> refiner(abstractor, smtSolverFactory->create(manager));
+        refiner.refine(initialPredicates);
+        
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff1") < manager.integer(7)}));
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff2") < manager.integer(7)}));
+        
+        storm::abstraction::MenuGame<storm::dd::DdType::Sylvan, double> game = abstractor.abstract();
+        results.push_back({game.getNumberOfTransitions(), game.getNumberOfStates(), game.getBottomStates().getNonZeroCount(), game.getQualitativeTransitionMatrix().getNodeCount()});
+    }
+    
+    EXPECT_EQ(results.front(), results.back());
+    
+    storm::settings::mutableAbstractionSettings().restoreDefaults();
+}
+
+TEST(JaniMenuGame, WlanParallelDecompositionEnumerationTest_Cudd) {
+    storm::settings::mutableAbstractionSettings().setAddAllGuards(false);
+    storm::settings::mutableAbstractionSettings().setUseDecomposition(true);
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/wlan0-2-4.nm");
+    program = program.substituteConstants();
+    program = program.flattenModules(std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>());
+    storm::jani::Model model = program.toJani();
+    
+    std::vector<storm::expressions::Expression> initialPredicates;
+    storm::expressions::ExpressionManager& manager = model.getManager();
+    
+    initialPredicates.push_back(manager.getVariableExpression("s1") < manager.integer(5));
+    initialPredicates.push_back(manager.getVariableExpression("bc1") == manager.integer(0));
+    initialPredicates.push_back(manager.getVariableExpression("c1") == manager.getVariableExpression("c2"));
+    
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+    
+    // With the decomposition, abstract guards are enumerated and encoded before the remaining enumeration runs on
+    // several threads. This must yield the same game as the sequential enumeration.
+    std::vector<std::vector<uint64_t>> results;
+    for (uint_fast64_t threads : {1, 4}) {
+        storm::test::ThreadCountGuard threadCountGuard(threads);
+        
+        storm::abstraction::jani::JaniMenuGameAbstractor<storm::dd::DdType::CUDD, double> abstractor(model, smtSolverFactory);
+        storm::abstraction::MenuGameRefiner<storm::dd::DdType::CUDD, double> refiner(abstractor, smtSolverFactory->create(manager));
+        refiner.refine(initialPredicates);
+        
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff1") < manager.integer(7)}));
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff2") < manager.integer(7)}));
+        
+        storm::abstraction::MenuGame<storm::dd::DdType::CUDD, double> game = abstractor.abstract();
+        results.push_back({game.getNumberOfTransitions(), game.getNumberOfStates(), game.getBottomStates().getNonZeroCount(), game.getQualitativeTransitionMatrix().getNodeCount()});
+    }
+    
+    EXPECT_EQ(results.front(), results.back());
+    
+    storm::settings::mutableAbstractionSettings().setUseDecomposition(false);
+    storm::settings::mutableAbstractionSettings().restoreDefaults();
+}
+
+TEST(JaniMenuGame, WlanParallelDecompositionEnumerationTest_Sylvan) {
+    storm::settings::mutableAbstractionSettings().setAddAllGuards(false);
+    storm::settings::mutableAbstractionSettings().setUseDecomposition(true);
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/wlan0-2-4.nm");
+    program = program.substituteConstants();
+    program = program.flattenModules(std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>());
+    storm::jani::Model model = program.toJani();
+    
+    std::vector<storm::expressions::Expression> initialPredicates;
+    storm::expressions::ExpressionManager& manager = model.getManager();
+    
+    initialPredicates.push_back(manager.getVariableExpression("s1") < manager.integer(5));
+    initialPredicates.push_back(manager.getVariableExpression("bc1") == manager.integer(0));
+    initialPredicates.push_back(manager.getVariableExpression("c1") == manager.getVariableExpression("c2"));
+    
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+    
+    // With the decomposition, abstract guards are enumerated and encoded before the remaining enumeration runs on
+    // several threads. This must yield the same game as the sequential enumeration.
+    std::vector<std::vector<uint64_t>> results;
+    for (uint_fast64_t threads : {1, 4}) {
+        storm::test::ThreadCountGuard threadCountGuard(threads);
+        
+        storm::abstraction::jani::JaniMenuGameAbstractor<storm::dd::DdType::Sylvan, double> abstractor(model, smtSolverFactory);
+        storm::abstraction::MenuGameRefiner<storm::dd::DdType::Sylvan, double> refiner(abstractor, smtSolverFactory->create(manager));
+        refiner.refine(initialPredicates);
+        
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff1") < manager.integer(7)}));
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff2") < manager.integer(7)}));
+        
+        storm::abstraction::MenuGame<storm::dd::DdType::Sylvan, double> game = abstractor.abstract();
+        results.push_back({game.getNumberOfTransitions(), game.getNumberOfStates(), game.getBottomStates().getNonZeroCount(), game.getQualitativeTransitionMatrix().getNodeCount()});
+    }
+    
+    EXPECT_EQ(results.front(), results.back());
+    
+    storm::settings::mutableAbstractionSettings().setUseDecomposition(false);
+    storm::settings::mutableAbstractionSettings().restoreDefaults();
+}
+
+#endif
@@ -1,4 +1,5 @@
 #include "gtest/gtest.h"
+#include "test/storm-test-helper.h"
 #include "storm-config.h"
 
 #ifdef STORM_HAVE_MSAT
@@ -852,6 +853,160 @@ TEST(PrismMenuGame, WlanAbstractionAndRefinementTest_Sylvan) {
     storm::settings::mutableAbstractionSettings().restoreDefaults();
 }
 
+TEST(PrismMenuGame, WlanParallelEnumerationTest_Cudd) {
+    storm::settings::mutableAbstractionSettings().setAddAllGuards(false);
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/wlan0-2-4.nm");
+    program = program.substituteConstants();
+    program = program.flattenModules(std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>());
+    
+    std::vector<storm::expressions::Expression> initialPredicates;
+    storm::expressions::ExpressionManager& manager = program.getManager();
+    
+    initialPredicates.push_back(manager.getVariableExpression("s1") < manager.integer(5));
+    initialPredicates.push_back(manager.getVariableExpression("bc1") == manager.integer(0));
+    initialPredicates.push_back(manager.getVariableExpression("c1") == manager.getVariableExpression("c2"));
+    
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+    
+    // The enumeration on several threads must yield the same game as the sequential one.
+    std::vector<std::vector<uint64_t>> results;
+    for (uint_fast64_t threads : {1, 4}) {
+        storm::test::ThreadCountGuard threadCountGuard(threads);
+        
+        storm::abstraction::prism::PrismMenuGameAbstractor<storm::dd::DdType::CUDD, double> abstractor(program, smtSolverFactory);
+        storm::abstraction::MenuGameRefiner<storm::dd::DdType::CUDD, double> refiner(abstractor, smtSolverFactory->create(manager));
+        refiner.refine(initialPredicates);
+        
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff1") < manager.integer(7)}));
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff2") < manager.integer(7)}));
+        
+        storm::abstraction::MenuGame<storm::dd::DdType::CUDD, double> game = abstractor.abstract();
+        results.push_back({game.getNumberOfTransitions(), game.getNumberOfStates(), game.getBottomStates().getNonZeroCount(), game.getQualitativeTransitionMatrix().getNodeCount()});
+    }
+    
+    EXPECT_EQ(results.front(), results.back());
+    
+    storm::settings::mutableAbstractionSettings().restoreDefaults();
+}
+
+TEST(PrismMenuGame, WlanParallelEnumerationTest_Sylvan) {
+    storm::settings::mutableAbstractionSettings().setAddAllGuards(false);
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/wlan0-2-4.nm");
+    program = program.substituteConstants();
+    program = program.flattenModules(std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>());
+    
+    std::vector<storm::expressions::Expression> initialPredicates;
+    storm::expressions::ExpressionManager& manager = program.getManager();
+    
+    initialPredicates.push_back(manager.getVariableExpression("s1") < manager.integer(5));
+    initialPredicates.push_back(manager.getVariableExpression("bc1") == manager.integer(0));
+    initialPredicates.push_back(manager.getVariableExpression("c1") == manager.getVariableExpression("c2"));
+    
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+    
+    // The enumeration on several threads must yield the same game as the sequential one.
+    std::vector<std::vector<uint64_t>> results;
+    for (uint_fast64_t threads : {1, 4}) {
+        storm::test::ThreadCountGuard threadCountGuard(threads);
+        
+        storm::abstraction::prism::PrismMenuGameAbstractor<storm::dd::DdType::Sylvan, double> abstractor(program, smtSolverFactory);
+        storm::abstraction::MenuGameRefiner<storm::dd::DdType::Sylvan, double> refiner(abstractor, smtSolverFactory->create(manager));
+        refiner.refine(initialPredicates);
+        
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff1") < manager.integer(7)}));
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff2") < manager.integer(7)}));
+        
+        storm::abstraction::MenuGame<storm::dd::DdType::Sylvan, double> game = abstractor.abstract();
+        results.push_back({game.getNumberOfTransitions(), game.getNumberOfStates(), game.getBottomStates().getNonZeroCount(), game.getQualitativeTransitionMatrix().getNodeCount()});
+    }
+    
+    EXPECT_EQ(results.front(), results.back());
+    
+    storm::settings::mutableAbstractionSettings().restoreDefaults();
+}
+
+TEST(PrismMenuGame, WlanParallelDecompositionEnumerationTest_Cudd) {
+    storm::settings::mutableAbstractionSettings().setAddAllGuards(false);
+    storm::settings::mutableAbstractionSettings().setUseDecomposition(true);
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/wlan0-2-4.nm");
+    program = program.substituteConstants();
+    program = program.flattenModules(std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>());
+    
+    std::vector<storm::expressions::Expression> initialPredicates;
+    storm::expressions::ExpressionManager& manager = program.getManager();
+    
+    initialPredicates.push_back(manager.getVariableExpression("s1") < manager.integer(5));
+    initialPredicates.push_back(manager.getVariableExpression("bc1") == manager.integer(0));
+    initialPredicates.push_back(manager.getVariableExpression("c1") == manager.getVariableExpression("c2"));
+    
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+    
+    // With the decomposition, abstract guards are enumerated and encoded before the remaining enumeration runs on
+    // several threads. This must yield the same game as the sequential enumeration.
+    std::vector<std::vector<uint64_t>> results;
+    for (uint_fast64_t threads : {1, 4}) {
+        storm::test::ThreadCountGuard threadCountGuard(threads);
+        
+        storm::abstraction::prism::PrismMenuGameAbstractor<storm::dd::DdType::CUDD, double> abstractor(program, smtSolverFactory);
+        storm::abstraction::MenuGameRefiner<storm::dd::DdType::CUDD, double> refiner(abstractor, smtSolverFactory->create(manager));
+        refiner.refine(initialPredicates);
+        
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff1") < manager.integer(7)}));
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff2") < manager.integer(7)}));
+        
+        storm::abstraction::MenuGame<storm::dd::DdType::CUDD, double> game = abstractor.abstract();
+        results.push_back({game.getNumberOfTransitions(), game.getNumberOfStates(), game.getBottomStates().getNonZeroCount(), game.getQualitativeTransitionMatrix().getNodeCount()});
+    }
+    
+    EXPECT_EQ(results.front(), results.back());
+    
+    storm::settings::mutableAbstractionSettings().setUseDecomposition(false);
+    storm::settings::mutableAbstractionSettings().restoreDefaults();
+}
+
+TEST(PrismMenuGame, WlanParallelDecompositionEnumerationTest_Sylvan) {
+    storm::settings::mutableAbstractionSettings().setAddAllGuards(false);
+    storm::settings::mutableAbstractionSettings().setUseDecomposition(true);
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/wlan0-2-4.nm");
+    program = program.substituteConstants();
+    program = program.flattenModules(std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>());
+    
+    std::vector<storm::expressions::Expression> initialPredicates;
+    storm::expressions::ExpressionManager& manager = program.getManager();
+    
+    initialPredicates.push_back(manager.getVariableExpression("s1") < manager.integer(5));
+    initialPredicates.push_back(manager.getVariableExpression("bc1") == manager.integer(0));
+    initialPredicates.push_back(manager.getVariableExpression("c1") == manager.getVariableExpression("c2"));
+    
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+    
+    // With the decomposition, abstract guards are enumerated and encoded before the remaining enumeration runs on
+    // several threads. This must yield the same game as the sequential enumeration.
+    std::vector<std::vector<uint64_t>> results;
+    for (uint_fast64_t threads : {1, 4}) {
+        storm::test::ThreadCountGuard threadCountGuard(threads);
+        
+        storm::abstraction::prism::PrismMenuGameAbstractor<storm::dd::DdType::Sylvan, double> abstractor(program, smtSolverFactory);
+        storm::abstraction::MenuGameRefiner<storm::dd::DdType::Sylvan, double> refiner(abstractor, smtSolverFactory->create(manager));
+        refiner.refine(initialPredicates);
+        
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff1") < manager.integer(7)}));
+        ASSERT_NO_THROW(refiner.refine({manager.getVariableExpression("backoff2") < manager.integer(7)}));
+        
+        storm::abstraction::MenuGame<storm::dd::DdType::Sylvan, double> game = abstractor.abstract();
+        results.push_back({game.getNumberOfTransitions(), game.getNumberOfStates(), game.getBottomStates().getNonZeroCount(), game.getQualitativeTransitionMatrix().getNodeCount()});
+    }
+    
+    EXPECT_EQ(results.front(), results.back());
+    
+    storm::settings::mutableAbstractionSettings().setUseDecomposition(false);
+    storm::settings::mutableAbstractionSettings().restoreDefaults();
+}
+
 TEST(PrismMenuGame, WlanFullAbstractionTest_Cudd) {
     storm::settings::mutableAbstractionSettings().setAddAllGuards(false);
 
@@ -0,0 +1,118 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/generator/BytecodeExpressionEvaluator.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/ExprtkExpressionEvaluator.h"
+
+TEST(BytecodeExpressionEvaluatorTest, AgreesWithExprtk) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Variable b = manager->declareBooleanVariable("b");
+    storm::expressions::Variable s = manager->declareIntegerVariable("s");
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+    storm::expressions::Variable r = manager->declareRationalVariable("r");
+    storm::expressions::Expression bExpression = b.getExpression();
+    storm::expressions::Expression sExpression = s.getExpression();
+    storm::expressions::Expression xExpression = x.getExpression();
+    storm::expressions::Expression rExpression = r.getExpression();
+
+    // The variable s ranges over [0, 3] and x over [-2, 5]. The rational variable r is not stored in the states.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.booleanVariables.emplace_back(b, 0);
+    variableInformation.integerVariables.emplace_back(s, 0, 3, 1, 2);
+    variableInformation.integerVariables.emplace_back(x, -2, 5, 3, 3);
+    variableInformation.totalBitOffset = 6;
+
+    std::vector<storm::expressions::Expression> booleanExpressions;
+    booleanExpressions.push_back(bExpression);
+    booleanExpressions.push_back(!bExpression && sExpression == manager->integer(2));
+    booleanExpressions.push_back(storm::expressions::implies(bExpression, xExpression < sExpression));
+    booleanExpressions.push_back(storm::expressions::iff(bExpression, xExpression >= manager->integer(0)));
+    booleanExpressions.push_back(storm::expressions::xclusiveor(bExpression, sExpression != xExpression) || xExpression > manager->integer(4));
+    booleanExpressions.push_back(storm::expressions::ite(bExpression, sExpression <= manager->integer(1), xExpression * xExpression == manager->integer(4)));
+    booleanExpressions.push_back(rExpression * xExpression > manager->rational(0.5));
+
+    std::vector<storm::expressions::Expression> numericalExpressions;
+    numericalExpressions.push_back(sExpression + xExpression * manager->integer(3) - manager->integer(1));
+    numericalExpressions.push_back(storm::expressions::ite(bExpression, -xExpression, sExpression / manager->integer(2)));
+    numericalExpressions.push_back(storm::expressions::minimum(sExpression, xExpression) + storm::expressions::maximum(sExpression, xExpression));
+    numericalExpressions.push_back(storm::expressions::floor(xExpression / manager->integer(3)) + storm::expressions::ceil(rExpression * sExpression));
+    numericalExpressions.push_back(storm::expressions::abs(xExpression) + storm::expressions::sign(xExpression - sExpression));
+    numericalExpressions.push_back(sExpression ^ manager->integer(2));
+    numericalExpressions.push_back(manager->rational(0.3) * rExpression + storm::expressions::ite(sExpression > manager->integer(1), storm::expressions::ite(bExpression, manager->integer(1), manager->integer(2)), xExpression));
+
+    storm::generator::BytecodeExpressionEvaluator bytecodeEvaluator(*manager, variableInformation);
+    storm::expressions::ExprtkExpressionEvaluator exprtkEvaluator(*manager);
+
+    for (double rValue : {-1.0, 0.25, 2.5}) {
+        bytecodeEvaluator.setRationalValue(r, rValue);
+        exprtkEvaluator.setRationalValue(r, rValue);
+        for (uint64_t bValue = 0; bValue < 2; ++bValue) {
+            for (int64_t sValue = 0; sValue <= 3; ++sValue) {
+                for (int64_t xValue = -2; xValue <= 5; ++xValue) {
+                    storm::generator::CompressedState state(variableInformation.getTotalBitOffset());
+                    state.set(0, bValue == 1);
+                    state.setFromInt(1, 2, sValue);
+                    state.setFromInt(3, 3, xValue + 2);
+                    bytecodeEvaluator.setState(state);
+
+                    exprtkEvaluator.setBooleanValue(b, bValue == 1);
+                    exprtkEvaluator.setIntegerValue(s, sValue);
+                    exprtkEvaluator.setIntegerValue(x, xValue);
+
+                    for (auto const& expression : booleanExpressions) {
+                        EXPECT_EQ(exprtkEvaluator.asBool(expression), bytecodeEvaluator.asBool(expression)) << expression << " with b=" << bValue << ", s=" << sValue << ", x=" << xValue << ", r=" << rValue;
+                    }
+                    for (auto const& expression : numericalExpressions) {
+                        EXPECT_EQ(exprtkEvaluator.asRational(expression), bytecodeEvaluator.asRational(expression)) << expression << " with b=" << bValue << ", s=" << sValue << ", x=" << xValue << ", r=" << rValue;
+                        EXPECT_EQ(exprtkEvaluator.asInt(expression), bytecodeEvaluator.asInt(expression)) << expression << " with b=" << bValue << ", s=" << sValue << ", x=" << xValue << ", r=" << rValue;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(BytecodeExpressionEvaluatorTest, PowerAgreesWithExprtk) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+    storm::expressions::Variable r = manager->declareRationalVariable("r");
+    storm::expressions::Expression xExpression = x.getExpression();
+    storm::expressions::Expression rExpression = r.getExpression();
+
+    // The variable x ranges over [1, 8]. The rational variable r is not stored in the states.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.integerVariables.emplace_back(x, 1, 8, 0, 3);
+    variableInformation.totalBitOffset = 3;
+
+    // Powers with integral exponents of non-integral bases are where repeated multiplication and std::pow may differ.
+    std::vector<storm::expressions::Expression> expressions;
+    for (int_fast64_t exponent : {-7, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 17, 60, 61}) {
+        expressions.push_back(rExpression ^ manager->integer(exponent));
+        expressions.push_back((rExpression * manager->rational(0.3) + manager->rational(0.1)) ^ manager->integer(exponent));
+    }
+    expressions.push_back(rExpression ^ (manager->integer(2) * manager->integer(3) + manager->integer(1)));
+    expressions.push_back((rExpression * rExpression) ^ manager->rational(2.5));
+    expressions.push_back(manager->rational(1.1) ^ manager->integer(7));
+    expressions.push_back(manager->rational(1.1) ^ xExpression);
+    expressions.push_back(rExpression ^ xExpression);
+    expressions.push_back((rExpression / xExpression) ^ manager->integer(9));
+
+    storm::generator::BytecodeExpressionEvaluator bytecodeEvaluator(*manager, variableInformation);
+    storm::expressions::ExprtkExpressionEvaluator exprtkEvaluator(*manager);
+
+    for (double rValue : {-1.3, 0.1, 0.7, 1.1, 2.9, 3.14159}) {
+        bytecodeEvaluator.setRationalValue(r, rValue);
+        exprtkEvaluator.setRationalValue(r, rValue);
+        for (int64_t xValue = 1; xValue <= 8; ++xValue) {
+            storm::generator::CompressedState state(variableInformation.getTotalBitOffset());
+            state.setFromInt(0, 3, xValue - 1);
+            bytecodeEvaluator.setState(state);
+            exprtkEvaluator.setIntegerValue(x, xValue);
+
+            for (auto const& expression : expressions) {
+                EXPECT_EQ(exprtkEvaluator.asRational(expression), bytecodeEvaluator.asRational(expression)) << expression << " with x=" << xValue << ", r=" << rValue;
+            }
+        }
+    }
+}
@@ -9,6 +9,9 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/IOSettings.h"
+#include "storm/utility/storm.h"
+
+#include <sys/stat.h>
 
 TEST(ExplicitJitJaniModelBuilderTest, Dtmc) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -145,6 +148,94 @@ TEST(ExplicitJitJaniModelBuilderTest, Ma) {
     EXPECT_EQ(7ul, model->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates().getNumberOfSetBits());
 }
 
+TEST(ExplicitJitJaniModelBuilderTest, Cache) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::jani::Model janiModel = program.toJani();
+    boost::filesystem::path cacheDirectory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-jit-cache-test-%%%%-%%%%-%%%%");
+    
+    // The first build compiles the model and stores the shared library in the (newly created, private) cache.
+    storm::builder::jit::ExplicitJitJaniModelBuilder<double> builder(janiModel);
+    builder.setCacheDirectory(cacheDirectory);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = builder.build();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(20ul, model->getNumberOfTransitions());
+    
+    struct stat directoryStatus;
+    ASSERT_EQ(0, stat(cacheDirectory.c_str(), &directoryStatus));
+    EXPECT_EQ(static_cast<mode_t>(S_IRWXU), directoryStatus.st_mode & (S_IRWXU | S_IRWXG | S_IRWXO));
+    
+    std::vector<boost::filesystem::path> cachedLibraries;
+    for (boost::filesystem::directory_iterator it(cacheDirectory), ite; it != ite; ++it) {
+        if (it->path().extension() != ".cpp") {
+            cachedLibraries.push_back(it->path());
+        }
+    }
+    ASSERT_EQ(1ul, cachedLibraries.size());
+    struct stat libraryStatus;
+    ASSERT_EQ(0, stat(cachedLibraries.front().c_str(), &libraryStatus));
+    
+    // The second build takes the shared library from the cache, so it is neither compiled nor replaced.
+    storm::builder::jit::ExplicitJitJaniModelBuilder<double> secondBuilder(janiModel);
+    secondBuilder.setCacheDirectory(cacheDirectory);
+    model = secondBuilder.build();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(20ul, model->getNumberOfTransitions());
+    
+    struct stat secondLibraryStatus;
+    ASSERT_EQ(0, stat(cachedLibraries.front().c_str(), &secondLibraryStatus));
+    EXPECT_EQ(libraryStatus.st_ino, secondLibraryStatus.st_ino);
+    EXPECT_EQ(libraryStatus.st_mtime, secondLibraryStatus.st_mtime);
+    EXPECT_EQ(2, std::distance(boost::filesystem::directory_iterator(cacheDirectory), boost::filesystem::directory_iterator()));
+    
+    // Cache directories that other users may modify are not used.
+    ASSERT_EQ(0, chmod(cacheDirectory.c_str(), S_IRWXU | S_IRWXG | S_IRWXO));
+    storm::builder::jit::ExplicitJitJaniModelBuilder<double> thirdBuilder(janiModel);
+    thirdBuilder.setCacheDirectory(cacheDirectory);
+    model = thirdBuilder.build();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    struct stat thirdLibraryStatus;
+    ASSERT_EQ(0, stat(cachedLibraries.front().c_str(), &thirdLibraryStatus));
+    EXPECT_EQ(libraryStatus.st_ino, thirdLibraryStatus.st_ino);
+    EXPECT_EQ(2, std::distance(boost::filesystem::directory_iterator(cacheDirectory), boost::filesystem::directory_iterator()));
+    
+    boost::filesystem::remove_all(cacheDirectory);
+}
+
+TEST(ExplicitJitJaniModelBuilderTest, PrismProgramWithRenamedLabel) {
+    // The label d clashes with the variable d, so it is renamed when translating the program to JANI.
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(R"(dtmc
+module die
+    s : [0..7] init 0;
+    d : [0..6] init 0;
+    [] s=0 -> 0.5 : (s'=1) + 0.5 : (s'=2);
+    [] s=1 -> 0.5 : (s'=3) + 0.5 : (s'=4);
+    [] s=2 -> 0.5 : (s'=5) + 0.5 : (s'=6);
+    [] s=3 -> 0.5 : (s'=1) + 0.5 : (s'=7) & (d'=1);
+    [] s=4 -> 0.5 : (s'=7) & (d'=2) + 0.5 : (s'=7) & (d'=3);
+    [] s=5 -> 0.5 : (s'=7) & (d'=4) + 0.5 : (s'=7) & (d'=5);
+    [] s=6 -> 0.5 : (s'=2) + 0.5 : (s'=7) & (d'=6);
+    [] s=7 -> 1: (s'=7);
+endmodule
+label "d" = s=7 & d=6;
+)", "die_with_renamed_label");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::extractFormulasFromProperties(storm::parsePropertiesForPrismProgram("P=? [F \"d\"]", program));
+    ASSERT_FALSE(program.toJaniWithLabelRenaming(true).second.empty());
+    
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::buildSparseModel<double>(program, formulas);
+    std::shared_ptr<storm::models::sparse::Model<double>> jitModel;
+    {
+        std::unique_ptr<storm::settings::SettingMemento> jit = storm::settings::mutableIOSettings().overrideJitSet(true);
+        jitModel = storm::buildSparseModel<double>(program, formulas);
+    }
+    
+    // The model built from the translated program carries the original label.
+    EXPECT_EQ(model->getNumberOfStates(), jitModel->getNumberOfStates());
+    EXPECT_EQ(model->getNumberOfTransitions(), jitModel->getNumberOfTransitions());
+    ASSERT_TRUE(jitModel->hasLabel("d"));
+    EXPECT_EQ(1ul, jitModel->getStates("d").getNumberOfSetBits());
+    EXPECT_EQ(model->getStates("d").getNumberOfSetBits(), jitModel->getStates("d").getNumberOfSetBits());
+}
+
 TEST(ExplicitJitJaniModelBuilderTest, FailComposition) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/system_composition.nm");
     storm::jani::Model janiModel = program.toJani();
@@ -1,4 +1,5 @@
 #include "gtest/gtest.h"
+#include "test/storm-test-helper.h"
 #include "storm-config.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -7,6 +8,7 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
 #include "storm/settings/modules/IOSettings.h"
+#include "storm/utility/parallel.h"
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -100,6 +102,46 @@ TEST(ExplicitPrismModelBuilderTest, Mdp) {
     EXPECT_EQ(59ul, model->getNumberOfTransitions());
 }
 
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    parallelOptions.parallelExploration = true;
+    
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+        storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+        std::shared_ptr<storm::models::sparse::Model<double>> sequentialModel;
+        {
+            storm::test::ThreadCountGuard threadCountGuard(1);
+            sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        }
+        
+        // The parallel exploration must yield exactly the same model as the sequential one.
+        std::shared_ptr<storm::models::sparse::Model<double>> parallelModel;
+        {
+            storm::test::ThreadCountGuard threadCountGuard(4);
+            parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+        }
+        
+        EXPECT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates());
+        EXPECT_EQ(sequentialModel->getNumberOfTransitions(), parallelModel->getNumberOfTransitions());
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling());
+        EXPECT_EQ(sequentialModel->getRewardModels().size(), parallelModel->getRewardModels().size());
+        for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+            auto const& parallelRewardModel = parallelModel->getRewardModel(rewardModel.first);
+            ASSERT_EQ(rewardModel.second.hasStateRewards(), parallelRewardModel.hasStateRewards());
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector());
+            }
+            ASSERT_EQ(rewardModel.second.hasStateActionRewards(), parallelRewardModel.hasStateActionRewards());
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector());
+            }
+        }
+    }
+}
+
 TEST(ExplicitPrismModelBuilderTest, Ma) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
     
@@ -0,0 +1,68 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <algorithm>
+
+#include "storm/generator/GuardIndex.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/SimpleValuation.h"
+
+TEST(GuardIndexTest, AgreesWithEvaluation) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Variable b = manager->declareBooleanVariable("b");
+    storm::expressions::Variable s = manager->declareIntegerVariable("s");
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+    storm::expressions::Expression bExpression = b.getExpression();
+    storm::expressions::Expression sExpression = s.getExpression();
+    storm::expressions::Expression xExpression = x.getExpression();
+
+    // The variable s ranges over [0, 3] and x over [1, 6].
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.booleanVariables.emplace_back(b, 0);
+    variableInformation.integerVariables.emplace_back(s, 0, 3, 1, 2);
+    variableInformation.integerVariables.emplace_back(x, 1, 6, 3, 3);
+    variableInformation.totalBitOffset = 6;
+
+    std::vector<storm::expressions::Expression> guards;
+    guards.push_back(sExpression == manager->integer(0) && bExpression);
+    guards.push_back(manager->integer(2) <= sExpression && xExpression < manager->integer(3));
+    guards.push_back(sExpression == manager->integer(1) && xExpression * xExpression == manager->integer(4));
+    guards.push_back(manager->boolean(true));
+    guards.push_back(sExpression == manager->integer(3) && sExpression == manager->integer(1));
+    guards.push_back(!bExpression && xExpression > manager->integer(4));
+
+    storm::generator::GuardIndex guardIndex(variableInformation, guards);
+    ASSERT_EQ(guards.size(), guardIndex.getNumberOfGuards());
+    EXPECT_TRUE(guardIndex.isExact(0));
+    EXPECT_TRUE(guardIndex.isExact(1));
+    EXPECT_FALSE(guardIndex.isExact(2));
+    EXPECT_TRUE(guardIndex.isExact(3));
+    EXPECT_TRUE(guardIndex.isExact(5));
+
+    for (uint64_t bValue = 0; bValue < 2; ++bValue) {
+        for (int64_t sValue = 0; sValue <= 3; ++sValue) {
+            for (int64_t xValue = 1; xValue <= 6; ++xValue) {
+                storm::generator::CompressedState state(variableInformation.getTotalBitOffset());
+                state.set(0, bValue == 1);
+                state.setFromInt(1, 2, sValue);
+                state.setFromInt(3, 3, xValue - 1);
+
+                storm::expressions::SimpleValuation valuation(manager);
+                valuation.setBooleanValue(b, bValue == 1);
+                valuation.setIntegerValue(s, sValue);
+                valuation.setIntegerValue(x, xValue);
+
+                std::vector<uint64_t> const& candidates = guardIndex.getCandidates(state);
+                EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+                for (uint64_t position = 0; position < guards.size(); ++position) {
+                    bool enabled = std::find(candidates.begin(), candidates.end(), position) != candidates.end() && guardIndex.satisfiesConstraints(position, state) && (guardIndex.isExact(position) || guards[position].evaluateAsBool(&valuation));
+                    EXPECT_EQ(guards[position].evaluateAsBool(&valuation), enabled) << "guard " << guards[position] << " in state b=" << bValue << ", s=" << sValue << ", x=" << xValue;
+                }
+
+                // The unsatisfiable guard must never be considered and the guard that is true everywhere always.
+                EXPECT_TRUE(std::find(candidates.begin(), candidates.end(), 4) == candidates.end() || !guardIndex.satisfiesConstraints(4, state));
+                EXPECT_TRUE(std::find(candidates.begin(), candidates.end(), 3) != candidates.end());
+            }
+        }
+    }
+}
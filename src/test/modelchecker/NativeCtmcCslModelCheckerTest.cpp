@@ -142,6 +142,45 @@ TEST(NativeCtmcCslModelCheckerTest, Embedded) {
     EXPECT_NEAR(2.7745274082080154, quantitativeCheckResult5[initialState], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+TEST(NativeCtmcCslModelCheckerTest, EmbeddedMultipleTimeBounds) {
+    // Set the PRISM compatibility mode temporarily. It is set to its old value once the returned object is destructed.
+    std::unique_ptr<storm::settings::SettingMemento> enablePrismCompatibility = storm::settings::mutableIOSettings().overridePrismCompatibilityMode(true);
+    
+    // Parse the model description.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/embedded2.sm");
+    storm::parser::FormulaParser formulaParser(program);
+    
+    // Build the model.
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildAllLabels();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    ASSERT_EQ(storm::models::ModelType::Ctmc, model->getType());
+    std::shared_ptr<storm::models::sparse::Ctmc<double>> ctmc = model->as<storm::models::sparse::Ctmc<double>>();
+    uint_fast64_t initialState = *ctmc->getInitialStates().begin();
+    
+    // Create model checker.
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> modelchecker(*ctmc, std::make_unique<storm::solver::NativeLinearEquationSolverFactory<double>>());
+    
+    // The bound of the formula itself is replaced by the given ones.
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [ !\"down\" U<=1 \"fail_io\"]");
+    std::vector<double> timeBounds = {10000, 0, 100, 2500};
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> checkResults = modelchecker.computeBoundedUntilProbabilitiesForTimeBounds(formula->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula(), timeBounds);
+    ASSERT_EQ(timeBounds.size(), checkResults.size());
+    
+    EXPECT_NEAR(0.001556839327673734, checkResults[0]->asExplicitQuantitativeCheckResult<double>()[initialState], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    EXPECT_EQ(0.0, checkResults[1]->asExplicitQuantitativeCheckResult<double>()[initialState]);
+    
+    // All results need to coincide with the ones obtained for the individual bounds.
+    for (uint_fast64_t index = 0; index < timeBounds.size(); ++index) {
+        std::unique_ptr<storm::modelchecker::CheckResult> checkResult = modelchecker.check(*formulaParser.parseSingleFormulaFromString("P=? [ !\"down\" U<=" + std::to_string(timeBounds[index]) + " \"fail_io\"]"));
+        storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& expectedResult = checkResult->asExplicitQuantitativeCheckResult<double>();
+        storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& result = checkResults[index]->asExplicitQuantitativeCheckResult<double>();
+        for (uint_fast64_t state = 0; state < ctmc->getNumberOfStates(); ++state) {
+            EXPECT_NEAR(expectedResult[state], result[state], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+        }
+    }
+}
+
 TEST(NativeCtmcCslModelCheckerTest, Polling) {
     // Set the PRISM compatibility mode temporarily. It is set to its old value once the returned object is destructed.
     std::unique_ptr<storm::settings::SettingMemento> enablePrismCompatibility = storm::settings::mutableIOSettings().overridePrismCompatibilityMode(true);
@@ -116,6 +116,50 @@ TEST(NativeHybridMdpPrctlModelCheckerTest, Dice_Cudd) {
     EXPECT_NEAR(7.3333294987678528, quantitativeResult8.getMax(), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
 }
 
+TEST(NativeHybridMdpPrctlModelCheckerTest, ExplicitTransitionSubmatrix_Cudd) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program);
+    ASSERT_EQ(model->getType(), storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>>();
+    
+    // The explicit transition matrix is translated once and matches the translation of the symbolic matrix.
+    storm::dd::Odd odd = mdp->getReachableStates().createOdd();
+    EXPECT_TRUE(mdp->isExplicitTransitionMatrixWithinMemoryBudget());
+    std::shared_ptr<storm::storage::SparseMatrix<double> const> explicitMatrix = mdp->getExplicitTransitionMatrix();
+    EXPECT_TRUE(mdp->getTransitionMatrix().toMatrix(mdp->getNondeterminismVariables(), odd, odd) == *explicitMatrix);
+    EXPECT_EQ(explicitMatrix, mdp->getExplicitTransitionMatrix());
+    
+    // Submatrices are obtained by filtering and reused for the same set of states.
+    storm::dd::Bdd<storm::dd::DdType::CUDD> states = mdp->getReachableStates() && !mdp->getStates("done");
+    std::shared_ptr<storm::storage::SparseMatrix<double> const> submatrixPointer = mdp->getExplicitTransitionSubmatrix(states);
+    storm::storage::SparseMatrix<double> const& submatrix = *submatrixPointer;
+    EXPECT_EQ(states.getNonZeroCount(), submatrix.getRowGroupCount());
+    EXPECT_EQ(states.getNonZeroCount(), submatrix.getColumnCount());
+    EXPECT_EQ(submatrixPointer, mdp->getExplicitTransitionSubmatrix(states));
+    
+    // Submatrices that were dropped by the model stay valid for their holders.
+    storm::storage::SparseMatrix<double> submatrixCopy = submatrix;
+    mdp->setExplicitRepresentationMemoryBudget(0);
+    EXPECT_FALSE(mdp->isExplicitTransitionMatrixWithinMemoryBudget());
+    EXPECT_TRUE(submatrixCopy == submatrix);
+    std::shared_ptr<storm::storage::SparseMatrix<double> const> uncachedSubmatrix = mdp->getExplicitTransitionSubmatrix(states);
+    EXPECT_NE(submatrixPointer, uncachedSubmatrix);
+    EXPECT_NE(uncachedSubmatrix, mdp->getExplicitTransitionSubmatrix(states));
+    EXPECT_TRUE(submatrix == *uncachedSubmatrix);
+    mdp->setExplicitRepresentationMemoryBudget(storm::models::symbolic::NondeterministicModel<storm::dd::DdType::CUDD>::DEFAULT_EXPLICIT_REPRESENTATION_MEMORY_BUDGET);
+    
+    // The submatrix coincides with the translation of the symbolic submatrix.
+    storm::dd::Odd subOdd = states.createOdd();
+    storm::dd::Add<storm::dd::DdType::CUDD, double> statesAdd = states.template toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::CUDD, double> symbolicSubmatrix = mdp->getTransitionMatrix() * statesAdd;
+    std::vector<uint_fast64_t> rowGroupSizes = symbolicSubmatrix.notZero().existsAbstract(mdp->getColumnVariables()).template toAdd<uint_fast64_t>().sumAbstract(mdp->getNondeterminismVariables()).toVector(subOdd);
+    symbolicSubmatrix *= statesAdd.swapVariables(mdp->getRowColumnMetaVariablePairs());
+    std::pair<storm::storage::SparseMatrix<double>, std::vector<double>> explicitRepresentation = symbolicSubmatrix.toMatrixVector(mdp->getManager().template getAddZero<double>(), std::move(rowGroupSizes), mdp->getNondeterminismVariables(), subOdd, subOdd);
+    EXPECT_TRUE(explicitRepresentation.first == submatrix);
+}
+
 TEST(NativeHybridMdpPrctlModelCheckerTest, Dice_Sylvan) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
     storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
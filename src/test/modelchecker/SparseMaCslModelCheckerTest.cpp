@@ -0,0 +1,94 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <cmath>
+#include <functional>
+
+#include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/GeneralSettings.h"
+
+namespace {
+    // Creates a Markov automaton in which the initial (Markovian) state moves to a probabilistic state that chooses
+    // between an exponentially distributed delay with rate 1 and an Erlang distributed delay with two phases of rate
+    // 4 before reaching the goal state. For small remaining times, the former is preferable, for large ones the latter.
+    storm::storage::SparseMatrix<double> createMatrix(std::vector<double>& exitRates, storm::storage::BitVector& markovianStates, storm::storage::BitVector& goalStates) {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(7, 6, 7, true, true, 6);
+        matrixBuilder.newRowGroup(0);
+        matrixBuilder.addNextValue(0, 1, 1.0);
+        matrixBuilder.newRowGroup(1);
+        matrixBuilder.addNextValue(1, 2, 1.0);
+        matrixBuilder.addNextValue(2, 3, 1.0);
+        matrixBuilder.newRowGroup(3);
+        matrixBuilder.addNextValue(3, 4, 1.0);
+        matrixBuilder.newRowGroup(4);
+        matrixBuilder.addNextValue(4, 5, 1.0);
+        matrixBuilder.newRowGroup(5);
+        matrixBuilder.addNextValue(5, 4, 1.0);
+        matrixBuilder.newRowGroup(6);
+        matrixBuilder.addNextValue(6, 4, 1.0);
+        
+        // States 3 and 5 are the two phases of the Erlang distribution and state 4 is the (absorbing) goal state.
+        exitRates = {1.0, 0.0, 1.0, 4.0, 1.0, 4.0};
+        markovianStates = storm::storage::BitVector(6, std::vector<uint_fast64_t>({0, 2, 3, 4, 5}));
+        goalStates = storm::storage::BitVector(6, std::vector<uint_fast64_t>({4}));
+        return matrixBuilder.build();
+    }
+    
+    // Integrates the given function over [0, bound] using Simpson's rule.
+    double integrate(std::function<double (double)> const& function, double bound) {
+        uint_fast64_t const numberOfIntervals = 10000;
+        double stepSize = bound / numberOfIntervals;
+        double result = function(0) + function(bound);
+        for (uint_fast64_t index = 1; index < numberOfIntervals; ++index) {
+            result += (index % 2 == 1 ? 4 : 2) * function(index * stepSize);
+        }
+        return result * stepSize / 3;
+    }
+}
+
+TEST(SparseMaCslModelCheckerTest, UnifPlusTimeDependentScheduler) {
+    std::vector<double> exitRates;
+    storm::storage::BitVector markovianStates;
+    storm::storage::BitVector goalStates;
+    storm::storage::SparseMatrix<double> matrix = createMatrix(exitRates, markovianStates, goalStates);
+    storm::solver::GeneralMinMaxLinearEquationSolverFactory<double> factory;
+    
+    std::function<double (double)> exponential = [] (double time) { return 1 - std::exp(-time); };
+    std::function<double (double)> erlang = [] (double time) { return 1 - std::exp(-4 * time) * (1 + 4 * time); };
+    double const timeBound = 1.0;
+    double maxValue = integrate([&] (double time) { return std::exp(-time) * std::max(exponential(timeBound - time), erlang(timeBound - time)); }, timeBound);
+    double minValue = integrate([&] (double time) { return std::exp(-time) * std::min(exponential(timeBound - time), erlang(timeBound - time)); }, timeBound);
+    double precision = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision();
+    
+    std::vector<double> result = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper<double>::computeBoundedUntilProbabilitiesUnifPlus(storm::OptimizationDirection::Maximize, matrix, exitRates, markovianStates, goalStates, std::make_pair(0.0, timeBound), factory);
+    EXPECT_NEAR(maxValue, result[0], 10 * precision);
+    EXPECT_NEAR(std::max(exponential(timeBound), erlang(timeBound)), result[1], 10 * precision);
+    EXPECT_NEAR(erlang(timeBound), result[3], 10 * precision);
+    EXPECT_EQ(1.0, result[4]);
+    
+    result = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper<double>::computeBoundedUntilProbabilitiesUnifPlus(storm::OptimizationDirection::Minimize, matrix, exitRates, markovianStates, goalStates, std::make_pair(0.0, timeBound), factory);
+    EXPECT_NEAR(minValue, result[0], 10 * precision);
+    EXPECT_NEAR(std::min(exponential(timeBound), erlang(timeBound)), result[1], 10 * precision);
+}
+
+TEST(SparseMaCslModelCheckerTest, UnifPlusTimeInterval) {
+    std::vector<double> exitRates;
+    storm::storage::BitVector markovianStates;
+    storm::storage::BitVector goalStates;
+    storm::storage::SparseMatrix<double> matrix = createMatrix(exitRates, markovianStates, goalStates);
+    storm::solver::GeneralMinMaxLinearEquationSolverFactory<double> factory;
+    
+    // As the goal state is absorbing, reaching it within [0.5, 1.5] is the same as reaching it within [0, 1.5].
+    std::vector<double> intervalResult = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper<double>::computeBoundedUntilProbabilitiesUnifPlus(storm::OptimizationDirection::Maximize, matrix, exitRates, markovianStates, goalStates, std::make_pair(0.5, 1.5), factory);
+    std::vector<double> result = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper<double>::computeBoundedUntilProbabilitiesUnifPlus(storm::OptimizationDirection::Maximize, matrix, exitRates, markovianStates, goalStates, std::make_pair(0.0, 1.5), factory);
+    double precision = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision();
+    EXPECT_NEAR(1 - std::exp(-1.5), intervalResult[2], 10 * precision);
+    EXPECT_NEAR(1 - std::exp(-6.0) * 7.0, intervalResult[3], 10 * precision);
+    for (uint_fast64_t state = 0; state < result.size(); ++state) {
+        EXPECT_NEAR(result[state], intervalResult[state], 10 * precision);
+    }
+}
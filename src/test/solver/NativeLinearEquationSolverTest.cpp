@@ -34,6 +34,34 @@ TEST(NativeLinearEquationSolver, SolveWithStandardOptions) {
     ASSERT_LT(std::abs(x[2] - (-1)), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
 }
 
+TEST(NativeLinearEquationSolver, SolveWithJacobiOnCompactMatrix) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 4));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, -1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, -5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, -1));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, 2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 4));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    std::vector<double> x(3);
+    std::vector<double> b = {11, -16, 1};
+    
+    storm::solver::NativeLinearEquationSolverSettings<double> settings;
+    settings.setSolutionMethod(storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::Jacobi);
+    settings.setUseCompactMatrix(true);
+    storm::solver::NativeLinearEquationSolver<double> solver(A, settings);
+    ASSERT_NO_THROW(solver.solveEquations(x, b));
+    ASSERT_LT(std::abs(x[0] - 1), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    ASSERT_LT(std::abs(x[1] - 3), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    ASSERT_LT(std::abs(x[2] - (-1)), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+}
+
 TEST(NativeLinearEquationSolver, MatrixVectorMultiplication) {
     ASSERT_NO_THROW(storm::storage::SparseMatrixBuilder<double> builder);
     storm::storage::SparseMatrixBuilder<double> builder;
@@ -56,3 +84,24 @@ TEST(NativeLinearEquationSolver, MatrixVectorMultiplication) {
     ASSERT_NO_THROW(solver.repeatedMultiply(x, nullptr, 4));
     ASSERT_LT(std::abs(x[0] - 1), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
 }
+
+TEST(NativeLinearEquationSolver, SolveSound) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, -0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, 1));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    std::vector<double> x(2);
+    std::vector<double> b = {0.05, 0.2};
+    
+    storm::solver::NativeLinearEquationSolverSettings<double> settings;
+    settings.setForceSoundness(true);
+    storm::solver::NativeLinearEquationSolver<double> solver(A, settings);
+    solver.setBounds(0.0, 1.0);
+    ASSERT_TRUE(solver.solveEquations(x, b));
+    ASSERT_LE(std::abs(x[0] - 0.5), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    ASSERT_LE(std::abs(x[1] - 0.45), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+}
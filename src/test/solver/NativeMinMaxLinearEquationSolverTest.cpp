@@ -90,3 +90,195 @@ TEST(NativeMinMaxLinearEquationSolver, SolveWithPolicyIteration) {
 	ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
 	ASSERT_LT(std::abs(x[0] - 0.99), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
 }
+
+TEST(NativeMinMaxLinearEquationSolver, SolveWithGaussSeidel) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 0.5));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(4, 3, 3));
+    
+    std::vector<double> b = {0.0, 0.25, 0.25, 1.0};
+    
+    for (bool useTopologicalOrder : {false, true}) {
+        std::vector<double> x(3);
+        
+        auto factory = storm::solver::NativeMinMaxLinearEquationSolverFactory<double>();
+        factory.getSettings().setSolutionMethod(storm::solver::StandardMinMaxLinearEquationSolverSettings<double>::SolutionMethod::GaussSeidel);
+        factory.getSettings().setUseTopologicalOrder(useTopologicalOrder);
+        auto solver = factory.create(A);
+        
+        ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Minimize, x, b));
+        ASSERT_LT(std::abs(x[0] - 0.375), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+        ASSERT_LT(std::abs(x[1] - 0.75), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+        ASSERT_LT(std::abs(x[2] - 1.0), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+        
+        ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
+        ASSERT_LT(std::abs(x[0] - 0.5), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    }
+}
+
+TEST(NativeMinMaxLinearEquationSolver, SolveWithMixedPrecision) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 0.5));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(4, 3, 3));
+    
+    std::vector<double> b = {0.0, 0.25, 0.25, 1.0};
+    std::vector<double> x(3);
+    
+    auto factory = storm::solver::NativeMinMaxLinearEquationSolverFactory<double>();
+    factory.getSettings().setSolutionMethod(storm::solver::StandardMinMaxLinearEquationSolverSettings<double>::SolutionMethod::ValueIteration);
+    factory.getSettings().setUseMixedPrecision(true);
+    factory.getSettings().setPrecision(1e-10);
+    auto solver = factory.create(A);
+    
+    // The result needs to be more precise than what can be achieved in single precision.
+    ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Minimize, x, b));
+    ASSERT_LT(std::abs(x[0] - 0.375), 1e-8);
+    ASSERT_LT(std::abs(x[1] - 0.75), 1e-8);
+    ASSERT_LT(std::abs(x[2] - 1.0), 1e-8);
+    
+    ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
+    ASSERT_LT(std::abs(x[0] - 0.5), 1e-8);
+}
+
+TEST(NativeMinMaxLinearEquationSolver, SolveWithCompactMatrix) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 0.5));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(4, 3, 3));
+    
+    std::vector<double> b = {0.0, 0.25, 0.25, 1.0};
+    std::vector<double> x(3);
+    
+    // The solver owns the matrix, so value iteration only keeps the compact copy.
+    auto factory = storm::solver::NativeMinMaxLinearEquationSolverFactory<double>(true);
+    factory.getSettings().setSolutionMethod(storm::solver::StandardMinMaxLinearEquationSolverSettings<double>::SolutionMethod::ValueIteration);
+    factory.getSettings().setUseCompactMatrix(true);
+    auto solver = factory.create(storm::storage::SparseMatrix<double>(A));
+    
+    ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Minimize, x, b));
+    ASSERT_LT(std::abs(x[0] - 0.375), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    ASSERT_LT(std::abs(x[1] - 0.75), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    ASSERT_LT(std::abs(x[2] - 1.0), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    EXPECT_EQ(0ull, solver->getScheduler()->getChoice(0));
+    
+    // Methods that need the full matrix restore it from the compact copy.
+    x = {0, 0, 0};
+    ASSERT_NO_THROW(solver->repeatedMultiply(storm::OptimizationDirection::Maximize, x, &b, 1));
+    ASSERT_LT(std::abs(x[0] - 0.25), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    
+    auto& standardSolver = dynamic_cast<storm::solver::StandardMinMaxLinearEquationSolver<double>&>(*solver);
+    storm::solver::StandardMinMaxLinearEquationSolverSettings<double> settings = standardSolver.getSettings();
+    settings.setSolutionMethod(storm::solver::StandardMinMaxLinearEquationSolverSettings<double>::SolutionMethod::GaussSeidel);
+    standardSolver.setSettings(settings);
+    ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
+    ASSERT_LT(std::abs(x[0] - 0.5), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+}
+
+TEST(NativeMinMaxLinearEquationSolver, SolveSound) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 0.9));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 0.5));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(4, 3, 3));
+    
+    std::vector<double> x(3);
+    std::vector<double> b = {0.0, 0.05, 0.25, 1.0};
+    
+    auto factory = storm::solver::NativeMinMaxLinearEquationSolverFactory<double>();
+    factory.getSettings().setForceSoundness(true);
+    auto solver = factory.create(A);
+    solver->setBounds(0.0, 1.0);
+    
+    ASSERT_TRUE(solver->solveEquations(storm::OptimizationDirection::Minimize, x, b));
+    ASSERT_LE(std::abs(x[0] - 0.375), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    ASSERT_LE(std::abs(x[1] - 0.75), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    
+    ASSERT_TRUE(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
+    ASSERT_LE(std::abs(x[0] - 0.5), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+}
+
+TEST(NativeMinMaxLinearEquationSolver, SolveSoundWithEndComponent) {
+    // The first choices of both states form an end component, so maximizing requires leaving it via the second
+    // choice of the second state.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 0.7));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, 1.0));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(4, 2, 2));
+    
+    std::vector<double> x(2);
+    std::vector<double> b = {0.0, 0.3, 0.0, 0.6};
+    
+    auto factory = storm::solver::NativeMinMaxLinearEquationSolverFactory<double>();
+    factory.getSettings().setForceSoundness(true);
+    auto solver = factory.create(A);
+    solver->setBounds(0.0, 1.0);
+    solver->setTrackScheduler(true);
+    
+    ASSERT_TRUE(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
+    ASSERT_LE(std::abs(x[0] - 0.6), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    ASSERT_LE(std::abs(x[1] - 0.6), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    std::unique_ptr<storm::storage::TotalScheduler> scheduler = solver->getScheduler();
+    ASSERT_EQ(0ull, scheduler->getChoice(0));
+    ASSERT_EQ(1ull, scheduler->getChoice(1));
+}
+
+TEST(NativeMinMaxLinearEquationSolver, SolveWithPolicyIterationChangingRows) {
+    // The choices of the first state have different numbers of entries, so the inner system can only be patched
+    // in place for some of the scheduler changes.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 0.9));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, 0.2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 0.7));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    ASSERT_NO_THROW(builder.addNextValue(3, 2, 0.5));
+    ASSERT_NO_THROW(builder.newRowGroup(4));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(5, 3, 3));
+    
+    std::vector<double> x(3);
+    std::vector<double> b = {0.0, 0.05, 0.0, 0.25, 1.0};
+    
+    auto factory = storm::solver::NativeMinMaxLinearEquationSolverFactory<double>();
+    factory.getSettings().setSolutionMethod(storm::solver::StandardMinMaxLinearEquationSolverSettings<double>::SolutionMethod::PolicyIteration);
+    auto solver = factory.create(A);
+    
+    ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Minimize, x, b));
+    ASSERT_LT(std::abs(x[0] - 0.375), 1e-5);
+    ASSERT_LT(std::abs(x[1] - 0.75), 1e-5);
+    
+    ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
+    ASSERT_LT(std::abs(x[0] - 0.85), 1e-5);
+}
@@ -0,0 +1,89 @@
+#include "gtest/gtest.h"
+#include "test/storm-test-helper.h"
+#include "storm-config.h"
+
+#include <map>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
+#include "storm/solver/stateelimination/ParallelStateEliminator.h"
+#include "storm/utility/stateelimination.h"
+#include "storm/utility/parallel.h"
+
+namespace {
+    // Creates a DTMC in which every state moves to two other states and with probability 0.2 either to the target
+    // or to some sink (both of which are not part of the matrix).
+    storm::storage::SparseMatrix<double> createMatrix(uint_fast64_t numberOfStates, std::vector<double>& oneStepProbabilities) {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(numberOfStates, numberOfStates);
+        oneStepProbabilities = std::vector<double>(numberOfStates);
+        for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+            std::map<uint_fast64_t, double> successors;
+            successors[(state + 1) % numberOfStates] += 0.5;
+            successors[(7 * state + 3) % numberOfStates] += 0.3;
+            for (auto const& successor : successors) {
+                matrixBuilder.addNextValue(state, successor.first, successor.second);
+            }
+            oneStepProbabilities[state] = state % 3 == 0 ? 0.2 : 0.0;
+        }
+        return matrixBuilder.build();
+    }
+}
+
+TEST(ParallelStateEliminator, MinimumDegreeOrder) {
+    // A star whose center has many predecessors and successors.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(6, 6);
+    matrixBuilder.addNextValue(0, 1, 0.25);
+    matrixBuilder.addNextValue(0, 2, 0.25);
+    matrixBuilder.addNextValue(0, 3, 0.25);
+    matrixBuilder.addNextValue(0, 4, 0.25);
+    for (uint_fast64_t leaf = 1; leaf < 5; ++leaf) {
+        matrixBuilder.addNextValue(leaf, 0, 0.5);
+        matrixBuilder.addNextValue(leaf, 5, 0.5);
+    }
+    matrixBuilder.addNextValue(5, 5, 1.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose());
+
+    storm::storage::BitVector states(6, true);
+    states.set(5, false);
+    std::vector<storm::storage::sparse::state_type> order = storm::utility::stateelimination::computeMinimumDegreeOrder(flexibleMatrix, flexibleBackwardTransitions, states);
+
+    // Eliminating the leaves first only creates self-loops of the center. Once a single leaf is left, the center is
+    // as cheap as the leaf and is picked due to its smaller index.
+    std::vector<storm::storage::sparse::state_type> expectedOrder = {1, 2, 3, 0, 4};
+    EXPECT_EQ(expectedOrder, order);
+}
+
+TEST(ParallelStateEliminator, SameResultAsSequentialElimination) {
+    uint_fast64_t const numberOfStates = 500;
+    std::vector<double> oneStepProbabilities;
+    storm::storage::SparseMatrix<double> matrix = createMatrix(numberOfStates, oneStepProbabilities);
+    storm::storage::BitVector initialStates(numberOfStates, std::vector<uint_fast64_t>({0}));
+    storm::storage::BitVector statesToEliminate = ~initialStates;
+
+    storm::storage::FlexibleSparseMatrix<double> sequentialMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> sequentialBackwardTransitions(matrix.transpose());
+    std::vector<storm::storage::sparse::state_type> order = storm::utility::stateelimination::computeMinimumDegreeOrder(sequentialMatrix, sequentialBackwardTransitions, statesToEliminate);
+    ASSERT_EQ(numberOfStates - 1, order.size());
+
+    std::vector<double> sequentialValues = oneStepProbabilities;
+    storm::solver::stateelimination::PrioritizedStateEliminator<double> sequentialEliminator(sequentialMatrix, sequentialBackwardTransitions, order, sequentialValues);
+    sequentialEliminator.eliminateAll(true);
+    sequentialEliminator.eliminateState(0, false);
+
+    storm::test::ThreadCountGuard threadCountGuard(4);
+    storm::storage::FlexibleSparseMatrix<double> parallelMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> parallelBackwardTransitions(matrix.transpose());
+    std::vector<double> parallelValues = oneStepProbabilities;
+    storm::solver::stateelimination::ParallelStateEliminator<double> parallelEliminator(parallelMatrix, parallelBackwardTransitions, order, parallelValues);
+    parallelEliminator.eliminateAll(initialStates);
+    parallelEliminator.eliminateState(0, false);
+
+    EXPECT_LT(parallelEliminator.getNumberOfBatches(), order.size());
+    EXPECT_NEAR(sequentialValues[0], parallelValues[0], 1e-9);
+    EXPECT_LT(0.0, parallelValues[0]);
+    EXPECT_TRUE(parallelMatrix.getRow(1).empty());
+}
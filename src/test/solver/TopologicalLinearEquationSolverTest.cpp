@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+#include "test/storm-test-helper.h"
+#include "storm-config.h"
+
+#include "storm/solver/TopologicalLinearEquationSolver.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/settings/modules/NativeEquationSolverSettings.h"
+
+TEST(TopologicalLinearEquationSolver, Solve) {
+    // The equation system (I - P) * x = b of a DTMC with the SCCs {4}, {2}, {1, 3} and {0}.
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 1));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, -0.5));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, -0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, 1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 3, -0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 4, -0.25));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(2, 4, -0.5));
+    ASSERT_NO_THROW(builder.addNextValue(3, 1, -0.5));
+    ASSERT_NO_THROW(builder.addNextValue(3, 3, 1));
+    ASSERT_NO_THROW(builder.addNextValue(4, 4, 1));
+
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    std::vector<double> x(5);
+    std::vector<double> b = {0, 0, 0, 0.5, 1};
+
+    ASSERT_NO_THROW(storm::solver::TopologicalLinearEquationSolver<double> solver(A));
+
+    storm::solver::TopologicalLinearEquationSolver<double> solver(A);
+    ASSERT_NO_THROW(solver.solveEquations(x, b));
+    double precision = storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision();
+    ASSERT_LT(std::abs(x[0] - 5.0 / 6.0), precision);
+    ASSERT_LT(std::abs(x[1] - 2.0 / 3.0), precision);
+    ASSERT_LT(std::abs(x[2] - 1), precision);
+    ASSERT_LT(std::abs(x[3] - 5.0 / 6.0), precision);
+    ASSERT_LT(std::abs(x[4] - 1), precision);
+}
+
+TEST(TopologicalLinearEquationSolver, SolveIndependentSccsInParallel) {
+    // Many copies of an SCC with two states that do not depend on each other.
+    uint_fast64_t numberOfCopies = 2000;
+    storm::storage::SparseMatrixBuilder<double> builder;
+    std::vector<double> b;
+    for (uint_fast64_t copy = 0; copy < numberOfCopies; ++copy) {
+        uint_fast64_t first = 2 * copy;
+        ASSERT_NO_THROW(builder.addNextValue(first, first, 1));
+        ASSERT_NO_THROW(builder.addNextValue(first, first + 1, -0.5));
+        ASSERT_NO_THROW(builder.addNextValue(first + 1, first, -0.5));
+        ASSERT_NO_THROW(builder.addNextValue(first + 1, first + 1, 1));
+        b.push_back(0.25);
+        b.push_back(0.5);
+    }
+
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    double precision = storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision();
+    for (uint_fast64_t threads : {1, 4}) {
+        storm::test::ThreadCountGuard threadCountGuard(threads);
+        std::vector<double> x(A.getRowCount());
+        storm::solver::TopologicalLinearEquationSolver<double> solver(A);
+        ASSERT_NO_THROW(solver.solveEquations(x, b));
+        for (uint_fast64_t copy = 0; copy < numberOfCopies; ++copy) {
+            ASSERT_LT(std::abs(x[2 * copy] - 2.0 / 3.0), precision);
+            ASSERT_LT(std::abs(x[2 * copy + 1] - 5.0 / 6.0), precision);
+        }
+    }
+}
+
+TEST(TopologicalLinearEquationSolver, MatrixVectorMultiplication) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(0, 4, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 4, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(2, 3, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(2, 4, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(3, 4, 1));
+    ASSERT_NO_THROW(builder.addNextValue(4, 4, 1));
+
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    std::vector<double> x(5);
+    x[4] = 1;
+
+    storm::solver::TopologicalLinearEquationSolver<double> solver(A);
+    ASSERT_NO_THROW(solver.repeatedMultiply(x, nullptr, 4));
+    ASSERT_LT(std::abs(x[0] - 1), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+}
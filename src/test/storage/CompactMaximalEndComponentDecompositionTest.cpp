@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactMaximalEndComponentDecomposition.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+    // Creates an MDP in which the states {0}, {1, 2}, {3, 4}, {6}, {9}, {10, 11} and {13} form MECs. Finding {10, 11}
+    // requires to remove state 12 from its SCC and to refine the remaining candidate.
+    storm::storage::SparseMatrix<double> createMatrix() {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+        matrixBuilder.newRowGroup(0);
+        matrixBuilder.addNextValue(0, 1, 1.0);
+        matrixBuilder.addNextValue(1, 0, 1.0);
+        matrixBuilder.newRowGroup(2);
+        matrixBuilder.addNextValue(2, 2, 1.0);
+        matrixBuilder.newRowGroup(3);
+        matrixBuilder.addNextValue(3, 1, 0.5);
+        matrixBuilder.addNextValue(3, 3, 0.5);
+        matrixBuilder.addNextValue(4, 1, 1.0);
+        matrixBuilder.newRowGroup(5);
+        matrixBuilder.addNextValue(5, 4, 1.0);
+        matrixBuilder.newRowGroup(6);
+        matrixBuilder.addNextValue(6, 3, 1.0);
+        matrixBuilder.addNextValue(7, 5, 1.0);
+        matrixBuilder.newRowGroup(8);
+        matrixBuilder.addNextValue(8, 5, 0.5);
+        matrixBuilder.addNextValue(8, 6, 0.5);
+        matrixBuilder.newRowGroup(9);
+        matrixBuilder.addNextValue(9, 6, 1.0);
+        matrixBuilder.newRowGroup(10);
+        matrixBuilder.addNextValue(10, 8, 1.0);
+        matrixBuilder.newRowGroup(11);
+        matrixBuilder.addNextValue(11, 7, 0.5);
+        matrixBuilder.addNextValue(11, 9, 0.5);
+        matrixBuilder.newRowGroup(12);
+        matrixBuilder.addNextValue(12, 9, 1.0);
+        matrixBuilder.newRowGroup(13);
+        matrixBuilder.addNextValue(13, 11, 1.0);
+        matrixBuilder.newRowGroup(14);
+        matrixBuilder.addNextValue(14, 10, 1.0);
+        matrixBuilder.addNextValue(15, 10, 0.5);
+        matrixBuilder.addNextValue(15, 12, 0.5);
+        matrixBuilder.newRowGroup(16);
+        matrixBuilder.addNextValue(16, 11, 0.5);
+        matrixBuilder.addNextValue(16, 13, 0.5);
+        matrixBuilder.newRowGroup(17);
+        matrixBuilder.addNextValue(17, 13, 1.0);
+        return matrixBuilder.build();
+    }
+}
+
+TEST(CompactMaximalEndComponentDecomposition, FullSystem) {
+    storm::storage::SparseMatrix<double> matrix = createMatrix();
+    storm::storage::CompactMaximalEndComponentDecomposition<double> decomposition(matrix, matrix.transpose(true));
+
+    ASSERT_EQ(7ul, decomposition.getNumberOfMecs());
+    std::vector<uint_fast64_t> expectedStates = {0, 1, 2, 3, 4, 6, 9, 10, 11, 13};
+    std::vector<uint_fast64_t> expectedMecOffsets = {0, 1, 3, 5, 6, 7, 9, 10};
+    std::vector<uint_fast64_t> expectedChoices = {1, 2, 4, 5, 6, 9, 12, 13, 14, 17};
+    std::vector<uint_fast64_t> expectedChoiceOffsets = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    EXPECT_EQ(expectedStates, decomposition.getStatesOrderedByMecs());
+    EXPECT_EQ(expectedMecOffsets, decomposition.getMecOffsets());
+    EXPECT_EQ(expectedChoices, decomposition.getChoices());
+    EXPECT_EQ(expectedChoiceOffsets, decomposition.getChoiceOffsets());
+
+    uint_fast64_t const noMec = storm::storage::CompactMaximalEndComponentDecomposition<double>::NO_MEC;
+    std::vector<uint_fast64_t> expectedMapping = {0, 1, 1, 2, 2, noMec, 3, noMec, noMec, 4, 5, 5, noMec, 6};
+    EXPECT_EQ(expectedMapping, decomposition.getStateToMecMapping());
+}
+
+TEST(CompactMaximalEndComponentDecomposition, Subsystem) {
+    storm::storage::SparseMatrix<double> matrix = createMatrix();
+    storm::storage::BitVector subsystem(matrix.getRowGroupCount(), true);
+    subsystem.set(3, false);
+    storm::storage::CompactMaximalEndComponentDecomposition<double> decomposition(matrix, matrix.transpose(true), subsystem);
+
+    ASSERT_EQ(6ul, decomposition.getNumberOfMecs());
+    std::vector<uint_fast64_t> expectedStates = {0, 1, 2, 6, 9, 10, 11, 13};
+    std::vector<uint_fast64_t> expectedMecOffsets = {0, 1, 3, 4, 5, 7, 8};
+    std::vector<uint_fast64_t> expectedChoices = {1, 2, 4, 9, 12, 13, 14, 17};
+    EXPECT_EQ(expectedStates, decomposition.getStatesOrderedByMecs());
+    EXPECT_EQ(expectedMecOffsets, decomposition.getMecOffsets());
+    EXPECT_EQ(expectedChoices, decomposition.getChoices());
+    EXPECT_EQ(storm::storage::CompactMaximalEndComponentDecomposition<double>::NO_MEC, decomposition.getMecIndex(4));
+}
+
+TEST(CompactMaximalEndComponentDecomposition, MaximalEndComponents) {
+    storm::storage::SparseMatrix<double> matrix = createMatrix();
+    storm::storage::MaximalEndComponentDecomposition<double> decomposition(matrix, matrix.transpose(true));
+
+    ASSERT_EQ(7ul, decomposition.size());
+    storm::storage::MaximalEndComponent const& mec = decomposition[1];
+    ASSERT_EQ(2ul, mec.getStateSet().size());
+    EXPECT_TRUE(mec.containsState(2));
+    EXPECT_FALSE(mec.containsState(3));
+    EXPECT_EQ(1ul, mec.getChoicesForState(2).size());
+    EXPECT_TRUE(mec.containsChoice(2, 4));
+    EXPECT_FALSE(mec.containsChoice(2, 3));
+    EXPECT_TRUE(decomposition[2].containsChoice(4, 6));
+    EXPECT_FALSE(decomposition[2].containsChoice(4, 7));
+    EXPECT_TRUE(decomposition[5].containsState(11));
+    EXPECT_FALSE(decomposition[5].containsChoice(11, 15));
+}
@@ -0,0 +1,153 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cmath>
+#include "test/storm-test-helper.h"
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/simd.h"
+
+TEST(CompactSparseMatrix, Creation) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(3, 4, 5);
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 1.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 3, 0.2));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    ASSERT_TRUE(storm::storage::CompactSparseMatrix<double>::isRepresentable(matrix));
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+    EXPECT_EQ(3ul, compactMatrix.getRowCount());
+    EXPECT_EQ(4ul, compactMatrix.getColumnCount());
+    EXPECT_EQ(5ul, compactMatrix.getEntryCount());
+    EXPECT_EQ(3ul, compactMatrix.getRowGroupCount());
+
+    std::vector<double> x = {1.0, 2.0, 3.0, 4.0};
+    std::vector<double> b = {0.5, 0.25, 0.125};
+    std::vector<double> result(3);
+    ASSERT_NO_THROW(compactMatrix.multiplyWithVector(x, result, &b));
+    EXPECT_NEAR(6.1, result[0], 1e-12);
+    EXPECT_NEAR(2.95, result[1], 1e-12);
+    EXPECT_NEAR(0.125, result[2], 1e-12);
+}
+
+TEST(CompactSparseMatrix, MultiplyWithVector) {
+    storm::storage::SparseMatrix<double> matrix = storm::test::createIrregularNondeterministicMatrix(2000);
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+
+    std::vector<double> x(matrix.getColumnCount());
+    for (uint_fast64_t index = 0; index < x.size(); ++index) {
+        x[index] = 0.5 + (index % 10) * 0.1;
+    }
+    std::vector<double> b(matrix.getRowCount(), 0.25);
+    std::vector<double> expectedResult(matrix.getRowCount());
+    ASSERT_NO_THROW(matrix.multiplyWithVector(x, expectedResult, &b));
+
+    for (uint_fast64_t threads : {1, 4}) {
+        storm::test::ThreadCountGuard threadCountGuard(threads);
+        std::vector<double> result(matrix.getRowCount());
+        ASSERT_NO_THROW(compactMatrix.multiplyWithVector(x, result, &b));
+        for (uint_fast64_t row = 0; row < result.size(); ++row) {
+            ASSERT_NEAR(expectedResult[row], result[row], 1e-12);
+        }
+    }
+}
+
+TEST(CompactSparseMatrix, MultiplyAndReduce) {
+    storm::storage::SparseMatrix<double> matrix = storm::test::createIrregularNondeterministicMatrix(2000);
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+    storm::storage::CompactSparseMatrix<float> singlePrecisionMatrix(matrix);
+
+    std::vector<double> x(matrix.getColumnCount());
+    for (uint_fast64_t index = 0; index < x.size(); ++index) {
+        x[index] = 0.5 + (index % 10) * 0.1;
+    }
+    std::vector<double> b(matrix.getRowCount());
+    for (uint_fast64_t index = 0; index < b.size(); ++index) {
+        b[index] = (index % 7) * 0.3;
+    }
+    std::vector<float> singlePrecisionX(x.begin(), x.end());
+    std::vector<float> singlePrecisionB(b.begin(), b.end());
+
+    for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+        std::vector<double> expectedResult(matrix.getRowGroupCount());
+        std::vector<uint_fast64_t> expectedChoices(matrix.getRowGroupCount());
+        ASSERT_NO_THROW(matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, expectedResult, &expectedChoices));
+
+        for (uint_fast64_t threads : {1, 4}) {
+            storm::test::ThreadCountGuard threadCountGuard(threads);
+            std::vector<double> result(matrix.getRowGroupCount());
+            std::vector<uint_fast64_t> choices(matrix.getRowGroupCount());
+            ASSERT_NO_THROW(compactMatrix.multiplyAndReduce(dir, x, &b, result, &choices));
+            std::vector<float> singlePrecisionResult(matrix.getRowGroupCount());
+            ASSERT_NO_THROW(singlePrecisionMatrix.multiplyAndReduce(dir, singlePrecisionX, &singlePrecisionB, singlePrecisionResult));
+            for (uint_fast64_t group = 0; group < result.size(); ++group) {
+                ASSERT_NEAR(expectedResult[group], result[group], 1e-12);
+                ASSERT_EQ(expectedChoices[group], choices[group]);
+                ASSERT_NEAR(expectedResult[group], singlePrecisionResult[group], 1e-3);
+            }
+        }
+    }
+}
+
+TEST(CompactSparseMatrix, VectorizedKernels) {
+    storm::storage::SparseMatrix<double> matrix = storm::test::createIrregularNondeterministicMatrix(2000);
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+
+    std::vector<double> x(matrix.getColumnCount());
+    for (uint_fast64_t index = 0; index < x.size(); ++index) {
+        x[index] = 0.5 + (index % 10) * 0.1;
+    }
+    std::vector<double> b(matrix.getRowCount());
+    for (uint_fast64_t index = 0; index < b.size(); ++index) {
+        b[index] = (index % 7) * 0.3;
+    }
+    std::vector<double> expectedMultiplyResult(matrix.getRowCount());
+    ASSERT_NO_THROW(matrix.multiplyWithVector(x, expectedMultiplyResult, &b));
+    std::vector<double> expectedResult(matrix.getRowGroupCount());
+    std::vector<uint_fast64_t> expectedChoices(matrix.getRowGroupCount());
+    ASSERT_NO_THROW(matrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), x, &b, expectedResult, &expectedChoices));
+
+    // Test all instruction sets that are supported by the machine running the test.
+    std::vector<storm::utility::simd::InstructionSet> instructionSets = {storm::utility::simd::InstructionSet::None};
+    storm::utility::simd::InstructionSet supportedInstructionSet = storm::utility::simd::getSupportedInstructionSet();
+    if (supportedInstructionSet != storm::utility::simd::InstructionSet::None) {
+        instructionSets.push_back(storm::utility::simd::InstructionSet::Avx2);
+    }
+    if (supportedInstructionSet == storm::utility::simd::InstructionSet::Avx512) {
+        instructionSets.push_back(storm::utility::simd::InstructionSet::Avx512);
+    }
+
+    // The kernels sum up the products in a different order, so we compare the values up to a small relative error
+    // and the choices only for groups in which the optimal choice is unique.
+    auto tolerance = [] (double value) { return 1e-12 * std::max(1.0, std::abs(value)); };
+    std::vector<bool> hasUniqueChoice(matrix.getRowGroupCount(), true);
+    for (uint_fast64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+        for (uint_fast64_t row = matrix.getRowGroupIndices()[group]; row < matrix.getRowGroupIndices()[group + 1]; ++row) {
+            if (row - matrix.getRowGroupIndices()[group] != expectedChoices[group] && std::abs(expectedMultiplyResult[row] - expectedResult[group]) <= 2 * tolerance(expectedResult[group])) {
+                hasUniqueChoice[group] = false;
+            }
+        }
+    }
+
+    for (auto instructionSet : instructionSets) {
+        storm::test::InstructionSetGuard instructionSetGuard(instructionSet);
+        std::vector<double> multiplyResult(matrix.getRowCount());
+        ASSERT_NO_THROW(compactMatrix.multiplyWithVector(x, multiplyResult, &b));
+        for (uint_fast64_t row = 0; row < multiplyResult.size(); ++row) {
+            ASSERT_NEAR(expectedMultiplyResult[row], multiplyResult[row], tolerance(expectedMultiplyResult[row]));
+            ASSERT_NEAR(expectedMultiplyResult[row], compactMatrix.multiplyRowWithVector(row, x) + b[row], tolerance(expectedMultiplyResult[row]));
+        }
+
+        std::vector<double> result(matrix.getRowGroupCount());
+        std::vector<uint_fast64_t> choices(matrix.getRowGroupCount());
+        ASSERT_NO_THROW(compactMatrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, x, &b, result, &choices));
+        for (uint_fast64_t group = 0; group < result.size(); ++group) {
+            ASSERT_NEAR(expectedResult[group], result[group], tolerance(expectedResult[group]));
+            if (hasUniqueChoice[group]) {
+                ASSERT_EQ(expectedChoices[group], choices[group]);
+            }
+        }
+    }
+}
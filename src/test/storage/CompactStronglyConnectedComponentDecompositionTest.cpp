@@ -0,0 +1,167 @@
+#include "gtest/gtest.h"
+#include "test/storm-test-helper.h"
+
+#include <algorithm>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/CompactStronglyConnectedComponentDecomposition.h"
+#include "storm/utility/parallel.h"
+
+namespace {
+    // Creates a matrix with a large SCC (the first half of the states), which is reachable from many small SCCs and
+    // trivial SCCs in the second half, and which in turn can reach the last SCC. If requested, some states get a
+    // second choice.
+    storm::storage::SparseMatrix<double> createMatrix(uint_fast64_t numberOfStates, bool nondeterministic) {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfStates, 0, false, nondeterministic);
+        uint_fast64_t giantSize = numberOfStates / 2;
+        uint_fast64_t row = 0;
+        uint_fast64_t random = 42;
+        auto nextRandom = [&random] () { random = random * 6364136223846793005ull + 1442695040888963407ull; return random >> 33; };
+
+        uint_fast64_t blockStart = giantSize;
+        uint_fast64_t blockSize = 1;
+        for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+            if (nondeterministic) {
+                matrixBuilder.newRowGroup(row);
+            }
+            std::vector<uint_fast64_t> successors;
+            if (state < giantSize) {
+                successors.push_back((state + 1) % giantSize);
+                successors.push_back(nextRandom() % giantSize);
+                if (state == giantSize / 3) {
+                    successors.push_back(numberOfStates - 1);
+                }
+            } else {
+                if (state == blockStart + blockSize) {
+                    blockStart = state;
+                    blockSize = std::min<uint_fast64_t>(1 + nextRandom() % 5, numberOfStates - state);
+                }
+                // The states of a block form a cycle, unless the block consists of a single state.
+                if (blockSize > 1) {
+                    successors.push_back(state + 1 < blockStart + blockSize ? state + 1 : blockStart);
+                }
+                if (state < numberOfStates - 1) {
+                    successors.push_back(nextRandom() % 2 == 0 ? nextRandom() % giantSize : std::min(numberOfStates - 1, blockStart + blockSize + nextRandom() % 100));
+                }
+            }
+            if (successors.empty()) {
+                successors.push_back(state);
+            }
+            std::sort(successors.begin(), successors.end());
+            successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+            for (auto successor : successors) {
+                matrixBuilder.addNextValue(row, successor, 1.0 / successors.size());
+            }
+            ++row;
+            if (nondeterministic && state % 7 == 0) {
+                matrixBuilder.addNextValue(row, state, 1.0);
+                ++row;
+            }
+        }
+        return matrixBuilder.build();
+    }
+
+    void checkDecomposition(storm::storage::SparseMatrix<double> const& matrix, storm::storage::BitVector const& subsystem) {
+        storm::storage::StronglyConnectedComponentDecomposition<double> expectedDecomposition(matrix, subsystem, false, false);
+        uint_fast64_t expectedTrivialSccs = expectedDecomposition.size() - storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, subsystem, true, false).size();
+        uint_fast64_t expectedBottomSccs = 0;
+        for (auto const& scc : expectedDecomposition) {
+            bool isBottom = true;
+            for (auto state : scc) {
+                for (auto const& entry : matrix.getRowGroup(state)) {
+                    isBottom &= !subsystem.get(entry.getColumn()) || scc.containsState(entry.getColumn());
+                }
+            }
+            expectedBottomSccs += isBottom ? 1 : 0;
+        }
+
+        std::vector<uint_fast64_t> sequentialMapping;
+        for (uint_fast64_t threads : {1, 4}) {
+            storm::test::ThreadCountGuard threadCountGuard(threads);
+            storm::storage::CompactStronglyConnectedComponentDecomposition<double> decomposition(matrix, subsystem);
+            ASSERT_EQ(expectedDecomposition.size(), decomposition.getNumberOfSccs());
+            ASSERT_EQ(subsystem.getNumberOfSetBits(), decomposition.getStatesOrderedBySccs().size());
+
+            // Every SCC must coincide with the SCC of the standard decomposition.
+            for (auto const& scc : expectedDecomposition) {
+                uint_fast64_t sccIndex = decomposition.getSccIndex(*scc.begin());
+                ASSERT_EQ(scc.size(), decomposition.getSccSize(sccIndex));
+                for (auto state : scc) {
+                    ASSERT_EQ(sccIndex, decomposition.getSccIndex(state));
+                }
+                ASSERT_TRUE(std::is_sorted(decomposition.begin(sccIndex), decomposition.end(sccIndex)));
+            }
+
+            // The SCCs must be in reverse topological order.
+            for (auto state : subsystem) {
+                for (auto const& entry : matrix.getRowGroup(state)) {
+                    if (subsystem.get(entry.getColumn())) {
+                        ASSERT_LE(decomposition.getSccIndex(entry.getColumn()), decomposition.getSccIndex(state));
+                    }
+                }
+            }
+            for (auto state : ~subsystem) {
+                ASSERT_EQ(storm::storage::CompactStronglyConnectedComponentDecomposition<double>::NO_SCC, decomposition.getSccIndex(state));
+            }
+
+            uint_fast64_t trivialSccs = 0;
+            uint_fast64_t bottomSccs = 0;
+            for (uint_fast64_t scc = 0; scc < decomposition.getNumberOfSccs(); ++scc) {
+                trivialSccs += decomposition.isTrivial(scc) ? 1 : 0;
+                bottomSccs += decomposition.isBottom(scc) ? 1 : 0;
+            }
+            EXPECT_EQ(expectedTrivialSccs, trivialSccs);
+            EXPECT_EQ(expectedBottomSccs, bottomSccs);
+
+            // The numbering must not depend on the number of threads.
+            if (threads == 1) {
+                sequentialMapping = decomposition.getStateToSccMapping();
+            } else {
+                EXPECT_EQ(sequentialMapping, decomposition.getStateToSccMapping());
+            }
+        }
+    }
+}
+
+TEST(CompactStronglyConnectedComponentDecomposition, SmallSystemFromMatrix) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(6, 6);
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 0.3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 5, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 2, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 1, 0.4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 2, 0.3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 3, 0.3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 4, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 3, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 4, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(5, 1, 1.0));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    storm::storage::CompactStronglyConnectedComponentDecomposition<double> decomposition(matrix);
+    ASSERT_EQ(4ul, decomposition.getNumberOfSccs());
+    std::vector<uint_fast64_t> expectedOffsets = {0, 2, 4, 5, 6};
+    std::vector<uint_fast64_t> expectedStates = {3, 4, 1, 2, 5, 0};
+    EXPECT_EQ(expectedOffsets, decomposition.getSccOffsets());
+    EXPECT_EQ(expectedStates, decomposition.getStatesOrderedBySccs());
+    EXPECT_TRUE(decomposition.isBottom(0));
+    EXPECT_FALSE(decomposition.isBottom(1));
+    EXPECT_TRUE(decomposition.isTrivial(2));
+    EXPECT_FALSE(decomposition.isTrivial(3));
+}
+
+TEST(CompactStronglyConnectedComponentDecomposition, CompareWithStandardDecomposition) {
+    storm::storage::SparseMatrix<double> matrix = createMatrix(20000, false);
+    checkDecomposition(matrix, storm::storage::BitVector(matrix.getRowGroupCount(), true));
+}
+
+TEST(CompactStronglyConnectedComponentDecomposition, Subsystem) {
+    storm::storage::SparseMatrix<double> matrix = createMatrix(20000, true);
+    storm::storage::BitVector subsystem(matrix.getRowGroupCount(), true);
+    for (uint_fast64_t state = 0; state < matrix.getRowGroupCount(); state += 17) {
+        subsystem.set(state, false);
+    }
+    checkDecomposition(matrix, storm::storage::BitVector(matrix.getRowGroupCount(), true));
+    checkDecomposition(matrix, subsystem);
+}
@@ -0,0 +1,68 @@
+#include "gtest/gtest.h"
+#include "storm/storage/QualitativeResultCache.h"
+
+TEST(QualitativeResultCache, ReuseResults) {
+    storm::storage::QualitativeResultCache cache;
+    storm::storage::BitVector phiStates(10, true);
+    storm::storage::BitVector psiStates(10, std::vector<uint_fast64_t>({3, 7}));
+    storm::storage::QualitativeResultCache::ResultType result(storm::storage::BitVector(10, std::vector<uint_fast64_t>({0})), psiStates);
+
+    uint_fast64_t computations = 0;
+    auto computeResult = [&] () { ++computations; return result; };
+    EXPECT_EQ(result, cache.getOrCompute(storm::storage::QualitativeResultCache::QueryType::Prob01, phiStates, psiStates, computeResult));
+    EXPECT_EQ(result, cache.getOrCompute(storm::storage::QualitativeResultCache::QueryType::Prob01, phiStates, psiStates, computeResult));
+    EXPECT_EQ(1ul, computations);
+    EXPECT_TRUE(cache.contains(storm::storage::QualitativeResultCache::QueryType::Prob01, phiStates, psiStates));
+
+    // Queries of a different type or with different states must not reuse the result.
+    EXPECT_FALSE(cache.contains(storm::storage::QualitativeResultCache::QueryType::Prob01Max, phiStates, psiStates));
+    cache.getOrCompute(storm::storage::QualitativeResultCache::QueryType::Prob01Max, phiStates, psiStates, computeResult);
+    psiStates.set(4);
+    EXPECT_FALSE(cache.contains(storm::storage::QualitativeResultCache::QueryType::Prob01, phiStates, psiStates));
+    cache.getOrCompute(storm::storage::QualitativeResultCache::QueryType::Prob01, phiStates, psiStates, computeResult);
+    EXPECT_EQ(3ul, computations);
+    EXPECT_EQ(3ul, cache.getNumberOfEntries());
+
+    cache.clear();
+    EXPECT_EQ(0ul, cache.getNumberOfEntries());
+}
+
+TEST(QualitativeResultCache, DropLeastRecentlyUsed) {
+    storm::storage::QualitativeResultCache cache;
+    storm::storage::BitVector phiStates(10, true);
+    auto computeResult = [] () { return storm::storage::QualitativeResultCache::ResultType(storm::storage::BitVector(10), storm::storage::BitVector(10)); };
+
+    std::vector<storm::storage::BitVector> psiStates;
+    for (uint_fast64_t state = 0; state < 3; ++state) {
+        psiStates.push_back(storm::storage::BitVector(10, std::vector<uint_fast64_t>({state})));
+    }
+    cache.getOrCompute(storm::storage::QualitativeResultCache::QueryType::Prob01Min, phiStates, psiStates[0], computeResult);
+    // All entries have the same size, so the budget suffices for two of them.
+    cache.setMemoryBudget(2 * cache.getSizeInBytes());
+    cache.getOrCompute(storm::storage::QualitativeResultCache::QueryType::Prob01Min, phiStates, psiStates[1], computeResult);
+    cache.getOrCompute(storm::storage::QualitativeResultCache::QueryType::Prob01Min, phiStates, psiStates[0], computeResult);
+    cache.getOrCompute(storm::storage::QualitativeResultCache::QueryType::Prob01Min, phiStates, psiStates[2], computeResult);
+
+    EXPECT_EQ(2ul, cache.getNumberOfEntries());
+    EXPECT_TRUE(cache.contains(storm::storage::QualitativeResultCache::QueryType::Prob01Min, phiStates, psiStates[0]));
+    EXPECT_FALSE(cache.contains(storm::storage::QualitativeResultCache::QueryType::Prob01Min, phiStates, psiStates[1]));
+    EXPECT_TRUE(cache.contains(storm::storage::QualitativeResultCache::QueryType::Prob01Min, phiStates, psiStates[2]));
+}
+
+TEST(QualitativeResultCache, MemoryBudget) {
+    storm::storage::QualitativeResultCache cache(0);
+    storm::storage::BitVector phiStates(10, true);
+    storm::storage::QualitativeResultCache::ResultType result(storm::storage::BitVector(10), phiStates);
+
+    // Results that exceed the budget on their own are returned, but not stored.
+    EXPECT_EQ(result, cache.getOrCompute(storm::storage::QualitativeResultCache::QueryType::Prob01, phiStates, phiStates, [&] () { return result; }));
+    EXPECT_EQ(0ul, cache.getNumberOfEntries());
+    EXPECT_EQ(0ul, cache.getSizeInBytes());
+
+    cache.setMemoryBudget(storm::storage::QualitativeResultCache::DEFAULT_MEMORY_BUDGET);
+    cache.getOrCompute(storm::storage::QualitativeResultCache::QueryType::Prob01, phiStates, phiStates, [&] () { return result; });
+    EXPECT_EQ(1ul, cache.getNumberOfEntries());
+    EXPECT_LT(0ul, cache.getSizeInBytes());
+    cache.setMemoryBudget(cache.getSizeInBytes() - 1);
+    EXPECT_EQ(0ul, cache.getNumberOfEntries());
+}
@@ -1,6 +1,9 @@
 #include "gtest/gtest.h"
+#include "test/storm-test-helper.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/BitVector.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/vector.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 
@@ -374,6 +377,63 @@ TEST(SparseMatrix, Submatrix) {
     ASSERT_TRUE(matrix4 == matrix5);
 }
 
+TEST(SparseMatrix, ReplaceRowsFromRowGroups) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 3, 0, true, true);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 2, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 1, 0.4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 2, 0.6));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 2, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 0, 0.5));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    
+    std::vector<uint_fast64_t> scheduler = {0, 0, 0};
+    storm::storage::SparseMatrix<double> submatrix = matrix.selectRowsFromRowGroups(scheduler, true);
+    submatrix.convertToEquationSystem();
+    
+    // The first row of the group has as many entries as the third one (once the diagonal entry is inserted).
+    scheduler[0] = 2;
+    ASSERT_TRUE(submatrix.replaceRowsFromRowGroups(matrix, scheduler, {0}, true));
+    storm::storage::SparseMatrix<double> expectedMatrix = matrix.selectRowsFromRowGroups(scheduler, true);
+    expectedMatrix.convertToEquationSystem();
+    ASSERT_TRUE(submatrix == expectedMatrix);
+    ASSERT_EQ(expectedMatrix.getNonzeroEntryCount(), submatrix.getNonzeroEntryCount());
+    
+    // The second row already contains the diagonal entry, so it has fewer entries and the remaining space is filled
+    // with a zero entry.
+    scheduler[0] = 1;
+    ASSERT_TRUE(submatrix.replaceRowsFromRowGroups(matrix, scheduler, {0}, true));
+    ASSERT_EQ(3ull, submatrix.getRow(0).getNumberOfEntries());
+    expectedMatrix = matrix.selectRowsFromRowGroups(scheduler, true);
+    expectedMatrix.convertToEquationSystem();
+    std::vector<double> x = {1.0, 2.0, 3.0};
+    std::vector<double> result(3);
+    std::vector<double> expectedResult(3);
+    submatrix.multiplyWithVector(x, result);
+    expectedMatrix.multiplyWithVector(x, expectedResult);
+    ASSERT_EQ(expectedResult, result);
+    ASSERT_EQ(expectedMatrix.getNonzeroEntryCount(), submatrix.getNonzeroEntryCount());
+    
+    // Starting from the smaller row, the larger rows do not fit and the matrix is not changed.
+    submatrix = matrix.selectRowsFromRowGroups(scheduler, true);
+    scheduler[0] = 0;
+    ASSERT_FALSE(submatrix.replaceRowsFromRowGroups(matrix, scheduler, {0}, false));
+    ASSERT_TRUE(submatrix == matrix.selectRowsFromRowGroups({1, 0, 0}, true));
+    
+    // With slack, every row of the group fits.
+    submatrix = matrix.selectRowsFromRowGroupsWithSlack({1, 0, 0});
+    ASSERT_EQ(3ull, submatrix.getRow(0).getNumberOfEntries());
+    ASSERT_EQ(2ull, submatrix.getRow(2).getNumberOfEntries());
+    ASSERT_TRUE(submatrix.replaceRowsFromRowGroups(matrix, scheduler, {0}, false));
+    ASSERT_TRUE(submatrix == matrix.selectRowsFromRowGroups(scheduler, true));
+}
+
 TEST(SparseMatrix, Transpose) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
@@ -522,6 +582,71 @@ TEST(SparseMatrix, MatrixVectorMultiply) {
     }
 }
 
+TEST(SparseMatrix, MatrixVectorMultiplyParallel) {
+    // Build a matrix with irregular row groups and row lengths.
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = storm::test::createIrregularNondeterministicMatrix(2000));
+    
+    std::vector<uint_fast64_t> partition = matrix.getEntryBalancedRowPartition(4);
+    ASSERT_EQ(5ull, partition.size());
+    EXPECT_EQ(0ull, partition.front());
+    EXPECT_EQ(matrix.getRowCount(), partition.back());
+    for (auto const& boundary : partition) {
+        EXPECT_TRUE(std::find(matrix.getRowGroupIndices().begin(), matrix.getRowGroupIndices().end(), boundary) != matrix.getRowGroupIndices().end());
+    }
+    
+    std::vector<double> x(matrix.getColumnCount());
+    for (uint_fast64_t index = 0; index < x.size(); ++index) {
+        x[index] = 0.5 + (index % 10) * 0.1;
+    }
+    std::vector<double> b(matrix.getRowCount(), 0.25);
+    std::vector<double> sequentialResult(matrix.getRowCount());
+    std::vector<double> parallelResult(matrix.getRowCount());
+    
+    ASSERT_NO_THROW(matrix.multiplyWithVectorSequential(x, sequentialResult, &b));
+    {
+        storm::test::ThreadCountGuard threadCountGuard(4);
+        ASSERT_NO_THROW(matrix.multiplyWithVectorParallel(x, parallelResult, &b));
+    }
+    
+    for (std::size_t index = 0; index < sequentialResult.size(); ++index) {
+        ASSERT_NEAR(sequentialResult[index], parallelResult[index], 1e-12);
+    }
+}
+
+TEST(SparseMatrix, MultiplyAndReduce) {
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = storm::test::createIrregularNondeterministicMatrix(2000));
+    
+    std::vector<double> x(matrix.getColumnCount());
+    for (uint_fast64_t index = 0; index < x.size(); ++index) {
+        x[index] = 0.5 + (index % 10) * 0.1;
+    }
+    std::vector<double> b(matrix.getRowCount());
+    for (uint_fast64_t index = 0; index < b.size(); ++index) {
+        b[index] = (index % 7) * 0.3;
+    }
+    std::vector<double> multiplyResult(matrix.getRowCount());
+    ASSERT_NO_THROW(matrix.multiplyWithVector(x, multiplyResult, &b));
+    
+    for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+        std::vector<double> expectedResult(matrix.getRowGroupCount());
+        std::vector<uint_fast64_t> expectedChoices(matrix.getRowGroupCount());
+        storm::utility::vector::reduceVectorMinOrMax(dir, multiplyResult, expectedResult, matrix.getRowGroupIndices(), &expectedChoices);
+        
+        for (uint_fast64_t threads : {1, 4}) {
+            storm::test::ThreadCountGuard threadCountGuard(threads);
+            std::vector<double> result(matrix.getRowGroupCount());
+            std::vector<uint_fast64_t> choices(matrix.getRowGroupCount());
+            ASSERT_NO_THROW(matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, result, &choices));
+            for (uint_fast64_t group = 0; group < result.size(); ++group) {
+                ASSERT_NEAR(expectedResult[group], result[group], 1e-12);
+                ASSERT_EQ(expectedChoices[group], choices[group]);
+            }
+        }
+    }
+}
+
 TEST(SparseMatrix, Iteration) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
@@ -1,4 +1,5 @@
 #include "gtest/gtest.h"
+#include "test/storm-test-helper.h"
 #include "storm-config.h"
 
 #include "storm/adapters/CarlAdapter.h"
@@ -10,6 +11,7 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/parallel.h"
 
 #include <memory>
 #include <iostream>
@@ -1046,6 +1048,44 @@ TEST(SylvanDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(SylvanDd, ParallelToMatrixTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 599);
+    
+    // Create a dense matrix whose values identify the position of each entry, so that misplaced entries are detected.
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> range = manager->getRange(x.first).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd = range * (manager->template getIdentity<double>(x.first) * manager->template getConstant<double>(1000) + manager->template getIdentity<double>(x.second) + manager->template getConstant<double>(1));
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> groupedDd = range * manager->getEncoding(a.first, 0).ite(dd, dd * manager->template getConstant<double>(2));
+    
+    storm::dd::Odd rowOdd = manager->getRange(x.first).createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).createOdd();
+    
+    storm::storage::SparseMatrix<double> sequentialMatrix;
+    storm::storage::SparseMatrix<double> sequentialGroupedMatrix;
+    {
+        storm::test::ThreadCountGuard threadCountGuard(1);
+        sequentialMatrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+        sequentialGroupedMatrix = groupedDd.toMatrix({a.first}, rowOdd, columnOdd);
+    }
+    
+    storm::storage::SparseMatrix<double> parallelMatrix;
+    storm::storage::SparseMatrix<double> parallelGroupedMatrix;
+    {
+        storm::test::ThreadCountGuard threadCountGuard(4);
+        parallelMatrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+        parallelGroupedMatrix = groupedDd.toMatrix({a.first}, rowOdd, columnOdd);
+    }
+    
+    EXPECT_EQ(360000ul, parallelMatrix.getNonzeroEntryCount());
+    EXPECT_EQ(1001.0, parallelMatrix.getRow(1).begin()->getValue());
+    EXPECT_TRUE(sequentialMatrix == parallelMatrix);
+    
+    EXPECT_EQ(1200ul, parallelGroupedMatrix.getRowCount());
+    EXPECT_EQ(600ul, parallelGroupedMatrix.getRowGroupCount());
+    EXPECT_TRUE(sequentialGroupedMatrix == parallelGroupedMatrix);
+}
+
 TEST(SylvanDd, BddOddTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/simd.h"
+
+namespace storm {
+    namespace test {
+
+        /*!
+         * Creates a nondeterministic matrix with irregular row groups and row lengths. Each row group has one to three
+         * rows and the rows have between a handful and a few hundred entries.
+         *
+         * @param rowGroupCount The number of row groups (and columns) of the matrix.
+         * @return The matrix.
+         */
+        inline storm::storage::SparseMatrix<double> createIrregularNondeterministicMatrix(uint_fast64_t rowGroupCount) {
+            storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, rowGroupCount, 0, false, true);
+            uint_fast64_t row = 0;
+            for (uint_fast64_t group = 0; group < rowGroupCount; ++group) {
+                matrixBuilder.newRowGroup(row);
+                for (uint_fast64_t choice = 0; choice < 1 + group % 3; ++choice) {
+                    for (uint_fast64_t column = (group * 7) % 13; column < rowGroupCount; column += 1 + (group + choice) % 97) {
+                        matrixBuilder.addNextValue(row, column, 1.0 / (1 + column + choice));
+                    }
+                    ++row;
+                }
+            }
+            return matrixBuilder.build();
+        }
+
+        /*!
+         * Sets the number of threads of storm's built-in parallel kernels for the lifetime of the object and restores
+         * the previous number afterwards, even if the test fails in between.
+         */
+        class ThreadCountGuard {
+        public:
+            ThreadCountGuard(uint_fast64_t numberOfThreads) : previousNumberOfThreads(storm::utility::parallel::getNumberOfThreads()) {
+                storm::utility::parallel::setNumberOfThreads(numberOfThreads);
+            }
+
+            ThreadCountGuard(ThreadCountGuard const& other) = delete;
+            ThreadCountGuard& operator=(ThreadCountGuard const& other) = delete;
+
+            ~ThreadCountGuard() {
+                storm::utility::parallel::setNumberOfThreads(previousNumberOfThreads);
+            }
+
+        private:
+            // The number of threads that was set before the guard was created.
+            uint_fast64_t previousNumberOfThreads;
+        };
+
+        /*!
+         * Selects the instruction set of storm's vectorized kernels for the lifetime of the object and restores the
+         * previous selection afterwards, even if the test fails in between.
+         */
+        class InstructionSetGuard {
+        public:
+            InstructionSetGuard(storm::utility::simd::InstructionSet const& instructionSet) : previousInstructionSet(storm::utility::simd::getInstructionSet()) {
+                storm::utility::simd::setInstructionSet(instructionSet);
+            }
+
+            InstructionSetGuard(InstructionSetGuard const& other) = delete;
+            InstructionSetGuard& operator=(InstructionSetGuard const& other) = delete;
+
+            ~InstructionSetGuard() {
+                storm::utility::simd::setInstructionSet(previousInstructionSet);
+            }
+
+        private:
+            // The instruction set that was selected before the guard was created.
+            storm::utility::simd::InstructionSet previousInstructionSet;
+        };
+
+    }
+}
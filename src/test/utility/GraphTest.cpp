@@ -1,6 +1,9 @@
 #include "gtest/gtest.h"
+#include "test/storm-test-helper.h"
 #include "storm-config.h"
 
+#include <thread>
+
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/parser/PrismParser.h"
 #include "storm/models/symbolic/Dtmc.h"
@@ -8,10 +11,12 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/builder/DdPrismModelBuilder.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/shortestPaths.cpp"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
@@ -669,3 +674,131 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, ExplicitProbGreater0StepBound) {
+    // State 0 reaches the target state 4 in two steps via state 1 and in three steps via states 2 and 3.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 5);
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 4, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 3, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 4, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 4, 1.0));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose();
+    
+    storm::storage::BitVector phiStates(5, true);
+    storm::storage::BitVector psiStates(5, std::vector<uint_fast64_t>({4}));
+    EXPECT_EQ(storm::storage::BitVector(5, std::vector<uint_fast64_t>({4})), storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, 0));
+    EXPECT_EQ(storm::storage::BitVector(5, std::vector<uint_fast64_t>({1, 3, 4})), storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, 1));
+    EXPECT_EQ(storm::storage::BitVector(5, std::vector<uint_fast64_t>({0, 1, 2, 3, 4})), storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, 2));
+    EXPECT_EQ(storm::storage::BitVector(5, std::vector<uint_fast64_t>({0, 1, 2, 3, 4})), storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates));
+    
+    phiStates.set(1, false);
+    EXPECT_EQ(storm::storage::BitVector(5, std::vector<uint_fast64_t>({2, 3, 4})), storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, 2));
+    EXPECT_EQ(storm::storage::BitVector(5, std::vector<uint_fast64_t>({0, 2, 3, 4})), storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, 3));
+}
+
+TEST(GraphTest, ExplicitProb01Parallel) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    storm::models::sparse::Mdp<double> const& mdp = *model->as<storm::models::sparse::Mdp<double>>();
+    storm::storage::BitVector phiStates(model->getNumberOfStates(), true);
+    storm::storage::BitVector psiStates = model->getStates("collision_max_backoff");
+    
+    // The results must not depend on whether the frontiers are explored in parallel. We call the functions on the
+    // matrices, as the model would return its cached results, and let even small frontiers be explored in parallel.
+    storm::storage::SparseMatrix<double> const& transitionMatrix = mdp.getTransitionMatrix();
+    storm::storage::SparseMatrix<double> backwardTransitions = transitionMatrix.transpose(true);
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> sequentialMinResult = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> sequentialMaxResult = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> parallelMinResult;
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> parallelMaxResult;
+    {
+        storm::test::ThreadCountGuard threadCountGuard(4);
+        uint_fast64_t minimalParallelFrontierSize = storm::utility::graph::getMinimalParallelFrontierSize();
+        storm::utility::graph::setMinimalParallelFrontierSize(1);
+        parallelMinResult = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        parallelMaxResult = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        storm::utility::graph::setMinimalParallelFrontierSize(minimalParallelFrontierSize);
+    }
+    
+    EXPECT_EQ(sequentialMinResult, parallelMinResult);
+    EXPECT_EQ(sequentialMaxResult, parallelMaxResult);
+    EXPECT_EQ(993ull, parallelMinResult.first.getNumberOfSetBits());
+    EXPECT_EQ(16ull, parallelMinResult.second.getNumberOfSetBits());
+}
+
+TEST(GraphTest, ExplicitProb01ModelCache) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    storm::models::sparse::Mdp<double> const& mdp = *model->as<storm::models::sparse::Mdp<double>>();
+    storm::storage::BitVector phiStates(model->getNumberOfStates(), true);
+    
+    // The backward transitions are only computed once.
+    EXPECT_EQ(&mdp.getBackwardTransitions(), &mdp.getBackwardTransitions());
+    
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01Min = storm::utility::graph::performProb01Min(mdp, phiStates, model->getStates("all_coins_equal_0"));
+    EXPECT_EQ(statesWithProbability01Min, storm::utility::graph::performProb01Min(mdp, phiStates, model->getStates("all_coins_equal_0")));
+    EXPECT_EQ(1ul, mdp.getQualitativeResultCache().getNumberOfEntries());
+    
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01Max(mdp, phiStates, model->getStates("all_coins_equal_0"));
+    EXPECT_EQ(74ull, statesWithProbability01.first.getNumberOfSetBits());
+    EXPECT_EQ(198ull, statesWithProbability01.second.getNumberOfSetBits());
+    EXPECT_EQ(2ul, mdp.getQualitativeResultCache().getNumberOfEntries());
+    
+    // Obtaining the matrix through the non-constant getter keeps the caches (and references into them) valid.
+    storm::storage::SparseMatrix<double> const* backwardTransitions = &mdp.getBackwardTransitions();
+    EXPECT_EQ(model->getNumberOfStates(), model->getTransitionMatrix().getColumnCount());
+    EXPECT_EQ(backwardTransitions, &mdp.getBackwardTransitions());
+    EXPECT_EQ(2ul, mdp.getQualitativeResultCache().getNumberOfEntries());
+    
+    model->invalidateCaches();
+    EXPECT_EQ(0ul, mdp.getQualitativeResultCache().getNumberOfEntries());
+    
+    // Concurrent queries construct the backward transitions only once and share the cached results.
+    std::vector<storm::storage::SparseMatrix<double> const*> backwardTransitionsOfThreads(4);
+    std::vector<std::pair<storm::storage::BitVector, storm::storage::BitVector>> resultsOfThreads(4);
+    std::vector<std::thread> threads;
+    for (uint_fast64_t thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&, thread] () {
+            backwardTransitionsOfThreads[thread] = &mdp.getBackwardTransitions();
+            resultsOfThreads[thread] = storm::utility::graph::performProb01Min(mdp, phiStates, model->getStates("all_coins_equal_0"));
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (uint_fast64_t thread = 0; thread < 4; ++thread) {
+        EXPECT_EQ(&mdp.getBackwardTransitions(), backwardTransitionsOfThreads[thread]);
+        EXPECT_EQ(statesWithProbability01Min, resultsOfThreads[thread]);
+    }
+    EXPECT_EQ(1ul, mdp.getQualitativeResultCache().getNumberOfEntries());
+}
+
+TEST(GraphTest, ExplicitMarkovAutomatonCloseInvalidatesCaches) {
+    // State 0 is hybrid: its Markovian choice leads to state 1 and its probabilistic choice is a self-loop.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(3, 2, 3, true, true, 2);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 1, 2.0);
+    matrixBuilder.addNextValue(1, 0, 1.0);
+    matrixBuilder.newRowGroup(2);
+    matrixBuilder.addNextValue(2, 1, 1.0);
+    storm::storage::BitVector markovianStates(2, true);
+    storm::models::sparse::MarkovAutomaton<double> ma(matrixBuilder.build(), storm::models::sparse::StateLabeling(2), markovianStates);
+    ASSERT_FALSE(ma.isClosed());
+    
+    storm::storage::BitVector allStates(2, true);
+    storm::storage::BitVector targetStates(2);
+    targetStates.set(1);
+    EXPECT_EQ(2ull, ma.getBackwardTransitions().getRow(1).getNumberOfEntries());
+    EXPECT_EQ(allStates, storm::utility::graph::performProb01Max(ma, allStates, targetStates).second);
+    
+    // Closing removes the Markovian choice of state 0, so state 1 is no longer reachable from it.
+    ma.close();
+    EXPECT_EQ(1ull, ma.getBackwardTransitions().getRow(1).getNumberOfEntries());
+    EXPECT_EQ(targetStates, storm::utility::graph::performProb01Max(ma, allStates, targetStates).second);
+}
@@ -0,0 +1,43 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/utility/OperationCache.h"
+#include "storm/utility/constants.h"
+
+#ifdef STORM_HAVE_CARL
+#include<carl/core/VariablePool.h>
+#endif
+
+TEST(OperationCacheTest, Double) {
+    storm::utility::OperationCache<double> cache;
+    EXPECT_EQ(0.125, cache.multiply(0.25, 0.5));
+    EXPECT_EQ(0.75, cache.add(0.25, 0.5));
+    EXPECT_EQ(4.0, cache.inverseOfOneMinus(0.75));
+}
+
+#ifdef STORM_HAVE_CARL
+TEST(OperationCacheTest, RationalFunction) {
+    std::shared_ptr<storm::RawPolynomialCache> polynomialCache = std::make_shared<storm::RawPolynomialCache>();
+    storm::RationalFunctionVariable p = carl::VariablePool::getInstance().getFreshVariable("p");
+    storm::RationalFunction f(storm::RationalFunction::PolyType(storm::RationalFunction::PolyType::PolyType(p), polynomialCache));
+    storm::RationalFunction g = storm::utility::one<storm::RationalFunction>() - f;
+
+    storm::utility::OperationCache<storm::RationalFunction> cache;
+    storm::RationalFunction product = cache.multiply(f, g);
+    EXPECT_EQ(storm::utility::simplify((storm::RationalFunction) (f * g)), product);
+    EXPECT_EQ(0ul, cache.getNumberOfHits());
+
+    // Multiplication is commutative, so the swapped operation reuses the result.
+    EXPECT_EQ(product, cache.multiply(g, f));
+    EXPECT_EQ(1ul, cache.getNumberOfHits());
+
+    EXPECT_EQ(storm::utility::one<storm::RationalFunction>(), cache.add(f, g));
+    EXPECT_EQ(storm::utility::simplify((storm::RationalFunction) (storm::utility::one<storm::RationalFunction>() / g)), cache.inverseOfOneMinus(f));
+    EXPECT_EQ(4ul, cache.getNumberOfLookups());
+    EXPECT_EQ(1ul, cache.getNumberOfHits());
+
+    cache.clear();
+    EXPECT_EQ(product, cache.multiply(f, g));
+    EXPECT_EQ(1ul, cache.getNumberOfHits());
+}
+#endif